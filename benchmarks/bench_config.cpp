@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "sim/Config.hpp"
+#include "sim/ConfigBlob.hpp"
+#include "sim/Json.hpp"
+
+#ifndef TD_CONFIG_DIR
+#define TD_CONFIG_DIR "config"
+#endif
+
+// Lecture de la config de partie : les fichiers livrés (lus au lancement et
+// à chaque partie), le bloc compilé qui les remplace, puis un document de
+// 4000 difficultés.
+
+namespace {
+
+std::string bigDifficulties(int count) {
+    std::string s = "{\n";
+    for (int i = 0; i < count; ++i) {
+        s += "  \"Level" + std::to_string(i) + "\": { \"hpMultiplier\": 1." + std::to_string(i % 10)
+           + ", \"speedMultiplier\": 0.9, \"rewardMultiplier\": 1.2, \"livesStart\": " + std::to_string(10 + i % 20) + " }";
+        s += i + 1 < count ? ",\n" : "\n";
+    }
+    return s + "}\n";
+}
+
+} // namespace
+
+TEST_CASE("Config parsing", "[!benchmark][config]") {
+    BENCHMARK("load diffilculty.json") {
+        std::vector<DifficultyParams> all;
+        loadDifficulties(TD_CONFIG_DIR "/diffilculty.json", all);
+        return all.size();
+    };
+    BENCHMARK("load game_rules.json") {
+        GameRules rules;
+        loadGameRules(TD_CONFIG_DIR "/game_rules.json", rules);
+        return rules.startMaterials[0];
+    };
+
+    // Bloc compilé : ouverture (mmap + checksum), puis multiplicateurs lus à plat
+    const std::string blobPath = (std::filesystem::temp_directory_path() / "td_bench_config.tdcb").string();
+    compileConfigFiles(TD_CONFIG_DIR "/diffilculty.json", TD_CONFIG_DIR "/game_rules.json", blobPath);
+    BENCHMARK("open config.tdcb") {
+        ConfigBlob blob;
+        blob.open(blobPath);
+        return blob.difficultyCount();
+    };
+    ConfigBlob blob;
+    blob.open(blobPath);
+    BENCHMARK("difficulty lookup: blob record") {
+        const int i = blob.findDifficulty("Hard");
+        return blob.difficultyRecord(static_cast<std::size_t>(i)).hpMultiplier;
+    };
+
+    const std::string text = bigDifficulties(4000);
+    BENCHMARK("parse 4000 difficulties (" + std::to_string(text.size() / 1024) + " KiB)") {
+        JsonValue root;
+        parseJson(text, root);
+        std::vector<DifficultyParams> all;
+        parseDifficulties(root, all);
+        return all.size();
+    };
+    JsonValue root;
+    parseJson(text, root);
+    BENCHMARK("write 4000 difficulties") {
+        return writeJson(root).size();
+    };
+}
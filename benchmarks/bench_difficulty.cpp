@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "sim/Game.hpp"
+#include "sim/Systems.hpp"
+
+// Boucles d'ennemis de Game::stepWave à 50 000 ennemis : chemin générique
+// (vitesse et récompense lues par ennemi), preset figé (constantes de
+// compilation) et Custom (valeurs uniformes lues à l'exécution).
+
+namespace {
+
+constexpr std::size_t kEnemies = 50'000;
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+
+// Carte ouverte 256x256, sortie au centre du bord droit
+GridMap openMap() {
+    GridMap m(256, 256);
+    m.exits  = {Cell{255, 128}};
+    m.spawns = {Cell{0, 128}};
+    return m;
+}
+
+EnemyStore makeEnemies(const DifficultyParams& d) {
+    EnemyStore e;
+    std::uint32_t s = 11u;
+    for (std::size_t i = 0; i < kEnemies; ++i) {
+        EnemySpawn sp;
+        sp.x      = static_cast<float>(lcg(s) % 25000u) / 100.f;
+        sp.y      = static_cast<float>(lcg(s) % 25600u) / 100.f;
+        sp.hp     = (i % 10 == 0) ? 0.f : 30.f; // un sur dix meurt au passage de removeDeadEnemies
+        sp.speed  = Game::kEnemySpeed * d.speedMultiplier;
+        sp.reward = EnemyTuning<RuntimePolicy>{{d.hpMultiplier, d.speedMultiplier, d.rewardMultiplier}}.reward(e, 0);
+        e.spawn(sp);
+    }
+    return e;
+}
+
+template <class Tuning>
+void benchSteer(const char* name, const FlowFieldSet& fields, const Tuning& tuning, const DifficultyParams& d) {
+    EnemyStore e = makeEnemies(d);
+    const EnemyStore start = e;
+    std::vector<Handle> arrived;
+    BENCHMARK(name) {
+        // Repart des mêmes positions : chaque mesure fait le même travail
+        e.posX = start.posX;
+        e.posY = start.posY;
+        arrived.clear();
+        steerEnemiesByFlowField(e, fields, Game::kDt, tuning, &arrived);
+        return arrived.size();
+    };
+}
+
+template <class Tuning>
+void benchRewards(const char* name, const Tuning& tuning, const DifficultyParams& d) {
+    const EnemyStore start = makeEnemies(d);
+    BENCHMARK_ADVANCED(name)(Catch::Benchmark::Chronometer meter) {
+        std::vector<EnemyStore> runs(static_cast<std::size_t>(meter.runs()), start);
+        std::vector<Handle>     killed;
+        meter.measure([&](int r) {
+            killed.clear();
+            return removeDeadEnemies(runs[static_cast<std::size_t>(r)], tuning, &killed);
+        });
+    };
+}
+
+} // namespace
+
+TEST_CASE("Enemy loops: preset policy vs generic", "[!benchmark][difficulty]") {
+    FlowFieldSet fields;
+    fields.build(openMap());
+
+    DifficultyParams hard;
+    hard.name             = "Hard";
+    hard.hpMultiplier     = HardPolicy::hp;
+    hard.speedMultiplier  = HardPolicy::speed;
+    hard.rewardMultiplier = HardPolicy::reward;
+    REQUIRE(matchPreset(hard) == DifficultyPreset::Hard);
+    const RuntimePolicy custom{hard.hpMultiplier, hard.speedMultiplier, hard.rewardMultiplier};
+
+    benchSteer("steer 50000: generic (per-enemy speed)", fields, PerEnemyTuning{}, hard);
+    benchSteer("steer 50000: Hard preset (constexpr)", fields, EnemyTuning<HardPolicy>{}, hard);
+    benchSteer("steer 50000: Custom (runtime)", fields, EnemyTuning<RuntimePolicy>{custom}, hard);
+
+    benchRewards("rewards 50000: generic (per-enemy reward)", PerEnemyTuning{}, hard);
+    benchRewards("rewards 50000: Hard preset (constexpr)", EnemyTuning<HardPolicy>{}, hard);
+    benchRewards("rewards 50000: Custom (runtime)", EnemyTuning<RuntimePolicy>{custom}, hard);
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "sim/EntityStore.hpp"
+#include "sim/Systems.hpp"
+
+// Comparaison SoA (EnemyStore) vs disposition "naïve" : un objet
+// polymorphe par ennemi, alloué sur le tas et tenu par unique_ptr.
+
+namespace {
+
+struct Enemy {
+    virtual ~Enemy() = default;
+    virtual void update(const Path& path, float dt) {
+        if (pathIdx >= path.size()) return;
+        const float dx = path.x[pathIdx] - x;
+        const float dy = path.y[pathIdx] - y;
+        const float dist = std::sqrt(dx * dx + dy * dy);
+        const float step = speed * dt;
+        if (dist <= step) { x = path.x[pathIdx]; y = path.y[pathIdx]; ++pathIdx; return; }
+        vx = dx * (speed / dist);
+        vy = dy * (speed / dist);
+        x += vx * dt;
+        y += vy * dt;
+    }
+
+    float x = 0.f, y = 0.f, vx = 0.f, vy = 0.f;
+    float hp = 100.f, speed = 1.f;
+    std::uint32_t pathIdx = 0, reward = 1;
+    char  cold[64] = {}; // nom, sprite, etc. : ce qu'un objet "complet" traîne avec lui
+};
+
+Path makePath() {
+    Path p;
+    for (int i = 0; i < 64; ++i) {
+        p.x.push_back(static_cast<float>((i % 2) ? 200 : 0));
+        p.y.push_back(static_cast<float>(i * 4));
+    }
+    return p;
+}
+
+float spawnX(std::size_t i) { return static_cast<float>(i % 97) * 0.5f; }
+float spawnY(std::size_t i) { return static_cast<float>(i % 89) * 0.5f; }
+
+std::vector<std::unique_ptr<Enemy>> makeNaive(std::size_t n) {
+    std::vector<std::unique_ptr<Enemy>> v;
+    std::vector<std::unique_ptr<char[]>> noise; // fragmente le tas comme une vraie partie
+    for (std::size_t i = 0; i < n; ++i) {
+        auto e = std::make_unique<Enemy>();
+        e->x = spawnX(i);
+        e->y = spawnY(i);
+        e->speed = 1.f + static_cast<float>(i % 7) * 0.1f;
+        v.push_back(std::move(e));
+        noise.push_back(std::make_unique<char[]>(48 + (i % 5) * 16));
+    }
+    return v;
+}
+
+EnemyStore makeSoA(std::size_t n) {
+    EnemyStore s;
+    s.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        s.spawn(EnemySpawn{spawnX(i), spawnY(i), 100.f, 1.f + static_cast<float>(i % 7) * 0.1f, 1});
+    }
+    return s;
+}
+
+} // namespace
+
+TEST_CASE("Entity update: SoA vs vector<unique_ptr>", "[!benchmark][entities]") {
+    const Path  path = makePath();
+    const float dt   = 1.f / 120.f;
+
+    for (std::size_t n : {10'000u, 50'000u}) {
+        auto naive = makeNaive(n);
+        auto soa   = makeSoA(n);
+
+        BENCHMARK("naive move " + std::to_string(n)) {
+            for (auto& e : naive) e->update(path, dt);
+            return naive.front()->x;
+        };
+        BENCHMARK("SoA move " + std::to_string(n)) {
+            moveEnemiesAlongPath(soa, path, dt);
+            return soa.posX.front();
+        };
+
+        BENCHMARK("naive splash " + std::to_string(n)) {
+            for (auto& e : naive) {
+                const float dx = e->x - 20.f, dy = e->y - 20.f;
+                if (dx * dx + dy * dy <= 100.f) e->hp -= 0.001f;
+            }
+            return naive.front()->hp;
+        };
+        BENCHMARK("SoA splash " + std::to_string(n)) {
+            applySplashDamage(soa, 20.f, 20.f, 10.f, 0.001f);
+            return soa.hp.front();
+        };
+    }
+}
+
+TEST_CASE("Entity churn: spawn + kill through handles", "[!benchmark][entities]") {
+    BENCHMARK_ADVANCED("SoA spawn/kill 10000")(Catch::Benchmark::Chronometer meter) {
+        EnemyStore s = makeSoA(10'000);
+        std::vector<Handle> killed;
+        meter.measure([&] {
+            // Tue un ennemi sur trois puis recomble : exerce la free list
+            for (std::size_t i = 0; i < s.size(); i += 3) s.hp[i] = 0.f;
+            killed.clear();
+            removeDeadEnemies(s, &killed);
+            for (std::size_t k = 0; k < killed.size(); ++k) s.spawn(EnemySpawn{});
+            return s.size();
+        });
+    };
+}
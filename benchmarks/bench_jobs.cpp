@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sim/FlowField.hpp"
+#include "sim/JobSystem.hpp"
+#include "sim/SpatialGrid.hpp"
+
+// Passage à l'échelle des étapes réparties par le JobSystem, de 1 à 16
+// threads : reconstruction de la grille (200 000 ennemis), ciblage de
+// 4000 tours et champs de flux d'une carte 256x256 à 16 sorties.
+// Au-delà du nombre de cœurs, les threads se partagent les mêmes cœurs.
+// Tag [scaling] : les temps dépendent du nombre de cœurs, ce cas reste hors
+// de la référence et de bench_report (à lancer à part : "[jobs]").
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+
+EnemyStore makeEnemies() {
+    EnemyStore e;
+    e.reserve(200'000);
+    std::uint32_t s = 7u;
+    for (int i = 0; i < 200'000; ++i) {
+        EnemySpawn sp;
+        sp.x  = static_cast<float>(lcg(s) % 25600u) / 100.f;
+        sp.y  = static_cast<float>(lcg(s) % 25600u) / 100.f;
+        sp.hp = static_cast<float>(1 + lcg(s) % 100u);
+        e.spawn(sp);
+    }
+    return e;
+}
+
+TowerStore makeTowers() {
+    TowerStore t;
+    std::uint32_t s = 13u;
+    for (int i = 0; i < 4000; ++i) {
+        TowerSpec spec;
+        spec.x    = static_cast<float>(lcg(s) % 256u) + 0.5f;
+        spec.y    = static_cast<float>(lcg(s) % 256u) + 0.5f;
+        spec.mode = static_cast<TargetMode>(i % 3);
+        t.build(spec);
+    }
+    return t;
+}
+
+// Murs épars, sorties réparties sur les bords droit et bas
+GridMap makeMap() {
+    GridMap m(256, 256);
+    std::uint32_t s = 21u;
+    for (std::size_t i = 0; i < m.cellCount(); ++i) m.blocked[i] = (lcg(s) % 100u) < 15u ? 1 : 0;
+    for (int k = 0; k < 8; ++k) {
+        m.exits.push_back(Cell{255, 16 + k * 30});
+        m.exits.push_back(Cell{16 + k * 30, 255});
+    }
+    for (const Cell& c : m.exits) m.blocked[m.index(c)] = 0;
+    m.spawns = {Cell{0, 0}};
+    m.blocked[0] = 0;
+    return m;
+}
+
+} // namespace
+
+TEST_CASE("Job system scaling: 1/2/4/8/16 threads", "[!benchmark][jobs][scaling]") {
+    const EnemyStore e = makeEnemies();
+    TowerStore       towers = makeTowers();
+    const GridMap    map = makeMap();
+    WARN("hardware threads: " << std::thread::hardware_concurrency());
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u}) {
+        JobSystem jobs(threads);
+        const std::string suffix = ": " + std::to_string(threads) + (threads == 1 ? " thread" : " threads");
+
+        SpatialGrid grid;
+        grid.configure(256.f, 256.f, 3.f);
+        BENCHMARK("grid rebuild 200000" + suffix) {
+            grid.rebuild(e, &jobs);
+            return grid.size();
+        };
+        BENCHMARK("targets 4000 towers" + suffix) {
+            acquireTargets(towers, e, grid, &jobs);
+            return towers.target[0].index;
+        };
+        FlowFieldSet fields;
+        BENCHMARK("flow fields 16 exits 256x256" + suffix) {
+            fields.build(map, &jobs);
+            return fields.fields.size();
+        };
+    }
+}
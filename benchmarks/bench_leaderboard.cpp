@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "sim/Json.hpp"
+#include "sim/Leaderboard.hpp"
+
+// Classement stocké comme aujourd'hui dans config/scores.json : un seul
+// document { "scores": [...] }. Ajouter un score = relire, ajouter, réécrire
+// tout le fichier ; un top 10 = relire et trier. Comparé au journal en ajout
+// seul (sim/Leaderboard.hpp) et à son index, jusqu'à 1M de scores.
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+
+const char* const kDifficulties[] = {"Easy", "Normal", "Hard", "Custom"};
+
+JsonValue scoreEntry(std::uint32_t& seed, int i) {
+    JsonValue e = JsonValue::makeObject();
+    e.set("name",       JsonValue::makeString("player" + std::to_string(i)));
+    e.set("difficulty", JsonValue::makeString(kDifficulties[lcg(seed) % 4u]));
+    e.set("score",      JsonValue::makeNumber(static_cast<double>(lcg(seed) % 1'000'000u)));
+    e.set("waves",      JsonValue::makeNumber(static_cast<double>(lcg(seed) % 40u)));
+    return e;
+}
+
+std::string scoresDocument(int count) {
+    std::uint32_t seed = 11u;
+    JsonValue list = JsonValue::makeArray();
+    for (int i = 0; i < count; ++i) list.push(scoreEntry(seed, i));
+    JsonValue root = JsonValue::makeObject();
+    root.set("scores", std::move(list));
+    return writeJson(root);
+}
+
+// Top n d'une difficulté, meilleur score d'abord
+std::vector<double> topScores(const JsonValue& root, const std::string& difficulty, std::size_t n) {
+    std::vector<double> out;
+    for (const JsonValue& e : root.find("scores")->items()) {
+        if (e.find("difficulty")->asString() == difficulty) out.push_back(e.number("score", 0.0));
+    }
+    const std::size_t k = std::min(n, out.size());
+    std::partial_sort(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(k), out.end(), std::greater<>());
+    out.resize(k);
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("Leaderboard in scores.json", "[!benchmark][leaderboard]") {
+    for (int count : {1'000, 10'000}) {
+        const std::string doc = scoresDocument(count);
+        const std::string tag = std::to_string(count) + " scores";
+        std::uint32_t seed = 5u;
+
+        BENCHMARK("insert into " + tag + " (parse + rewrite)") {
+            JsonValue root;
+            parseJson(doc, root);
+            JsonValue list = *root.find("scores");
+            list.push(scoreEntry(seed, count));
+            root.set("scores", std::move(list));
+            return writeJson(root).size();
+        };
+        BENCHMARK("top 10 Normal in " + tag + " (parse + sort)") {
+            JsonValue root;
+            parseJson(doc, root);
+            return topScores(root, "Normal", 10).size();
+        };
+    }
+}
+
+TEST_CASE("Leaderboard log and index", "[!benchmark][leaderboard]") {
+    const std::string path = (std::filesystem::temp_directory_path() / "td_bench_scores.tdlb").string();
+    for (int count : {10'000, 1'000'000}) {
+        const std::string tag = std::to_string(count) + " scores";
+        std::filesystem::remove(path);
+        {
+            std::uint32_t seed = 11u;
+            std::vector<ScoreEntry> entries;
+            for (int i = 0; i < count; ++i) {
+                ScoreEntry e;
+                e.name       = "player" + std::to_string(i);
+                e.difficulty = kDifficulties[lcg(seed) % 4u];
+                e.score      = lcg(seed) % 1'000'000u;
+                e.waves      = lcg(seed) % 40u;
+                entries.push_back(std::move(e));
+            }
+            Leaderboard board;
+            board.open(path);
+            board.submit(entries);
+        }
+
+        Leaderboard board;
+        if (count <= 10'000) {
+            BENCHMARK("open " + tag + " (replay log + index)") { return board.open(path) ? board.size() : 0; };
+        }
+        board.open(path);
+
+        std::uint32_t seed = 5u;
+        int i = count;
+        BENCHMARK("submit into " + tag + " (append + fsync + index)") {
+            ScoreEntry e;
+            e.name       = "player" + std::to_string(i++);
+            e.difficulty = kDifficulties[lcg(seed) % 4u];
+            e.score      = lcg(seed) % 1'000'000u;
+            return board.submit(e);
+        };
+        BENCHMARK("top 10 Normal in " + tag) { return board.top("Normal", 10).size(); };
+        BENCHMARK("rank in " + tag) { return board.rank("Hard", lcg(seed) % 1'000'000u); };
+
+        ScoreIndex index;
+        std::uint32_t id = 0;
+        for (; id < static_cast<std::uint32_t>(count); ++id) index.insert(id, static_cast<std::uint16_t>(id % 4u), lcg(seed) % 1'000'000u);
+        BENCHMARK("index insert into " + tag) {
+            index.insert(id, static_cast<std::uint16_t>(id % 4u), lcg(seed) % 1'000'000u);
+            return ++id;
+        };
+    }
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,58 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sim/MapGen.hpp"
+
+// Génération de cartes : un candidat seul, validation seule, graine complète
+// sur un cœur puis sur tous (candidats en parallèle). td_mapgen donne le
+// débit en cartes/s.
+
+TEST_CASE("Map generation", "[!benchmark][mapgen]") {
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (int size : {128, 512}) {
+        MapGenParams params;
+        params.width  = size;
+        params.height = size;
+        const std::string tag = std::to_string(size) + "x" + std::to_string(size);
+
+        BENCHMARK("candidate " + tag) { return generateCandidate(params, 42, 0).blocked.size(); };
+
+        const GridMap m = generateCandidate(params, 42, 0);
+        MapCheckScratch scratch;
+        BENCHMARK("validate " + tag) { return validateMap(m, params.pathLength(), scratch); };
+
+        std::uint64_t seed = 1;
+        BENCHMARK("seed " + tag + " (1 thread)") {
+            GridMap out;
+            return generateMap(params, seed++, out, nullptr, 1);
+        };
+        BENCHMARK("seed " + tag + " (" + std::to_string(cores) + " threads)") {
+            GridMap out;
+            return generateMap(params, seed++, out, nullptr, cores);
+        };
+    }
+}
+
+TEST_CASE("Map cache", "[!benchmark][mapgen]") {
+    MapGenParams params;
+    params.width  = 512;
+    params.height = 512;
+    GridMap m;
+    generateMap(params, 42, m);
+    std::vector<std::uint8_t> bytes;
+    encodeMap(m, 42, params.hash(), bytes);
+
+    BENCHMARK("encode 512x512") {
+        encodeMap(m, 42, params.hash(), bytes);
+        return bytes.size();
+    };
+    BENCHMARK("decode 512x512") {
+        GridMap out;
+        return decodeMap(bytes.data(), bytes.size(), 42, params.hash(), out);
+    };
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sim/AStar.hpp"
+#include "sim/FlowField.hpp"
+
+// Construction d'un champ de flux par sortie et coût de lecture par agent,
+// comparés à un A* par agent (ce que le README prévoyait au départ).
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+
+// ~20 % d'obstacles, une sortie par bord droit/bas, spawns à gauche
+GridMap randomMap(int size, std::uint32_t seed) {
+    GridMap m(size, size);
+    for (auto& b : m.blocked) b = (lcg(seed) % 100u) < 20u ? 1 : 0;
+    m.exits  = {Cell{size - 1, size / 2}, Cell{size / 2, size - 1}};
+    m.spawns = {Cell{0, size / 2}};
+    for (const Cell& c : m.exits)  m.blocked[m.index(c)] = 0;
+    for (const Cell& c : m.spawns) m.blocked[m.index(c)] = 0;
+    return m;
+}
+
+} // namespace
+
+TEST_CASE("Flow field build and lookup", "[!benchmark][pathfinding]") {
+    for (int size : {256, 1024}) {
+        const GridMap m = randomMap(size, 42u);
+        const std::string tag = std::to_string(size) + "x" + std::to_string(size);
+
+        FlowFieldSet set;
+        BENCHMARK("build " + tag + " (" + std::to_string(m.exits.size()) + " exits)") {
+            set.build(m);
+            return set.fields[0].distance(m.spawns[0]);
+        };
+
+        // Positions d'agents aléatoires ; coût par agent = temps / kAgents
+        constexpr std::size_t kAgents = 100'000;
+        std::vector<float> ax(kAgents), ay(kAgents);
+        std::uint32_t s = 7u;
+        for (std::size_t i = 0; i < kAgents; ++i) {
+            ax[i] = static_cast<float>(lcg(s) % (size * 100)) / 100.f;
+            ay[i] = static_cast<float>(lcg(s) % (size * 100)) / 100.f;
+        }
+        set.build(m);
+        BENCHMARK("lookup " + tag + " x100000 agents") {
+            std::uint32_t acc = 0;
+            for (std::size_t i = 0; i < kAgents; ++i) {
+                acc += set.fields[i & 1].sample(ax[i], ay[i]);
+            }
+            return acc;
+        };
+    }
+}
+
+TEST_CASE("A* per agent (reference)", "[!benchmark][pathfinding]") {
+    for (int size : {256, 1024}) {
+        const GridMap m = randomMap(size, 42u);
+        std::vector<Cell> path;
+        BENCHMARK("A* " + std::to_string(size) + "x" + std::to_string(size) + " x1 agent") {
+            return findPathAStar(m, m.spawns[0], m.exits[0], path);
+        };
+    }
+}
+
+TEST_CASE("Placement check (forbidTotalBlock) vs full rebuild", "[!benchmark][pathfinding][repair]") {
+    for (int size : {256, 1024}) {
+        const GridMap m = randomMap(size, 42u);
+        const std::string tag = std::to_string(size) + "x" + std::to_string(size);
+        FlowFieldSet set;
+        set.build(m);
+
+        // Cases candidates : n'importe où, puis collées à une sortie (pire cas)
+        std::vector<Cell> anywhere, nearExit;
+        std::uint32_t s = 3u;
+        while (anywhere.size() < 256) {
+            const Cell c{static_cast<int>(lcg(s) % size), static_cast<int>(lcg(s) % size)};
+            if (m.passable(c)) anywhere.push_back(c);
+        }
+        const Cell e = m.exits[0];
+        for (int dy = -3; dy <= 3; ++dy)
+            for (int dx = -3; dx <= 0; ++dx)
+                if (m.passable(e.x + dx, e.y + dy)) nearExit.push_back(Cell{e.x + dx, e.y + dy});
+
+        std::size_t i = 0;
+        BENCHMARK("wouldFullyBlock " + tag + " random cell") {
+            return set.wouldFullyBlock(m, anywhere[i++ % anywhere.size()]);
+        };
+        BENCHMARK("wouldFullyBlock " + tag + " next to exit") {
+            return set.wouldFullyBlock(m, nearExit[i++ % nearExit.size()]);
+        };
+
+        GridMap copy = m;
+        BENCHMARK("incremental repair " + tag + " place + remove") {
+            const Cell c = anywhere[i++ % anywhere.size()];
+            set.setBlocked(copy, c, true);
+            set.setBlocked(copy, c, false);
+            return set.fields[0].distance(copy.spawns[0]);
+        };
+        BENCHMARK("full rebuild " + tag + " (reference)") {
+            copy.blocked[copy.index(anywhere[i % anywhere.size()])] ^= 1;
+            FlowFieldSet full;
+            full.build(copy);
+            return full.fields[0].distance(copy.spawns[0]);
+        };
+    }
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "sim/Simd.hpp"
+
+// Noyaux de Simd.hpp à 100 000 entités, pour chaque niveau que le CPU
+// supporte, puis un résumé en entités/ns.
+
+namespace {
+
+constexpr std::size_t kCount = 100'000;
+constexpr float       kDt    = 1.f / 120.f;
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+
+// Zigzag de 64 waypoints : personne n'arrive au bout pendant la mesure
+Path makePath() {
+    Path p;
+    for (int i = 0; i < 64; ++i) {
+        p.x.push_back(static_cast<float>((i % 2) ? 200 : 0));
+        p.y.push_back(static_cast<float>(i * 3));
+    }
+    return p;
+}
+
+EnemyStore makeEnemies() {
+    EnemyStore e;
+    e.reserve(kCount);
+    std::uint32_t s = 5u;
+    for (std::size_t i = 0; i < kCount; ++i) {
+        EnemySpawn sp;
+        sp.x     = static_cast<float>(lcg(s) % 20000u) / 100.f;
+        sp.y     = static_cast<float>(lcg(s) % 300u) / 100.f;
+        sp.speed = 1.f + static_cast<float>(lcg(s) % 100u) / 100.f;
+        e.spawn(sp);
+    }
+    return e;
+}
+
+// Un projectile par ennemi, à distance : sur des positions figées, aucun
+// impact, donc rien n'est détruit
+ProjectileStore makeProjectiles(const EnemyStore& e) {
+    ProjectileStore p;
+    for (std::uint32_t i = 0; i < e.size(); ++i) {
+        ProjectileSpawn sp;
+        sp.x      = e.posX[i] + 5.f;
+        sp.y      = e.posY[i];
+        sp.vx     = -1.f;
+        sp.damage = 10.f;
+        sp.ttl    = 1e9f;
+        sp.target = e.ids.handleAt(i);
+        p.fire(sp);
+    }
+    return p;
+}
+
+// f() traite un lot et retourne le nombre d'entités réellement parcourues
+template <class F>
+double entitiesPerNs(F&& f) {
+    constexpr int kReps = 200;
+    f();
+    std::size_t processed = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < kReps; ++r) processed += f();
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    return static_cast<double>(processed) / ns;
+}
+
+} // namespace
+
+TEST_CASE("SIMD kernels: scalar vs SSE4.1 vs AVX2", "[!benchmark][simd]") {
+    const Path path = makePath();
+    EnemyStore      e = makeEnemies();
+    ProjectileStore p = makeProjectiles(e);
+    std::vector<DamageHit> hits;
+    // Tests d'impact sur des positions que move/integrate ne touchent pas :
+    // sinon les projectiles finissent par toucher et le lot rétrécit
+    const EnemyStore      hitEnemies     = makeEnemies();
+    const ProjectileStore hitProjectiles = makeProjectiles(hitEnemies);
+
+    for (int lv = 0; lv <= static_cast<int>(detectSimd()); ++lv) {
+        const SimdKernels& k    = simdKernels(static_cast<SimdLevel>(lv));
+        const std::string  name = simdName(k.level);
+
+        BENCHMARK("move 100000: " + name) {
+            k.moveAlongPath(e, path, kDt, nullptr);
+            return e.posX[0];
+        };
+        BENCHMARK("integrate 100000: " + name) {
+            k.integrate(p.posX.data(), p.posY.data(), p.velX.data(), p.velY.data(), p.ttl.data(), p.size(), kDt);
+            return p.posX[0];
+        };
+        BENCHMARK_ADVANCED("hits 100000: " + name)(Catch::Benchmark::Chronometer meter) {
+            // Une copie par mesure : chacune part des kCount projectiles
+            std::vector<ProjectileStore> runs(static_cast<std::size_t>(meter.runs()), hitProjectiles);
+            meter.measure([&](int r) {
+                hits.clear();
+                k.resolveHits(runs[static_cast<std::size_t>(r)], hitEnemies, 0.01f, hits);
+                return hits.size();
+            });
+            REQUIRE(hits.empty());
+            REQUIRE(runs.back().size() == kCount);
+        };
+    }
+
+    for (int lv = 0; lv <= static_cast<int>(detectSimd()); ++lv) {
+        const SimdKernels& k = simdKernels(static_cast<SimdLevel>(lv));
+        const double move = entitiesPerNs([&] {
+            k.moveAlongPath(e, path, kDt, nullptr);
+            return e.size();
+        });
+        const double integ = entitiesPerNs([&] {
+            k.integrate(p.posX.data(), p.posY.data(), p.velX.data(), p.velY.data(), p.ttl.data(), p.size(), kDt);
+            return p.size();
+        });
+        ProjectileStore hp = hitProjectiles;
+        const double hit = entitiesPerNs([&] {
+            const std::size_t n = hp.size();
+            hits.clear();
+            k.resolveHits(hp, hitEnemies, 0.01f, hits);
+            return n;
+        });
+        std::cout << "[Simd] " << simdName(k.level) << ": move " << move << ", integrate " << integ
+                  << ", hits " << hit << " entities/ns\n";
+    }
+}
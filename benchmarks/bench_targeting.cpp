@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdint>
+
+#include "sim/SpatialGrid.hpp"
+
+// Acquisition de cible : grille (reconstruction + requêtes) vs balayage
+// O(tours x ennemis). Carte 256x256, portées 2..6 cases.
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+float frand(std::uint32_t& s, float max) { return static_cast<float>(lcg(s) % 100000u) / 100000.f * max; }
+
+constexpr float kWorld = 256.f;
+
+void populate(EnemyStore& e, TowerStore& t, std::size_t enemies, std::size_t towers) {
+    std::uint32_t s = 7u;
+    e.reserve(enemies);
+    for (std::size_t i = 0; i < enemies; ++i) {
+        const Handle h = e.spawn(EnemySpawn{frand(s, kWorld), frand(s, kWorld), 10.f + frand(s, 90.f), 1.f, 1, 0});
+        e.progress[e.ids.denseIndex(h)] = frand(s, 500.f);
+    }
+    for (std::size_t i = 0; i < towers; ++i) {
+        t.build(TowerSpec{frand(s, kWorld), frand(s, kWorld), 2.f + frand(s, 4.f), 10.f, 1.f,
+                          static_cast<TargetMode>(i % 3)});
+    }
+}
+
+} // namespace
+
+TEST_CASE("Tower targeting 500 towers x 20k enemies", "[!benchmark][targeting]") {
+    EnemyStore e;
+    TowerStore t;
+    populate(e, t, 20'000, 500);
+
+    SpatialGrid grid;
+    grid.configure(kWorld, kWorld, 4.f);
+
+    BENCHMARK("grid rebuild") {
+        grid.rebuild(e);
+        return grid.size();
+    };
+    BENCHMARK("grid rebuild + acquire") {
+        grid.rebuild(e);
+        acquireTargets(t, e, grid);
+        return t.target[0].index;
+    };
+    BENCHMARK("brute force acquire") {
+        acquireTargetsBruteForce(t, e);
+        return t.target[0].index;
+    };
+}
@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+#include <vector>
+
+#include "UiTree.hpp"
+
+// Mise en page du menu sur l'arbre d'interface, sans fenêtre ni contexte
+// GL : rien n'est dessiné, le lot est vidé par record(). Les libellés sont
+// absents (leurs glyphes vivent dans une texture, donc sur le GPU) : on
+// mesure la pose des nœuds, leur reconstruction et le rejeu du cache.
+
+namespace {
+
+// Même squelette que Menu : fond, cadre, 3 boutons, engrenage, panneau
+// Options avec 2 sliders ; rows lignes en plus pour voir l'échelle
+struct MenuSkeleton {
+    UiTree                 tree;
+    std::vector<UiNode*>   nodes;
+    std::vector<UiSlider*> sliders;
+
+    explicit MenuSkeleton(int rows) {
+        UiNode& root = tree.root();
+        nodes.push_back(&root.add<UiImage>(0, sf::Color(18, 20, 28)));
+        nodes.push_back(&root.add<UiPanel>(10, sf::Color(0, 0, 0, 90)));
+        nodes.push_back(&root.add<UiImage>(11, sf::Color(30, 34, 46)));
+        nodes.push_back(&root.add<UiPanel>(12, sf::Color(40, 46, 62)));
+        nodes.push_back(&root.add<UiPanel>(13, sf::Color(255, 255, 255, 12)));
+        for (int i = 0; i < 3 + rows; ++i) nodes.push_back(&root.add<UiPanel>(20, sf::Color(40, 90, 170)));
+        nodes.push_back(&root.add<UiPanel>(30, sf::Color(50, 56, 74), UiPanel::Shape::Circle));
+        UiNode& options = root.add<UiNode>();
+        nodes.push_back(&options.add<UiPanel>(40, sf::Color(0, 0, 0, 120)));
+        nodes.push_back(&options.add<UiPanel>(41, sf::Color(24, 28, 38)));
+        for (int i = 0; i < 2; ++i) {
+            sliders.push_back(&options.add<UiSlider>(42));
+            nodes.push_back(sliders.back());
+        }
+    }
+
+    // Équivalent de Menu::positionElements : tout dépend de la vue
+    void layout(sf::Vector2f view) {
+        const sf::Vector2f card{720.f, 360.f};
+        const sf::Vector2f cardPos{(view.x - card.x) * 0.5f, (view.y - card.y) * 0.5f};
+        float y = cardPos.y + 120.f;
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            UiNode& n = *nodes[i];
+            if (i == 0)      { n.setPosition({0.f, 0.f}); n.setSize(view); }
+            else if (i < 5)  { n.setPosition(cardPos + sf::Vector2f{i == 1 ? 8.f : 0.f, i == 1 ? 12.f : 0.f}); n.setSize(card); }
+            else             { n.setPosition({cardPos.x + 60.f, y}); n.setSize({card.x - 120.f, 48.f}); y += 56.f; }
+        }
+    }
+};
+
+} // namespace
+
+TEST_CASE("Menu layout on the widget tree", "[!benchmark][menu]") {
+    for (int rows : {0, 200}) {
+        MenuSkeleton menu(rows);
+        SpriteBatch batch;
+        SpriteBatch::Recording sink;
+        const std::string tag = std::to_string(menu.nodes.size()) + " nodes";
+        menu.layout({1920.f, 1080.f});
+        menu.tree.draw(batch);
+        batch.record(sink);
+
+        bool wide = false;
+        BENCHMARK("relayout + rebuild all, " + tag) {
+            wide = !wide;
+            menu.layout(wide ? sf::Vector2f{2560.f, 1440.f} : sf::Vector2f{1920.f, 1080.f});
+            menu.tree.draw(batch);
+            batch.record(sink);
+            return menu.tree.takeRebuilds();
+        };
+        BENCHMARK("idle frame (replay), " + tag) {
+            menu.tree.draw(batch);
+            batch.record(sink);
+            return menu.tree.takeRebuilds();
+        };
+        float v = 0.f;
+        BENCHMARK("slider drag (1 rebuild), " + tag) {
+            v = v < 1.f ? v + 0.01f : 0.f;
+            menu.sliders[0]->setValue(v);
+            menu.tree.draw(batch);
+            batch.record(sink);
+            return menu.tree.takeRebuilds();
+        };
+    }
+}
@@ -1,11 +1,28 @@
 #pragma once
+#include <array>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 
+#include "AssetCache.hpp"
+#include "AssetLoader.hpp"
+#include "Battlefield.hpp"
+#include "Input.hpp"
+#include "LocalScores.hpp"
+#include "ScoreClient.hpp"
+#include "ShaderManager.hpp"
+#include "SpriteBatch.hpp"
+#include "TextCache.hpp"
+#include "sim/ConfigBlob.hpp"
+#include "sim/JobSystem.hpp"
+#include "sim/Replay.hpp"
+
 class Menu;
+class ProfilerOverlay;
 
 class App {
 public:
@@ -19,22 +36,99 @@ public:
     App& operator=(const App&) = delete;
 
 private:
+    // Démarrage (avant la fenêtre) : mesure du temps jusqu'à la première frame
+    std::chrono::steady_clock::time_point startTime_ = std::chrono::steady_clock::now();
+    bool firstFrameLogged_  = false;
+    bool assetsReadyLogged_ = false;
+    double msSinceStart() const;
+
     // Fenêtre plein écran, non redimensionnable
     sf::RenderWindow window_;
 
     enum class State { Menu, Playing, Exiting };
     State state_{State::Menu};
+    void enterState(State s);
 
+    TextSystem            text_;    // mises en page de texte partagées par les écrans
+    ShaderManager         shaders_; // compilés une fois au démarrage, partagés
     std::unique_ptr<Menu> menu_;
 
+    // Profilage : overlay F3, capture F4 ; TD_TRACE=chemin trace tout le
+    // lancement (chargement compris) et l'écrit à la fermeture
+    std::unique_ptr<ProfilerOverlay> profiler_;
+    std::string                      tracePath_;
+
+    // Étage d'entrée unique (un seul pollEvent par frame)
+    InputSystem   input_;
+    int           stateSub_    = 0;     // abonnement de l'état courant
+    bool          backToMenu_  = false; // demandé par Escape en jeu
+    std::uint64_t frame_       = 0;
+
+    // Boucle à pas fixe : la simulation avance toujours de kSimDt, le rendu
+    // interpole entre les deux derniers ticks (indépendant des Hz de l'écran).
+    static constexpr float kSimHz           = 120.f;
+    static constexpr float kSimDt           = 1.f / kSimHz;
+    static constexpr int   kMaxCatchUpSteps = 8;     // ticks max rattrapés par frame
+    static constexpr float kMaxFrameTime    = 0.25f; // borne après un gel (drag, breakpoint...)
+    static_assert(static_cast<int>(kSimHz) == Game::kTickHz, "un tick App = un tick de simulation");
+
+    // Threads de la simulation et de la préparation du rendu (TD_JOBS=n,
+    // un par cœur par défaut) ; déclaré avant la partie qui s'en sert
+    JobSystem jobs_;
+
+    // Partie en cours (lockstep) et journal d'entrées rejouable, gardé en
+    // mémoire puis écrit en fin de partie par le thread de leaderboard_
+    std::unique_ptr<Game>         game_;
+    ReplayLog                     replay_;
+    bool                          recording_ = false;
+    void closeReplay();
+    std::vector<DifficultyParams> difficulties_;
+    GameRules                     rules_;
+    // Config compilée (cible `config`) rechargée à chaud : lue par le
+    // watcher en fond, appliquée entre deux ticks
+    std::unique_ptr<ConfigWatcher> configWatcher_;
+    void loadConfig();
+    void applyConfigReload();
+    // Classement local (journal en ajout seul, compacté au-delà de kKeepScores
+    // par difficulté), écrit par son propre thread
+    static constexpr std::size_t  kKeepScores = 1000;
+    LocalScores                   leaderboard_{kKeepScores};
+    std::unique_ptr<ScoreClient>  online_; // serveur de classement, jamais attendu
+    // Carte tirée (ou relue du cache) par le loader : la partie commence
+    // à son arrivée, la frame ne l'attend pas
+    bool gameLoading_ = false;
+    void startGame();
+    void beginGame(const GameSetup& setup, const GridMap& map);
+    void endGame();
+
+    // Rendu par lots (un flush par frame) et compteurs par état
+    struct RenderTotals {
+        std::uint64_t frames = 0, drawCalls = 0, vertices = 0;
+        std::uint64_t relayouts = 0, layoutHits = 0;
+        std::uint64_t uiRebuilds = 0;
+        std::uint64_t shaderBinds = 0, uniformUploads = 0;
+    };
+    SpriteBatch                 batch_;
+    Battlefield                 battlefield_;
+    std::array<RenderTotals, 2> renderTotals_{};
+    static constexpr int        kLoadingLayer = 1000; // au-dessus de tout
+
     // Boucles de jeu
     void processEvents();
     void update(float dt);
-    void render();
+    void render(float alpha);
 
     // --- AUDIO (boucle continue tant que le jeu est ouvert)
-    sf::Music musicMenu_;
-    sf::Music musicGame_;
+    AssetCache::MusicHandle musicMenu_; // nullptr tant qu'elle n'est pas ouverte
+    AssetCache::MusicHandle musicGame_;
     void startMenuMusic();
     void startGameMusic();
+
+    // Cache d'assets (budget : TD_ASSET_BUDGET_MB, 256 Mo par défaut) et
+    // chargement en arrière-plan ; le loader est déclaré en dernier pour être
+    // détruit (threads joints) avant les objets que ses tâches remplissent
+    static constexpr double      kLoadBudgetMs      = 4.0; // uploads GPU max par frame
+    static constexpr std::size_t kDefaultAssetBudget = std::size_t{256} << 20;
+    AssetCache  assets_;
+    AssetLoader loader_;
 };
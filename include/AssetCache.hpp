@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+
+#include "AssetLoader.hpp"
+#include "AssetTable.hpp"
+#include "sim/FontSubset.hpp"
+
+// Cache central des assets : un fichier n'est lu, décodé et envoyé au GPU
+// qu'une fois, quel que soit l'écran qui le demande. Les chemins sont
+// relatifs à la racine assets/ (ou absolus, ex. pages d'atlas générées) et
+// normalisés ; deux fichiers au contenu identique partagent le même objet.
+// Les handles sont partagés : un asset reste chargé tant qu'on en tient un,
+// puis devient évinçable quand le budget mémoire est dépassé.
+//
+// Les chargements passent par l'AssetLoader : les callbacks sont appelés
+// sur le thread de rendu (tout de suite si l'asset est déjà là).
+class AssetCache {
+public:
+    using TextureHandle = std::shared_ptr<const sf::Texture>;
+    using FontHandle    = std::shared_ptr<const sf::Font>;
+    using MusicHandle   = std::shared_ptr<sf::Music>;
+
+    AssetCache(AssetLoader& loader, std::size_t budgetBytes);
+
+    // Chemin disque normalisé (clé du cache)
+    std::string resolve(const std::string& path) const;
+
+    void requestTexture(const std::string& path, std::function<void(TextureHandle)> onReady);
+    void requestFont(const std::string& path, std::function<void(FontHandle)> onReady);
+    // Paquet de polices réduites (td_font_pack) : les polices qu'il contient
+    // sont lues depuis le paquet, les autres depuis leur fichier. false si
+    // absent ou illisible (les fichiers d'origine restent utilisés).
+    bool mountFontBundle(const std::string& path);
+    // Musique en streaming : dédoublonnée par chemin, pas d'octets résidents
+    void requestMusic(const std::string& path, std::function<void(MusicHandle)> onReady);
+
+    void        setBudget(std::size_t bytes) { budget_ = bytes; trim(); }
+    std::size_t budget() const { return budget_; }
+    std::size_t residentBytes() const;
+    // Évince les assets inutilisés tant que le budget est dépassé
+    void trim();
+    // Appelé pour chaque police évincée, encore vivante : les caches indexés
+    // par son adresse (TextSystem::clearFont) l'oublient avant qu'une autre
+    // police puisse la reprendre
+    void setFontEvicted(std::function<void(const sf::Font*)> onEvicted) { fontEvicted_ = std::move(onEvicted); }
+
+    // Une ligne par type : hits, misses, dédoublonnages, évictions, Mo résidents
+    void dumpStats(std::ostream& os) const;
+
+private:
+    struct FontAsset {
+        std::vector<char> bytes; // gardés par sf::Font
+        sf::Font          font;
+    };
+
+    AssetLoader& loader_;
+    std::size_t  budget_;
+    std::string  root_;
+    std::uint64_t clock_ = 0; // ancienneté (LRU)
+
+    // Entrées du paquet de polices, par clé (chemin résolu)
+    std::string                                      fontBundle_;
+    std::unordered_map<std::string, FontBundleEntry> bundledFonts_;
+
+    AssetTable<const sf::Texture> textures_;
+    AssetTable<const FontAsset>   fonts_;
+    AssetTable<sf::Music>         music_;
+    std::function<void(const sf::Font*)> fontEvicted_;
+
+    // Chargements en cours : callbacks en attente par clé
+    std::unordered_map<std::string, std::vector<std::function<void(TextureHandle)>>> pendingTex_;
+    std::unordered_map<std::string, std::vector<std::function<void(FontHandle)>>>    pendingFont_;
+    std::unordered_map<std::string, std::vector<std::function<void(MusicHandle)>>>   pendingMusic_;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Chargement d'assets en arrière-plan : `work` (lecture disque, décodage
+// PNG/police, parsing) tourne sur un thread de travail ; `finish` (upload
+// GPU, création des objets SFML) est exécuté par pump() sur le thread de
+// rendu, qui seul possède le contexte OpenGL.
+class AssetLoader {
+public:
+    explicit AssetLoader(unsigned workers = 2);
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // work peut être vide : finish seul, au prochain pump (ex. compilation de shader)
+    void submit(std::function<void()> work, std::function<void()> finish);
+
+    // Exécute les finish prêts pendant au plus budgetMs (au moins un), pour
+    // ne pas bloquer la frame. Retourne le nombre exécutés.
+    std::size_t pump(double budgetMs);
+
+    std::size_t total()     const { return total_; }
+    std::size_t completed() const { return completed_; }
+    float progress() const { return total_ ? static_cast<float>(completed_) / static_cast<float>(total_) : 1.f; }
+    bool  idle()     const { return completed_ == total_; }
+
+private:
+    struct Job {
+        std::function<void()> work, finish;
+    };
+
+    std::vector<std::thread> threads_;
+    std::mutex               mutex_;
+    std::condition_variable  cv_;
+    std::deque<Job>          queue_;  // à décoder
+    std::deque<Job>          ready_;  // décodés, finish à faire sur le thread de rendu
+    bool                     stop_ = false;
+
+    // Compteurs du thread de rendu
+    std::size_t total_     = 0;
+    std::size_t completed_ = 0;
+
+    void workerLoop();
+};
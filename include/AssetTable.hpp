@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Table d'un type d'asset pour AssetCache (sans SFML, testable seule) :
+// clé (chemin canonique) -> emplacement, dédoublonné par empreinte du
+// contenu. Le cache garde une référence ; un asset est "inutilisé" quand
+// plus personne d'autre n'en tient un handle, et seuls ceux-là sont évincés
+// (le plus anciennement utilisé d'abord).
+template <class T>
+class AssetTable {
+public:
+    using Handle = std::shared_ptr<T>;
+
+    struct Stats {
+        std::uint64_t hits = 0, misses = 0, dedups = 0, evictions = 0;
+        std::size_t   resident = 0;  // assets en mémoire
+        std::size_t   bytes    = 0;  // octets estimés
+    };
+
+    // Handle si présent (compte un hit, rafraîchit l'ancienneté), sinon nullptr (un miss)
+    Handle acquire(const std::string& key, std::uint64_t now) {
+        auto k = keys_.find(key);
+        if (k == keys_.end()) { ++stats_.misses; return nullptr; }
+        Slot& s = slots_.at(k->second);
+        s.lastUse = now;
+        ++stats_.hits;
+        return s.value;
+    }
+    // Requête servie par un chargement déjà en cours : ni lu ni décodé deux fois
+    void countPendingHit() { ++stats_.hits; }
+
+    // Contenu identique déjà présent sous une autre clé : la clé y est
+    // rattachée et ce handle est retourné (le nouvel objet est abandonné)
+    Handle findContent(const std::string& key, std::uint64_t contentHash, std::uint64_t now) {
+        auto it = slots_.find(contentHash);
+        if (it == slots_.end()) return nullptr;
+        link(key, it->second, contentHash);
+        it->second.lastUse = now;
+        ++stats_.dedups;
+        return it->second.value;
+    }
+
+    Handle insert(const std::string& key, std::uint64_t contentHash, Handle value,
+                  std::size_t bytes, std::uint64_t now) {
+        if (Handle existing = findContent(key, contentHash, now)) return existing;
+        Slot& s = slots_[contentHash];
+        s.value   = std::move(value);
+        s.bytes   = bytes;
+        s.lastUse = now;
+        link(key, s, contentHash);
+        ++stats_.resident;
+        stats_.bytes += bytes;
+        return s.value;
+    }
+
+    // Ancienneté du plus vieil asset inutilisé (UINT64_MAX si aucun)
+    std::uint64_t oldestUnused() const {
+        std::uint64_t oldest = UINT64_MAX;
+        for (const auto& [hash, s] : slots_) {
+            if (s.value.use_count() == 1 && s.lastUse < oldest) oldest = s.lastUse;
+        }
+        return oldest;
+    }
+
+    // evicted : reçoit l'asset retiré (encore vivant tant qu'on le tient)
+    bool evictOldestUnused(Handle* evicted = nullptr) {
+        auto victim = slots_.end();
+        for (auto it = slots_.begin(); it != slots_.end(); ++it) {
+            if (it->second.value.use_count() != 1) continue;
+            if (victim == slots_.end() || it->second.lastUse < victim->second.lastUse) victim = it;
+        }
+        if (victim == slots_.end()) return false;
+        for (const auto& k : victim->second.keys) keys_.erase(k);
+        stats_.bytes -= victim->second.bytes;
+        --stats_.resident;
+        ++stats_.evictions;
+        if (evicted) *evicted = std::move(victim->second.value);
+        slots_.erase(victim);
+        return true;
+    }
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    struct Slot {
+        Handle                   value;
+        std::size_t              bytes   = 0;
+        std::uint64_t            lastUse = 0;
+        std::vector<std::string> keys;   // chemins qui y mènent
+    };
+
+    std::unordered_map<std::uint64_t, Slot>        slots_; // par empreinte du contenu
+    std::unordered_map<std::string, std::uint64_t> keys_;  // chemin -> empreinte
+    Stats stats_;
+
+    void link(const std::string& key, Slot& s, std::uint64_t hash) {
+        if (keys_.emplace(key, hash).second) s.keys.push_back(key);
+    }
+};
@@ -0,0 +1,23 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+#include "SpriteBatch.hpp"
+#include "sim/Game.hpp"
+
+class JobSystem;
+
+// Vue du champ de bataille : carte, tours, ennemis et projectiles d'une
+// Game, soumis au SpriteBatch de l'App. Tout est en quads unis : même avec
+// 10k ennemis la frame part en un ou deux draws.
+class Battlefield {
+public:
+    // alpha = fraction du tick suivant déjà écoulée (positions extrapolées
+    // depuis la vitesse, comme l'interpolation du menu). Avec un JobSystem,
+    // les quads du sol, des ennemis et des projectiles sont écrits en
+    // parallèle dans des plages réservées du lot (même contenu qu'en série).
+    void render(SpriteBatch& batch, const Game& game, sf::Vector2u viewSize, float alpha,
+                JobSystem* jobs = nullptr) const;
+
+private:
+    enum Layer : int { kGround = 100, kTowers, kEnemies, kProjectiles };
+};
@@ -0,0 +1,105 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <SFML/Window.hpp>
+
+// Événement capturé par l'étage d'entrée : horodaté (µs depuis le lancement)
+// et numéroté avec la frame pendant laquelle il a été lu.
+struct InputEvent {
+    sf::Event     event;
+    std::int64_t  timeUs = 0;
+    std::uint64_t frame  = 0;
+};
+
+// File circulaire de capacité fixe (pas d'allocation pendant le jeu).
+// Quand elle est pleine, l'événement est perdu et compté.
+class InputQueue {
+public:
+    static constexpr std::size_t kCapacity = 64;
+
+    bool push(const InputEvent& e);
+    std::optional<InputEvent> pop();
+
+    // Remplace le dernier événement s'il est du même type "continu"
+    // (MouseMoved) : seul le plus récent est utile.
+    bool coalesceBack(const InputEvent& e);
+
+    std::size_t size()  const { return count_; }
+    bool        empty() const { return count_ == 0; }
+
+private:
+    std::array<std::optional<InputEvent>, kCapacity> ring_{};
+    std::size_t head_  = 0;
+    std::size_t count_ = 0;
+};
+
+// Compteurs de debug, un jeu par contexte (état de l'App)
+struct InputStats {
+    std::uint64_t received   = 0; // lus depuis l'OS
+    std::uint64_t coalesced  = 0; // MouseMoved fusionnés
+    std::uint64_t dropped    = 0; // perdus (file pleine)
+    std::uint64_t unhandled  = 0; // aucun abonné ne les a consommés
+    std::uint64_t late       = 0; // latence input→photon > kLateThresholdUs
+    std::uint64_t presented  = 0; // événements dont la frame a été affichée
+    std::int64_t  latencySumUs = 0;
+    std::int64_t  latencyMaxUs = 0;
+
+    double avgLatencyMs() const {
+        return presented ? static_cast<double>(latencySumUs) / presented / 1000.0 : 0.0;
+    }
+};
+
+// Étage d'entrée unique : un seul pollEvent par frame, puis distribution
+// de la file aux abonnés (système, overlays, état courant) par priorité.
+class InputSystem {
+public:
+    // Ordre de distribution : plus petit = servi en premier
+    enum class Layer : int { System = 0, Overlay = 1, State = 2 };
+
+    // Retourne true si l'événement est consommé (les couches suivantes ne le voient pas)
+    using Handler = std::function<bool(const InputEvent&)>;
+
+    static constexpr int          kMaxContexts     = 4;
+    static constexpr std::int64_t kLateThresholdUs = 33'000; // ~2 frames à 60 Hz
+
+    int  subscribe(Layer layer, Handler handler);
+    void unsubscribe(int id);
+
+    // Contexte courant (index d'état) pour ventiler les statistiques
+    void setContext(int ctx);
+
+    // 1) vide la file de l'OS dans la file interne
+    void pump(sf::Window& window, std::uint64_t frame);
+    // 2) distribue la file interne aux abonnés
+    void dispatch();
+    // 3) à appeler juste après display() : mesure input→photon
+    void onFramePresented();
+
+    const InputStats& stats(int ctx) const { return stats_[static_cast<std::size_t>(ctx)]; }
+
+private:
+    struct Subscriber {
+        int     id;
+        Layer   layer;
+        Handler handler;
+    };
+
+    sf::Clock               clock_;
+    InputQueue              queue_;
+    std::vector<Subscriber> subscribers_;
+    std::vector<Subscriber> pendingSubs_; // abonnements faits pendant dispatch()
+    bool                    dispatching_ = false;
+    int                     nextId_  = 1;
+    int                     context_ = 0;
+
+    std::array<InputStats, kMaxContexts> stats_{};
+    std::vector<std::int64_t>            awaitingPresent_; // timestamps distribués cette frame
+
+    InputStats& cur() { return stats_[static_cast<std::size_t>(context_)]; }
+    void mergePending();
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "sim/Leaderboard.hpp"
+#include "sim/Replay.hpp"
+
+// Classement local tenu par un thread à part : open() et submit() mettent
+// en file et rendent la main, le disque (relecture du journal, migration,
+// écritures vidées, compaction) ne passe jamais par la frame. Le replay de
+// fin de partie passe par le même thread. Une tâche à la fois, dans l'ordre
+// de soumission. Le destructeur finit la file : un score ou un replay
+// enregistré juste avant de quitter n'est pas perdu.
+class LocalScores {
+public:
+    explicit LocalScores(std::size_t keepPerDifficulty);
+    ~LocalScores();
+
+    LocalScores(const LocalScores&)            = delete;
+    LocalScores& operator=(const LocalScores&) = delete;
+
+    // Ouvre le journal ; s'il est vide, reprend l'ancien scores.json (migrateFrom)
+    void open(std::string path, std::string migrateFrom);
+    // Écrit le score puis affiche son rang
+    void submit(ScoreEntry e);
+    // Écrit le replay (dossier créé au besoin)
+    void saveReplay(std::string path, ReplayLog log);
+
+private:
+    Leaderboard board_; // thread de travail seul
+
+    std::mutex                        mutex_;
+    std::condition_variable           wake_;
+    std::deque<std::function<void()>> queue_;
+    bool                              stop_ = false;
+    std::thread                       thread_; // démarré en dernier
+
+    void push(std::function<void()> task);
+    void run();
+};
@@ -8,49 +8,52 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 
+#include "AssetCache.hpp"
+#include "SpriteBatch.hpp"
+#include "TextCache.hpp"
+#include "TextureAtlas.hpp"
+#include "UiTree.hpp"
+
 struct MenuChoice {
     bool start          = false;
     bool openDifficulty = false;
     bool exit           = false;
 };
 
+// Slider : nœud affiché + état de drag
 struct Slider {
-    sf::Vector2f pos{0.f, 0.f};
-    sf::Vector2f size{280.f, 10.f};
-    float value01 = 0.8f;   // 0..1
-    bool  dragging = false;
+    UiSlider* node     = nullptr;
+    bool      dragging = false;
 };
 
 struct MenuButton {
     std::string id;
+    UiButton*   node = nullptr; // fond, libellé, icône
 
-    sf::Vector2f pos{0.f, 0.f};   // position logique (coin haut-gauche)
-    sf::Vector2f size{360.f, 56.f};
-
-    // animation / interaction
+    // animation / interaction (prev* = état du tick précédent, pour l'interpolation)
     float scale       = 1.f;
     float targetScale = 1.f;
     float hover       = 0.f; // 0..1
+    float prevScale   = 1.f;
+    float prevHover   = 0.f;
     bool  hovered     = false;
     bool  focused     = false;
-
-    // couleurs base / hover
-    sf::Color fillA{}, fillB{}, border{};
-    sf::Color hoverFillA{}, hoverFillB{}, hoverBorder{};
-
-    std::unique_ptr<sf::Text>   label;
-    std::unique_ptr<sf::Sprite> icon;
-
-    bool hasIcon() const { return icon != nullptr; }
 };
 
 class Menu {
 public:
-    explicit Menu(sf::RenderWindow& win);
-
-    // Tick = events + update + draw (ne fait PAS display/clear)
-    std::optional<MenuChoice> tick();
-    void render(); // alias draw()
+    // Les assets sont demandés au cache ; le menu est dessinable tout de suite
+    Menu(sf::RenderWindow& win, AssetCache& assets, ShaderManager& shaders, TextSystem& text);
+
+    // Events : reçus de l'étage d'entrée de l'App (true = consommé)
+    bool handleEvent(const sf::Event& ev);
+    // Choix produit par les events de la frame (consommé à la lecture)
+    std::optional<MenuChoice> takeChoice();
+    // Update = animations, à pas fixe (dt en secondes)
+    void update(float dt);
+    // Render = dessin interpolé entre les deux derniers ticks, soumis au lot
+    // de l'App (ne fait PAS flush/display/clear)
+    void render(SpriteBatch& batch, float alpha = 1.f);
 
     // Accès aux sliders pour l’audio global
     float musicVolume01() const { return musicVol01_; }
@@ -59,74 +62,95 @@ public:
     // Optionnel : sous-titre de la difficulté
     void setDifficultySubtitle(const std::string& text);
 
+    // Nœuds d'interface reconstruits depuis le dernier appel (menu immobile :
+    // seulement le titre qui pulse)
+    std::uint64_t takeUiRebuilds() { return ui_.takeRebuilds(); }
+
 private:
     // --- Référence fenêtre
     sf::RenderWindow& win_;
+    TextSystem&       text_;
+
+    std::optional<MenuChoice> pendingChoice_;
 
     // --- Ressources
-    sf::Font   font_;
-    sf::Texture icoStart_, icoGear_, icoExit_;
-    sf::Texture texBg_, texCardBg_, texBtn_;
-
-    std::unique_ptr<sf::Sprite> bg_;
-    std::unique_ptr<sf::Sprite> cardBg_;
-    std::unique_ptr<sf::Sprite> gearIcon_;
-
-    // --- Shaders
-    sf::Shader panelShader_;
-    sf::Shader buttonShader_;
-    bool shaderOk_    = false;
-    bool btnShaderOk_ = false;
-    float animTime_   = 0.f;
-    sf::Clock animClock_;
+    AssetCache::FontHandle font_;   // nullptr tant que la police n'est pas arrivée
+    sf::Font               noFont_; // police vide pour créer les textes en attendant
+    const sf::Font& currentFont() const { return font_ ? *font_ : noFont_; }
+    TextureAtlas atlas_;
+
+    // --- Shaders (partagés, compilés au démarrage) : paramètres du cadre et
+    //     tableaux par bouton, envoyés seulement s'ils changent
+    ShaderProgram& panelShader_;
+    struct PanelUniforms {
+        int size, radius, innerA, innerB, shadowCol, borderCol, time, fillAlpha;
+    } panelU_{};
+    UiButtonShader buttonShader_;
+    float animTime_     = 0.f;
+    float prevAnimTime_ = 0.f;
+    float animT_        = 0.f; // temps interpolé de la frame, lu par les shaders au flush
+
+    // --- Arbre d'interface : géométrie en cache, reconstruite nœud par nœud
+    //     quand un setter change une valeur (les pointeurs sont à l'arbre)
+    UiTree ui_;
 
     // --- Mise en page principale (card)
     sf::Vector2f cardPos_{0.f, 0.f};
     sf::Vector2f cardSize_{720.f, 360.f};
     float        cornerRadius_ = 18.f;
 
-    // Ombre sous le card
-    sf::RectangleShape dropShadow_;
+    UiImage* bg_         = nullptr; // fond d'écran (cover), uni en attendant
+    UiPanel* dropShadow_ = nullptr; // ombre sous le card
+    UiImage* cardBg_     = nullptr; // image du cadre
+    UiPanel* card_       = nullptr; // overlay shader du cadre
+    UiPanel* soft_       = nullptr; // voile sur le cadre
 
     // Titre
-    std::unique_ptr<sf::Text> title_;
-    std::unique_ptr<sf::Text> titleShadow_;
-    float titlePulseT_ = 0.f;
+    UiLabel* title_       = nullptr;
+    UiLabel* titleShadow_ = nullptr;
+    float titlePulseT_     = 0.f;
+    float prevTitlePulseT_ = 0.f;
 
     // --- Boutons
     std::vector<MenuButton> buttons_;
     float btnRadius_ = 14.f;
     int   focusIndex_ = 0;
 
-    // --- Bouton "Settings" (cercle en bas à droite)
-    sf::CircleShape gearButton_;
+    // --- Bouton "Settings" (cercle en haut à droite du cadre)
+    static constexpr float kGearRadius = 26.f;
+    UiPanel* gear_     = nullptr;
+    UiImage* gearIcon_ = nullptr;
     bool optionsOpen_ = false;
     bool gearHover_   = false;
+    sf::Vector2f gearCenter() const;
 
     // --- Panneau Options
     sf::Vector2f optPos_{0.f, 0.f};
     sf::Vector2f optSize_{420.f, 180.f};
-    sf::RectangleShape optShadow_;
-    std::unique_ptr<sf::Text> optTitle_;
-    std::unique_ptr<sf::Text> lblMusic_, lblSfx_;
-    std::unique_ptr<sf::Text> pctMusic_, pctSfx_;
+    UiNode*  options_   = nullptr; // masqué si fermé
+    UiPanel* optShadow_ = nullptr;
+    UiPanel* optFrame_  = nullptr;
+    UiLabel* optTitle_  = nullptr;
+    UiLabel* lblMusic_  = nullptr;
+    UiLabel* lblSfx_    = nullptr;
+    UiLabel* pctMusic_  = nullptr;
+    UiLabel* pctSfx_    = nullptr;
     Slider sliderMusic_, sliderSfx_;
     float  musicVol01_ = 0.8f;
     float  sfxVol01_   = 0.8f;
 
     // --- Construction
-    void loadAssets();
+    void loadAssets(AssetCache& assets, ShaderManager& shaders);
     void buildLayout();
     void buildSettings();
     void positionElements();
     void positionSettings();
 
     // --- Interaction
-    void updateHoverFocus(const sf::Vector2f& mouse);
+    void updateHoverFocus(const sf::Vector2f& mouse, float dt);
 
     // --- Dessin
-    void draw();
-    void drawSettings();
+    void draw(SpriteBatch& batch, float alpha);
 
     // --- Utils
     static float clamp01(float v) {
@@ -134,8 +158,9 @@ private:
         if (v > 1.f) return 1.f;
         return v;
     }
-    bool loadFont(const std::string& path);
-    bool loadTexture(sf::Texture& t, const std::string& path);
+    static float lerp(float a, float b, float t) { return a + (b - a) * t; }
+
+    static void setPercent(UiLabel& label, float v01);
 
     bool hitCircle(const sf::Vector2f& p, const sf::Vector2f& c, float r) const;
 };
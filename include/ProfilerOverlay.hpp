@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "AssetCache.hpp"
+#include "SpriteBatch.hpp"
+#include "TextCache.hpp"
+#include "sim/Profiler.hpp"
+
+// Overlay de profilage (F3) : temps de frame, graphe des frames avec leur
+// 99e centile glissant, portées PROFILE_SCOPE les plus coûteuses par frame.
+// F4 démarre une capture (profileur seul, sans overlay) puis l'écrit en
+// trace Chrome dans profiles/ au second appui.
+class ProfilerOverlay {
+public:
+    static constexpr std::size_t kTopScopes = 8;
+
+    ProfilerOverlay(AssetCache& assets, TextSystem& text);
+
+    // F3 / F4 (true = consommé)
+    bool handleEvent(const sf::Event& ev);
+    // Durée de la frame écoulée, une fois par frame
+    void frame(float ms);
+    // Soumis au lot de l'App, au-dessus de tout (rien si masqué)
+    void render(SpriteBatch& batch, sf::Vector2f view);
+
+    bool visible() const { return visible_; }
+    // Profileur actif sans overlay (capture écrite par l'appelant)
+    void startCapture() { capturing_ = true; updateEnabled(); }
+
+private:
+    static constexpr int          kLayer     = 1100;       // au-dessus de la barre de chargement
+    static constexpr std::int64_t kRefreshNs = 500'000'000; // texte et portées : 2 fois/s
+    static constexpr float        kGraphMs   = 50.f;       // haut du graphe
+
+    TextSystem&            text_;
+    AssetCache::FontHandle font_;
+    sf::Font               noFont_;
+
+    bool visible_   = false;
+    bool capturing_ = false;
+    void updateEnabled() { Profiler::setEnabled(visible_ || capturing_); }
+    void writeCapture();
+
+    FrameTimes             times_;
+    std::vector<ScopeStat> top_;
+    std::int64_t           lastRefreshNs_    = 0;
+    std::uint32_t          framesSinceRefresh_ = 0;
+    void refresh();
+
+    std::unique_ptr<Label>              header_;
+    std::vector<std::unique_ptr<Label>> names_;  // une ligne par portée
+    std::vector<std::unique_ptr<Label>> values_; // alignées à droite
+};
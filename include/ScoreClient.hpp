@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SFML/Network.hpp>
+
+#include "sim/ScoreProtocol.hpp"
+
+// Client du serveur de classement (td_leaderboard_server). Le thread
+// appelant ne touche jamais au réseau : submit() met en file, top() copie
+// le dernier classement reçu. Un thread à part envoie la file par lots,
+// recommence avec un backoff si le serveur est lent ou absent, et
+// rafraîchit les tops suivis toutes les kRefresh.
+class ScoreClient {
+public:
+    static constexpr std::size_t               kMaxBatch = 64;   // scores par Submit
+    static constexpr std::size_t               kMaxQueue = 4096; // au-delà, les plus anciens sont abandonnés
+    static constexpr std::chrono::milliseconds kRefresh{10'000};
+    static constexpr std::chrono::milliseconds kTimeout{2'000};  // connexion, puis chaque réponse
+
+    struct Stats {
+        std::uint64_t sent      = 0; // scores acceptés par le serveur
+        std::uint64_t batches   = 0;
+        std::uint64_t failures  = 0; // échanges ratés (chacun suivi d'un backoff)
+        std::uint64_t dropped   = 0; // file pleine
+        std::uint64_t refreshes = 0;
+        std::size_t   queued    = 0;
+        bool          connected = false;
+    };
+
+    // host : nom ou adresse, résolu par le thread réseau (le DNS bloque)
+    explicit ScoreClient(std::string host, unsigned short port = kScoreServerPort);
+    // Attend le thread réseau : au plus kTimeout s'il est au milieu d'une
+    // connexion ou d'un échange, les suivants sont abandonnés ; une
+    // résolution DNS en cours, elle, va à son terme. Les scores encore en
+    // file sont perdus (le classement local les a).
+    ~ScoreClient();
+
+    ScoreClient(const ScoreClient&)            = delete;
+    ScoreClient& operator=(const ScoreClient&) = delete;
+
+    void submit(ScoreEntry e);
+    // Top n de cette difficulté, demandé dès que possible puis rafraîchi en fond
+    void watchTop(const std::string& difficulty, std::uint32_t n);
+    // Dernier top reçu (vide avant la première réponse)
+    std::vector<ScoreEntry> top(const std::string& difficulty) const;
+    // Change à chaque top reçu : rien à recopier tant qu'elle ne bouge pas
+    std::uint64_t topVersion() const { return topVersion_.load(std::memory_order_acquire); }
+    Stats stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Watched {
+        std::string             difficulty;
+        std::uint32_t           n = 0;
+        std::vector<ScoreEntry> top;
+    };
+
+    const std::string    host_;
+    const unsigned short port_;
+
+    // Partagé avec l'appelant ; jamais tenu pendant une entrée/sortie
+    mutable std::mutex         mutex_;
+    std::condition_variable    wake_;
+    std::deque<ScoreEntry>     queue_;
+    std::vector<Watched>       watched_;
+    bool                       stop_       = false;
+    bool                       refreshNow_ = false;
+    Stats                      stats_;
+    std::atomic<std::uint64_t> topVersion_{0};
+
+    // Thread réseau seul
+    std::optional<sf::IpAddress> address_; // host_ résolu
+    bool                         unknownHost_ = false; // déjà signalé
+    sf::TcpSocket                socket_;
+    sf::SocketSelector           selector_;
+    bool                         connected_ = false;
+    MessageBuffer                in_;
+    std::vector<std::uint8_t>    out_;
+    std::vector<ScoreEntry>      inflight_; // lot envoyé, pas encore acquitté
+    std::thread                  thread_;   // démarré en dernier
+
+    void run();
+    bool connect();
+    void disconnect();
+    // Envoie out_ et attend un message de réponse
+    bool exchange(ScoreMessageView& reply);
+    bool sendQueued();
+    bool refreshTops();
+};
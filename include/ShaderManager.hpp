@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "AssetLoader.hpp"
+
+// Shaders du jeu : sources connues à la compilation, compilés une seule fois
+// au démarrage (un par frame, sur le thread de rendu, via le loader) et
+// partagés par les écrans. Un uniform est déclaré une fois (slot = index,
+// nom gardé en std::string) et n'est envoyé que si sa valeur change : l'état
+// reste dans le programme GL d'une frame à l'autre.
+enum class ShaderId { Panel, Button, Count };
+
+class ShaderProgram {
+public:
+    // Slot d'un uniform (le même si déjà déclaré)
+    int uniform(const std::string& name);
+
+    // Sans effet tant que le shader n'est pas compilé
+    void set(int slot, float v);
+    void set(int slot, sf::Glsl::Vec2 v);
+    void set(int slot, sf::Glsl::Vec4 v);
+    void setArray(int slot, const sf::Glsl::Vec4* v, std::size_t count);
+
+    bool              ready() const { return ready_; }
+    // nullptr tant que le shader n'est pas compilé
+    const sf::Shader* shader() const { return ready_ ? &shader_ : nullptr; }
+
+private:
+    friend class ShaderManager;
+    struct Slot {
+        std::string        name;
+        std::vector<float> value; // dernière valeur envoyée (vide : jamais)
+    };
+
+    sf::Shader        shader_;
+    bool              ready_   = false;
+    std::vector<Slot> slots_;
+    std::uint64_t*    uploads_ = nullptr; // compteur du manager
+
+    bool changed(int slot, const float* v, std::size_t n);
+};
+
+class ShaderManager {
+public:
+    ShaderManager();
+
+    ShaderManager(const ShaderManager&) = delete;
+    ShaderManager& operator=(const ShaderManager&) = delete;
+
+    // Planifie la compilation de tous les shaders (un par pump)
+    void compileAll(AssetLoader& loader);
+
+    ShaderProgram& get(ShaderId id) { return programs_[static_cast<std::size_t>(id)]; }
+    // fn est appelé quand le shader est compilé (tout de suite s'il l'est
+    // déjà) ; jamais s'il ne compile pas (l'appelant garde son repli)
+    void whenReady(ShaderId id, std::function<void(ShaderProgram&)> fn);
+
+    // Uniforms réellement envoyés depuis le dernier appel
+    std::uint64_t takeUploads() { const auto n = uploads_; uploads_ = 0; return n; }
+
+private:
+    static constexpr std::size_t kCount = static_cast<std::size_t>(ShaderId::Count);
+
+    std::array<ShaderProgram, kCount>                                   programs_;
+    std::array<std::vector<std::function<void(ShaderProgram&)>>, kCount> waiting_;
+    std::uint64_t uploads_ = 0;
+};
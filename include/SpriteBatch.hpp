@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+// Rendu par lots : les quads (rectangles, sprites, cercles, textes) sont
+// accumulés pendant la frame puis triés par (couche, shader, texture) ;
+// chaque suite de même état part en un seul draw de triangles.
+//
+// Ordre : les couches sont dessinées dans l'ordre croissant. Dans une
+// couche, l'ordre de soumission est gardé pour un même état, mais deux
+// états différents peuvent être permutés : ils ne doivent pas se recouvrir.
+class SpriteBatch {
+public:
+    struct Stats {
+        std::uint32_t drawCalls = 0;
+        std::uint32_t vertices  = 0;
+        std::uint32_t items     = 0; // primitives soumises
+        std::uint32_t shaderBinds = 0; // draws avec shader (hors dessins libres)
+    };
+
+    // Rectangle uni (pos = coin haut-gauche, sans transformation)
+    void rect(sf::Vector2f pos, sf::Vector2f size, sf::Color color, int layer);
+    // Quadrilatère quelconque (coins dans l'ordre haut-gauche, haut-droit,
+    // bas-droit, bas-gauche) ; uv en pixels de texture
+    void quad(const sf::Vector2f (&corners)[4], sf::Color color, int layer,
+              const sf::Texture* texture = nullptr, sf::FloatRect uv = {},
+              const sf::Shader* shader = nullptr);
+    void circle(sf::Vector2f center, float radius, sf::Color color, int layer, unsigned points = 24);
+    void sprite(const sf::Sprite& s, int layer);
+    // Triangles précalculés (ex. mise en page d'un Label), transformés et
+    // recolorés à l'ajout
+    void mesh(const std::vector<sf::Vertex>& v, const sf::Transform& xf, sf::Color color, int layer,
+              const sf::Texture* texture);
+
+    // Réserve `count` quads consécutifs d'un même état (un seul item, 6
+    // sommets par quad) à remplir avec writeRect, éventuellement depuis
+    // plusieurs threads (un quad chacun). Pointeur valable jusqu'à la
+    // prochaine soumission ; nullptr si count = 0.
+    sf::Vertex* reserveQuads(std::size_t count, int layer, const sf::Texture* texture = nullptr);
+    static void writeRect(sf::Vertex* quad, sf::Vector2f pos, sf::Vector2f size, sf::Color color);
+
+    // Dessin libre (ex. shader aux uniforms propres à l'élément) : exécuté à
+    // sa place dans l'ordre des couches, compte pour un draw à part entière
+    void custom(int layer, std::function<void(sf::RenderTarget&)> draw);
+
+    // Trie, dessine et vide le lot
+    void flush(sf::RenderTarget& target);
+
+    // Géométrie en cache (ex. nœud d'interface retenu) : record() déplace ce
+    // qui a été soumis (sans le dessiner) dans rec, replay() le resoumet tel
+    // quel, sans rien recalculer
+    class Recording;
+    void record(Recording& rec);
+    void replay(const Recording& rec);
+
+    // Statistiques cumulées depuis le dernier appel (une frame en général)
+    Stats takeStats();
+
+private:
+    struct Item {
+        int                layer;
+        const sf::Shader*  shader;
+        const sf::Texture* texture;
+        std::uint32_t      first, count; // plage dans verts_ (ou index dans customs_)
+        bool               isCustom;
+    };
+
+    std::vector<Item>        items_;
+    std::vector<sf::Vertex>  verts_;
+    std::vector<sf::Vertex>  sorted_;
+    std::vector<std::uint32_t> order_;
+    std::vector<std::function<void(sf::RenderTarget&)>> customs_;
+    Stats stats_;
+
+    // Étend l'item précédent s'il a le même état, sinon en ouvre un nouveau
+    void push(int layer, const sf::Shader* shader, const sf::Texture* texture, std::uint32_t first);
+};
+
+class SpriteBatch::Recording {
+public:
+    bool empty() const { return items_.empty(); }
+
+private:
+    friend class SpriteBatch;
+    std::vector<Item>                                    items_;
+    std::vector<sf::Vertex>                              verts_;
+    std::vector<std::function<void(sf::RenderTarget&)>> customs_;
+    std::uint32_t                                        submitted_ = 0;
+};
@@ -0,0 +1,140 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "SpriteBatch.hpp"
+
+// Sous-système texte : glyphes prérastérisés par (police, taille, gras,
+// contour) dans la page de la police, et mises en page (quads des glyphes)
+// mises en cache par chaîne. Un Label ne refait sa mise en page que si son
+// contenu ou son style change, et seulement si elle n'est pas déjà en cache.
+
+// Métriques d'un glyphe, copiées une fois depuis sf::Font
+struct GlyphInfo {
+    float         advance = 0.f;
+    sf::FloatRect bounds;   // relatif à la ligne de base
+    sf::FloatRect uv;       // en pixels dans la page de la police
+};
+
+class GlyphAtlas {
+public:
+    // Plage prérastérisée à la création (ASCII imprimable) ; le reste à la demande
+    static constexpr char32_t kFirst = 0x20;
+    static constexpr char32_t kLast  = 0x7E;
+
+    GlyphAtlas(const sf::Font& font, unsigned size, bool bold, float outline);
+
+    const GlyphInfo& glyph(char32_t c);
+    const sf::Texture& texture() const { return font_->getTexture(size_); }
+
+private:
+    const sf::Font* font_;
+    unsigned        size_;
+    bool            bold_;
+    float           outline_;
+    std::vector<GlyphInfo>                  range_; // kFirst..kLast
+    std::unordered_map<char32_t, GlyphInfo> extra_; // hors plage, à la demande
+
+    GlyphInfo fetch(char32_t c) const;
+};
+
+// Mise en page d'une chaîne : quads blancs (recolorés au dessin), en
+// coordonnées locales comme sf::Text (origine = haut-gauche de la 1re ligne)
+struct TextLayout {
+    std::vector<sf::Vertex> outline; // vide sans contour
+    std::vector<sf::Vertex> fill;
+    const sf::Texture*      texture = nullptr;
+    sf::FloatRect           bounds;  // équivalent de sf::Text::getLocalBounds
+};
+
+struct TextStyle {
+    const sf::Font* font        = nullptr;
+    unsigned        size        = 30;
+    bool            bold        = false;
+    float           outline     = 0.f;
+    float           lineSpacing = 1.f;
+    friend bool operator==(const TextStyle&, const TextStyle&) = default;
+};
+
+class TextSystem {
+public:
+    struct Stats {
+        std::uint64_t relayouts = 0; // mises en page calculées (cache manqué)
+        std::uint64_t hits      = 0; // servies par le cache
+    };
+
+    // Mise en page partagée (calculée au premier appel pour ce couple chaîne/style)
+    std::shared_ptr<const TextLayout> layout(std::string_view utf8, const TextStyle& style);
+
+    // Fin de frame : oublie les mises en page inutilisées depuis kKeepFrames
+    void endFrame();
+    // Compteurs depuis le dernier appel (une frame en général)
+    Stats takeStats();
+
+    // Glyphes et mises en page de cette police oubliés : à appeler avant
+    // qu'elle soit détruite (AssetCache::setFontEvicted), sinon une police
+    // créée à la même adresse retomberait sur ses glyphes
+    void clearFont(const sf::Font* font);
+
+private:
+    static constexpr std::uint64_t kKeepFrames = 300;
+
+    struct Key {
+        std::string utf8;
+        TextStyle   style;
+        friend bool operator==(const Key&, const Key&) = default;
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& k) const;
+    };
+    struct Entry {
+        std::shared_ptr<const TextLayout> layout;
+        std::uint64_t                     lastFrame = 0;
+    };
+
+    std::unordered_map<Key, Entry, KeyHash>          layouts_;
+    std::vector<std::unique_ptr<GlyphAtlas>>         atlases_;
+    std::vector<std::pair<TextStyle, GlyphAtlas*>>   atlasKeys_; // (style sans lineSpacing) -> atlas
+    std::uint64_t frame_ = 0;
+    Stats         stats_;
+
+    GlyphAtlas& atlas(const sf::Font& font, unsigned size, bool bold, float outline);
+    std::shared_ptr<const TextLayout> build(std::string_view utf8, const TextStyle& style);
+};
+
+// Texte d'interface : remplace sf::Text dans le menu et le HUD
+class Label : public sf::Transformable {
+public:
+    Label(TextSystem& system, const sf::Font& font, std::string_view utf8, unsigned size);
+
+    // Sans effet si le contenu est identique (pas d'allocation, pas de mise en page)
+    void setString(std::string_view utf8);
+    void setFont(const sf::Font& font);
+    void setCharacterSize(unsigned size);
+    void setLineSpacing(float factor);
+    void setOutlineThickness(float t);
+    void setFillColor(sf::Color c)    { fill_ = c; }
+    void setOutlineColor(sf::Color c) { outlineColor_ = c; }
+
+    const std::string& getString() const { return utf8_; }
+    sf::Color          getFillColor() const { return fill_; }
+    sf::FloatRect getLocalBounds() const { return layout_->bounds; }
+
+    void draw(SpriteBatch& batch, int layer) const;
+
+private:
+    TextSystem*                       system_;
+    TextStyle                         style_;
+    std::string                       utf8_;
+    sf::Color                         fill_{sf::Color::White};
+    sf::Color                         outlineColor_{sf::Color::Black};
+    std::shared_ptr<const TextLayout> layout_;
+
+    void relayout() { layout_ = system_->layout(utf8_, style_); }
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "AssetCache.hpp"
+
+// Textures du jeu par nom ("background", "gear", "units/orc") : une ou
+// quelques pages d'atlas générées à la compilation (cible CMake `atlas`).
+// Toutes les images d'une page partagent la même texture, donc le même lot
+// du SpriteBatch. Les pages viennent de l'AssetCache.
+class TextureAtlas {
+public:
+    struct Region {
+        const sf::Texture* texture = nullptr;
+        sf::IntRect        rect;
+    };
+
+    // Demande les pages de l'index généré (relatives à son dossier) ; sans
+    // index, chaque PNG de looseDir (relatif à assets/) devient sa propre
+    // page. onReady(ok) est appelé une fois toutes les pages arrivées.
+    void request(AssetCache& cache, const std::string& indexPath, const std::string& looseDir,
+                 std::function<void(bool)> onReady);
+
+    const Region* find(std::string_view name) const;
+    // Sprite sur la région nommée (nullptr si absente)
+    std::unique_ptr<sf::Sprite> makeSprite(std::string_view name) const;
+
+    std::size_t pageCount() const { return pages_.size(); }
+
+private:
+    struct PendingRegion {
+        std::string name;
+        std::size_t page = 0;
+        sf::IntRect rect;
+    };
+
+    std::vector<AssetCache::TextureHandle>  pages_;
+    std::unordered_map<std::string, Region> regions_;
+};
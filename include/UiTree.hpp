@@ -0,0 +1,234 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "ShaderManager.hpp"
+#include "SpriteBatch.hpp"
+#include "TextCache.hpp"
+
+// Interface retenue : un arbre de widgets (panneau, image, bouton, slider,
+// texte) dont la géométrie est enregistrée une fois puis rejouée dans le lot
+// à chaque frame. Un nœud n'est reconstruit que s'il a été marqué sale par
+// un setter (les setters ignorent une valeur identique) : un écran immobile
+// ne recalcule rien. Les positions sont absolues (coordonnées de la vue) et
+// posées par la mise en page de l'écran, refaite au redimensionnement.
+
+class UiNode {
+public:
+    explicit UiNode(int layer = 0) : layer_(layer) {}
+    virtual ~UiNode() = default;
+
+    UiNode(const UiNode&) = delete;
+    UiNode& operator=(const UiNode&) = delete;
+
+    template <class T, class... Args>
+    T& add(Args&&... args) {
+        auto node = std::make_unique<T>(std::forward<Args>(args)...);
+        T&      ref  = *node;
+        UiNode& base = ref;
+        base.parent_ = this;
+        children_.push_back(std::move(node));
+        base.markDirty();
+        return ref;
+    }
+
+    void setPosition(sf::Vector2f p);
+    void setSize(sf::Vector2f s);
+    // Masqué : ni dessiné ni reconstruit, la géométrie reste en cache
+    void setVisible(bool v) { visible_ = v; }
+
+    sf::Vector2f position() const { return pos_; }
+    sf::Vector2f size() const { return size_; }
+    bool         visible() const { return visible_; }
+    bool         contains(sf::Vector2f p) const { return sf::FloatRect(pos_, size_).contains(p); }
+
+    // Reconstruit les nœuds sales (scratch : lot de travail, jamais dessiné) ;
+    // retourne le nombre de nœuds reconstruits
+    std::size_t refresh(SpriteBatch& scratch);
+    // Rejoue la géométrie en cache des nœuds visibles
+    void submit(SpriteBatch& batch) const;
+
+protected:
+    int layer_;
+
+    void markDirty();
+    // Géométrie du nœud, soumise à un lot d'enregistrement
+    virtual void build(SpriteBatch& rec) { (void)rec; }
+
+private:
+    UiNode*                              parent_ = nullptr;
+    std::vector<std::unique_ptr<UiNode>> children_;
+    sf::Vector2f                         pos_{0.f, 0.f}, size_{0.f, 0.f};
+    bool                                 visible_    = true;
+    bool                                 dirty_      = true;  // géométrie à refaire
+    bool                                 childDirty_ = false; // un descendant est sale
+    SpriteBatch::Recording               geometry_;
+};
+
+// Racine d'un écran : reconstruit puis soumet, et compte les reconstructions
+class UiTree {
+public:
+    UiNode& root() { return root_; }
+
+    void draw(SpriteBatch& batch);
+    std::uint64_t takeRebuilds() { const auto n = rebuilds_; rebuilds_ = 0; return n; }
+
+private:
+    UiNode        root_;
+    SpriteBatch   scratch_;
+    std::uint64_t rebuilds_ = 0;
+};
+
+// Rectangle ou disque uni, ou quad dessiné par un shader
+class UiPanel : public UiNode {
+public:
+    enum class Shape { Rect, Circle };
+
+    explicit UiPanel(int layer, sf::Color fill = sf::Color::Transparent, Shape shape = Shape::Rect)
+        : UiNode(layer), fill_(fill), shape_(shape) {}
+
+    void setFill(sf::Color c);
+    // Quad du panneau dessiné avec ce shader (uv = coordonnées locales en
+    // pixels) ; ses uniforms sont à la charge de l'écran
+    void setShader(const sf::Shader* shader);
+
+protected:
+    void build(SpriteBatch& rec) override;
+
+private:
+    sf::Color         fill_;
+    Shape             shape_;
+    const sf::Shader* shader_ = nullptr;
+};
+
+// Image (sprite en coordonnées absolues) ; rectangle de remplacement tant
+// qu'elle n'est pas chargée
+class UiImage : public UiNode {
+public:
+    explicit UiImage(int layer, sf::Color placeholder = sf::Color::Transparent)
+        : UiNode(layer), placeholder_(placeholder) {}
+
+    void setSprite(std::unique_ptr<sf::Sprite> s);
+    bool hasSprite() const { return sprite_ != nullptr; }
+    // Accès en écriture : marque le nœud sale
+    sf::Sprite* editSprite() { markDirty(); return sprite_.get(); }
+
+protected:
+    void build(SpriteBatch& rec) override;
+
+private:
+    std::unique_ptr<sf::Sprite> sprite_;
+    sf::Color                   placeholder_;
+};
+
+// Texte : le Label garde sa propre transformation (origine, position, échelle)
+class UiLabel : public UiNode {
+public:
+    UiLabel(int layer, Label label) : UiNode(layer), label_(std::move(label)) {}
+
+    const Label& get() const { return label_; }
+    // Accès en écriture : marque le nœud sale
+    Label& edit() { markDirty(); return label_; }
+
+    void setFillColor(sf::Color c);
+    // Origine au centre des bornes (ou à droite, ligne du haut)
+    void centerOrigin();
+    void rightAlignOrigin();
+
+protected:
+    void build(SpriteBatch& rec) override { label_.draw(rec, layer_); }
+
+private:
+    Label label_;
+};
+
+// Paramètres d'un bouton pour le shader Button (un jeu par instance)
+struct ButtonInstance {
+    sf::Glsl::Vec4 box;    // taille.xy, rayon, hover lissé
+    sf::Glsl::Vec4 fillA, fillB, border;
+};
+
+// Shader partagé des boutons : les paramètres de chaque bouton sont rangés
+// dans des tableaux d'uniforms indexés par la couleur de ses sommets, si
+// bien que tous les boutons partent dans le même draw du lot
+class UiButtonShader {
+public:
+    static constexpr int kMaxButtons = 8; // taille des tableaux du shader
+
+    explicit UiButtonShader(ShaderProgram& program);
+
+    // Slot d'un nouveau bouton, -1 si plein (le bouton reste en forme unie)
+    int  allocate();
+    void setInstance(int slot, const ButtonInstance& params);
+    // Envoie ce qui a changé (tableaux, temps) ; avant le flush du lot
+    void upload(float time);
+
+    const sf::Shader* shader() const { return program_.shader(); }
+
+private:
+    ShaderProgram& program_;
+    int            used_ = 0;
+    int            uBox_, uFillA_, uFillB_, uBorder_, uTime_;
+    std::array<sf::Glsl::Vec4, kMaxButtons> box_{}, fillA_{}, fillB_{}, border_{};
+};
+
+// Bouton : fond au shader (ou rectangle sans shader), libellé centré et icône.
+// scale/hover sont les valeurs affichées (déjà interpolées).
+class UiButton : public UiNode {
+public:
+    struct Theme {
+        sf::Color fillA{}, fillB{}, border{};
+        sf::Color hoverFillA{}, hoverFillB{}, hoverBorder{};
+    };
+
+    UiButton(int layer, int labelLayer, Label label);
+
+    void setTheme(const Theme& t) { theme_ = t; markDirty(); }
+    void setRadius(float r);
+    void setAnim(float scale, float hover);
+    // Fond dessiné par le shader partagé des boutons
+    void setShader(UiButtonShader* shader);
+    void setIcon(std::unique_ptr<sf::Sprite> icon);
+
+    UiLabel&      label() { return *label_; }
+    bool          hasIcon() const { return icon_ != nullptr; }
+    // Rectangle affiché (mis à l'échelle autour du centre)
+    sf::FloatRect shownRect() const;
+
+protected:
+    void build(SpriteBatch& rec) override;
+
+private:
+    UiLabel*                    label_;
+    int                         labelLayer_;
+    std::unique_ptr<sf::Sprite> icon_;
+    Theme                       theme_;
+    float                       radius_ = 14.f;
+    float                       scale_  = 1.f;
+    float                       hover_  = 0.f;
+    UiButtonShader*             shader_ = nullptr;
+    int                         slot_   = -1;
+};
+
+// Barre horizontale 0..1 avec curseur rond (position/taille = la barre)
+class UiSlider : public UiNode {
+public:
+    explicit UiSlider(int layer) : UiNode(layer) {}
+
+    void  setValue(float v01);
+    float value() const { return value01_; }
+    // Valeur sous l'abscisse x (bornée)
+    float valueAt(float x) const;
+
+protected:
+    void build(SpriteBatch& rec) override;
+
+private:
+    float value01_ = 0.f;
+};
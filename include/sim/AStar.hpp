@@ -0,0 +1,13 @@
+#pragma once
+#include <vector>
+
+#include "sim/GridMap.hpp"
+#include "sim/Systems.hpp"
+
+// A* mono-unité (8 voisins, sans couper les coins), réservé aux unités
+// spéciales qui ne suivent pas le champ de flux commun (ex. cible propre).
+// Retourne false si `to` est injoignable ; `out` va de `from` à `to` inclus.
+bool findPathAStar(const GridMap& map, Cell from, Cell to, std::vector<Cell>& out);
+
+// Chemin de cellules -> polyligne passant par les centres
+Path cellsToPath(const std::vector<Cell>& cells);
@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sim/Json.hpp"
+
+// Atlas de textures : placement des images dans des pages et index
+// nom -> rectangle. Sans SFML (le décodage/écriture des PNG est fait par
+// l'outil td_atlas_pack) ; le jeu lit l'index via TextureAtlas.
+
+struct AtlasPage {
+    std::string file;      // relatif au dossier de l'index
+    int         width  = 0;
+    int         height = 0;
+};
+
+struct AtlasEntry {
+    std::string name;      // chemin relatif sans extension ("gear", "units/orc")
+    int page = 0;
+    int x = 0, y = 0, w = 0, h = 0; // en pixels, sans la marge
+};
+
+struct AtlasIndex {
+    std::vector<AtlasPage>  pages;
+    std::vector<AtlasEntry> entries; // triées par nom
+
+    const AtlasEntry* find(std::string_view name) const;
+};
+
+struct AtlasPackInput {
+    std::string name;
+    int w = 0, h = 0;
+};
+
+// Rangement en étagères (plus hautes d'abord) dans des pages d'au plus
+// maxSize x maxSize ; `padding` pixels libres autour de chaque image (l'outil
+// y recopie les bords pour le filtrage linéaire). Les pages sont rognées à
+// la zone utilisée. Les fichiers de page sont nommés <stem>_<n>.png.
+// Échoue si une image ne tient pas dans une page.
+bool packAtlas(const std::vector<AtlasPackInput>& inputs, int maxSize, int padding,
+               const std::string& stem, AtlasIndex& out, std::string* error = nullptr);
+
+JsonValue atlasToJson(const AtlasIndex& index);
+bool parseAtlas(const JsonValue& root, AtlasIndex& out);
+bool loadAtlasIndex(const std::string& path, AtlasIndex& out);
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sim/Json.hpp"
+
+// Paramètres d'une difficulté (config/diffilculty.json)
+struct DifficultyParams {
+    std::string name;
+    float hpMultiplier     = 1.f;
+    float speedMultiplier  = 1.f;
+    float rewardMultiplier = 1.f;
+    int   livesStart       = 20;
+};
+
+// Règles de partie (config/game_rules.json)
+struct GameRules {
+    bool          forbidTotalBlock = true;
+    std::uint32_t startMaterials[3] = {100, 50, 30}; // A (or), B, C
+};
+
+// Les difficultés sont rendues dans l'ordre du fichier (Easy, Normal, ...)
+bool parseDifficulties(const JsonValue& root, std::vector<DifficultyParams>& out);
+bool loadDifficulties(const std::string& path, std::vector<DifficultyParams>& out);
+const DifficultyParams* findDifficulty(const std::vector<DifficultyParams>& all, std::string_view name);
+
+bool parseGameRules(const JsonValue& root, GameRules& out);
+bool loadGameRules(const std::string& path, GameRules& out);
@@ -0,0 +1,138 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sim/Config.hpp"
+
+// Config compilée (td_config) : diffilculty.json + game_rules.json validés
+// puis écrits en un bloc binaire à plat, projeté en mémoire tel quel.
+//   en-tête (32 o) | règles (16 o) | n difficultés (32 o chacune)
+// Petit-boutiste, enregistrements de taille fixe alignés sur 16 : lus sans
+// copie ni recherche de chaîne depuis le mapping.
+
+struct ConfigBlobHeader {
+    char          magic[4];        // "TDCB"
+    std::uint32_t version;
+    std::uint32_t size;            // fichier entier
+    std::uint32_t checksum;        // FNV-1a de tout ce qui suit l'en-tête
+    std::uint32_t difficultyCount;
+    std::uint32_t reserved[3];
+};
+
+struct RulesRecord {
+    std::uint32_t startMaterials[3];
+    std::uint8_t  forbidTotalBlock;
+    std::uint8_t  pad[3];
+};
+
+struct DifficultyRecord {
+    static constexpr std::size_t kMaxName = 15;
+    char          name[kMaxName + 1]; // terminé par '\0'
+    float         hpMultiplier;
+    float         speedMultiplier;
+    float         rewardMultiplier;
+    std::int32_t  livesStart;
+};
+
+static_assert(sizeof(ConfigBlobHeader) == 32 && sizeof(RulesRecord) == 16 && sizeof(DifficultyRecord) == 32);
+
+// --- Schéma : chaque clé connue, typée et bornée ; une clé inconnue est une
+//     erreur (faute de frappe). Les messages vont dans errors ("Hard.livesStart: ...").
+bool validateDifficulties(const JsonValue& root, std::vector<std::string>& errors);
+bool validateGameRules(const JsonValue& root, std::vector<std::string>& errors);
+
+// Valide les deux fichiers et écrit le bloc ; false avec les erreurs du schéma
+bool compileConfig(const JsonValue& difficulties, const JsonValue& rules, std::vector<std::uint8_t>& out,
+                   std::vector<std::string>& errors);
+// Fichiers -> bloc (écrit à côté puis renommé : un lecteur ne voit jamais un bloc à moitié écrit)
+bool compileConfigFiles(const std::string& difficultyPath, const std::string& rulesPath,
+                        const std::string& outPath);
+
+// Bloc projeté en mémoire (lecture seule). Vérifié à l'ouverture : magic,
+// version, taille et checksum.
+class ConfigBlob {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+
+    ConfigBlob() = default;
+    ~ConfigBlob();
+    ConfigBlob(const ConfigBlob&)            = delete;
+    ConfigBlob& operator=(const ConfigBlob&) = delete;
+
+    bool open(const std::string& path);
+    // Bloc déjà en mémoire (copié)
+    bool openBytes(const std::uint8_t* data, std::size_t size);
+    void close();
+    bool isOpen() const { return data_ != nullptr; }
+
+    std::uint32_t checksum() const { return header().checksum; }
+    const RulesRecord& rulesRecord() const;
+    std::size_t difficultyCount() const { return header().difficultyCount; }
+    const DifficultyRecord& difficultyRecord(std::size_t i) const;
+    int findDifficulty(const char* name) const; // indice, -1 si absente
+
+    // Vers les structures de la simulation (ordre du fichier JSON)
+    GameRules rules() const;
+    DifficultyParams difficulty(std::size_t i) const;
+    std::vector<DifficultyParams> difficulties() const;
+
+private:
+    const std::uint8_t*       data_ = nullptr;
+    std::size_t               size_ = 0;
+    void*                     mapping_ = nullptr; // mmap, sinon copy_ sert de stockage
+    std::vector<std::uint8_t> copy_;
+
+    const ConfigBlobHeader& header() const { return *reinterpret_cast<const ConfigBlobHeader*>(data_); }
+    bool check(const std::string& what);
+};
+
+// Bloc + difficultés/règles : la config d'un jeu chargée depuis un .tdcb
+bool loadConfigBlob(const std::string& path, std::vector<DifficultyParams>& difficulties, GameRules& rules);
+
+// Surveille un bloc : un thread regarde la date et la taille du fichier
+// toutes les `interval`, rouvre et vérifie le bloc quand elles changent, et
+// le publie. Le thread de jeu le récupère avec take() quand ça l'arrange
+// (entre deux ticks) : rien n'est bloqué pendant la lecture.
+class ConfigWatcher {
+public:
+    explicit ConfigWatcher(std::string path,
+                           std::chrono::milliseconds interval = std::chrono::milliseconds(250),
+                           bool startThread = true);
+    ~ConfigWatcher();
+    ConfigWatcher(const ConfigWatcher&)            = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    // Un tour de surveillance (le thread l'appelle ; les tests aussi).
+    // true si un nouveau bloc valide a été publié.
+    bool poll();
+    // Dernier bloc publié et pas encore pris (nullptr sinon)
+    std::shared_ptr<const ConfigBlob> take();
+    std::uint64_t reloads() const { return reloads_.load(std::memory_order_relaxed); }
+    std::uint64_t rejected() const { return rejected_.load(std::memory_order_relaxed); }
+
+private:
+    const std::string               path_;
+    const std::chrono::milliseconds interval_;
+
+    // Thread de surveillance seul
+    std::int64_t  lastTime_     = 0;
+    std::uintmax_t lastSize_    = 0;
+    std::uint32_t lastChecksum_ = 0;
+
+    std::mutex                        mutex_;
+    std::condition_variable           wake_;
+    bool                              stop_ = false;
+    std::shared_ptr<const ConfigBlob> pending_;
+    std::atomic<std::uint64_t>        reloads_{0}, rejected_{0};
+    std::thread                       thread_; // démarré en dernier
+
+    void run();
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+
+#include "sim/Config.hpp"
+
+// Politiques de difficulté vues par les boucles d'ennemis (Game::stepWave).
+// Les trois presets livrés dans config/diffilculty.json sont des constantes
+// de compilation : la boucle spécialisée n'a plus de multiplicateur à lire.
+// Custom, ou un preset retouché dans le JSON (ou rechargé à chaud), passe
+// par RuntimePolicy : mêmes formules, valeurs lues à l'exécution.
+// Toutes exposent hp, speed et reward (membres statiques ou non).
+
+struct EasyPolicy {
+    static constexpr float hp = 0.8f, speed = 0.9f, reward = 1.2f;
+};
+struct NormalPolicy {
+    static constexpr float hp = 1.0f, speed = 1.0f, reward = 1.0f;
+};
+struct HardPolicy {
+    static constexpr float hp = 1.3f, speed = 1.1f, reward = 0.9f;
+};
+struct RuntimePolicy {
+    float hp = 1.f, speed = 1.f, reward = 1.f;
+    friend bool operator==(const RuntimePolicy&, const RuntimePolicy&) = default;
+};
+
+enum class DifficultyPreset : std::uint8_t { Easy, Normal, Hard, Runtime };
+
+inline RuntimePolicy runtimePolicy(const DifficultyParams& d) {
+    return RuntimePolicy{d.hpMultiplier, d.speedMultiplier, d.rewardMultiplier};
+}
+
+// Preset figé seulement si le nom et les trois multiplicateurs correspondent
+// exactement ; sinon Runtime
+inline DifficultyPreset matchPreset(const DifficultyParams& d) {
+    const auto same = [&](const char* name, auto p) {
+        return d.name == name && d.hpMultiplier == p.hp && d.speedMultiplier == p.speed &&
+               d.rewardMultiplier == p.reward;
+    };
+    if (same("Easy", EasyPolicy{}))     return DifficultyPreset::Easy;
+    if (same("Normal", NormalPolicy{})) return DifficultyPreset::Normal;
+    if (same("Hard", HardPolicy{}))     return DifficultyPreset::Hard;
+    return DifficultyPreset::Runtime;
+}
+
+// Appelle f avec la politique du preset : un seul aiguillage, hors des boucles.
+// runtime : valeurs de RuntimePolicy (ignorées pour les presets figés)
+template <class F>
+decltype(auto) visitDifficulty(DifficultyPreset preset, const RuntimePolicy& runtime, F&& f) {
+    switch (preset) {
+    case DifficultyPreset::Easy:   return f(EasyPolicy{});
+    case DifficultyPreset::Normal: return f(NormalPolicy{});
+    case DifficultyPreset::Hard:   return f(HardPolicy{});
+    default:                       return f(runtime);
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sim/Handle.hpp"
+
+// Stockage "structure of arrays" des entités de la partie.
+// Chaque champ est un tableau contigu indexé par l'index dense : les
+// systèmes (déplacement, dégâts...) parcourent uniquement les champs
+// dont ils ont besoin, sans pointeurs ni allocation par entité.
+// Les coordonnées sont en unités de cellule de la carte.
+
+struct EnemySpawn {
+    float         x = 0.f, y = 0.f;
+    float         hp     = 100.f;
+    float         speed  = 1.f;  // cellules / seconde
+    std::uint32_t reward = 0;
+    std::uint8_t  goal   = 0;    // sortie visée (index dans GridMap::exits)
+};
+
+struct EnemyStore {
+    HandleTable ids;
+
+    // Champs chauds (parcourus à chaque tick)
+    std::vector<float>         posX, posY;
+    std::vector<float>         velX, velY;
+    std::vector<float>         hp;
+    std::vector<float>         progress; // distance parcourue (ciblage "premier")
+    std::vector<std::uint32_t> pathIdx;  // progression : prochain waypoint du chemin,
+                                         // ou cellule courante en guidage par champ de flux
+    // Champs froids
+    std::vector<float>         speed;
+    std::vector<std::uint32_t> reward;
+    std::vector<std::uint8_t>  goal;
+
+    Handle      spawn(const EnemySpawn& s);
+    bool        destroy(Handle h);
+    std::size_t size() const { return posX.size(); }
+    void        reserve(std::size_t n);
+    void        clear();
+};
+
+// Choix de cible d'une tour parmi les ennemis à portée
+enum class TargetMode : std::uint8_t {
+    First,     // le plus avancé sur le chemin
+    Nearest,   // le plus proche de la tour
+    Strongest, // le plus de points de vie
+};
+
+struct TowerSpec {
+    float x = 0.f, y = 0.f;
+    float range    = 3.f;
+    float damage   = 10.f;
+    float fireRate = 1.f;  // tirs / seconde
+    TargetMode mode = TargetMode::First;
+};
+
+struct TowerStore {
+    HandleTable ids;
+
+    std::vector<float>  posX, posY;
+    std::vector<float>  range, damage;
+    std::vector<float>  cooldown;  // secondes avant le prochain tir
+    std::vector<float>  fireRate;
+    std::vector<TargetMode> mode;
+    std::vector<Handle> target;    // cible courante (peut être périmée)
+
+    Handle      build(const TowerSpec& s);
+    bool        destroy(Handle h);
+    std::size_t size() const { return posX.size(); }
+    void        clear();
+};
+
+struct ProjectileSpawn {
+    float  x = 0.f, y = 0.f;
+    float  vx = 0.f, vy = 0.f;
+    float  damage = 0.f;
+    float  ttl    = 2.f;  // secondes
+    Handle target;
+};
+
+struct ProjectileStore {
+    HandleTable ids;
+
+    std::vector<float>  posX, posY;
+    std::vector<float>  velX, velY;
+    std::vector<float>  damage;
+    std::vector<float>  ttl;
+    std::vector<Handle> target;
+
+    Handle      fire(const ProjectileSpawn& s);
+    bool        destroy(Handle h);
+    std::size_t size() const { return posX.size(); }
+    void        clear();
+};
+
+struct World {
+    EnemyStore      enemies;
+    TowerStore      towers;
+    ProjectileStore projectiles;
+};
@@ -0,0 +1,108 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "sim/GridMap.hpp"
+
+class JobSystem;
+
+// Champ de flux : une passe BFS (coût unitaire, 4-voisinage) depuis une
+// sortie donne la distance de chaque cellule ; chaque cellule stocke
+// ensuite la direction (8 voisins) qui descend le plus vite vers la sortie.
+// Tous les ennemis qui visent cette sortie lisent leur direction en O(1).
+//
+// En interne la grille a une bordure d'une cellule toujours bloquée :
+// les parcours n'ont ainsi aucun test de bornes.
+class FlowField {
+public:
+    static constexpr std::uint32_t kUnreachable = 0xFFFFFFFFu;
+    static constexpr std::uint8_t  kNoDir       = 8;
+
+    // Directions 0..7 : E, SE, S, SW, W, NW, N, NE (y vers le bas)
+    static constexpr int kDirX[8] = { 1,  1,  0, -1, -1, -1,  0,  1 };
+    static constexpr int kDirY[8] = { 0,  1,  1,  1,  0, -1, -1, -1 };
+
+    // Construit le champ vers un ensemble de cellules buts (une sortie, ou plusieurs)
+    void build(const GridMap& map, std::span<const Cell> goals);
+
+    int width()  const { return width_; }
+    int height() const { return height_; }
+    bool inBounds(int x, int y) const { return x >= 0 && y >= 0 && x < width_ && y < height_; }
+
+    std::uint32_t distance(int x, int y)  const { return dist_[cellIndex(x, y)]; }
+    std::uint32_t distance(Cell c)        const { return distance(c.x, c.y); }
+    std::uint8_t  direction(int x, int y) const { return dir_[cellIndex(x, y)]; }
+    std::uint8_t  direction(Cell c)       const { return direction(c.x, c.y); }
+
+    // Direction de la cellule contenant (px, py) ; kNoDir si hors carte,
+    // bloquée, injoignable ou déjà sur un but.
+    std::uint8_t sample(float px, float py) const;
+
+    // --- Réparation incrémentale (pose / retrait d'une tour)
+    // Seule la zone dont les plus courts chemins passaient par la cellule est
+    // recalculée ; le résultat est identique à un build() complet.
+    void setBlocked(int x, int y, bool blocked);
+
+private:
+    int width_  = 0;
+    int height_ = 0;
+    int stride_ = 0; // width_ + 2
+
+    std::vector<std::uint8_t>  wall_;  // copie bordée de GridMap::blocked
+    std::vector<std::uint32_t> dist_;
+    std::vector<std::uint8_t>  dir_;
+    std::vector<std::uint32_t> queue_; // file BFS réutilisée entre deux builds
+    std::vector<std::uint32_t> goals_;
+    int offset_[8] = {};               // décalage d'index par direction
+
+    // Réparation : cellules invalidées, graines, cellules dont la direction est à revoir
+    struct Seed { std::uint32_t dist, idx; };
+    std::vector<std::uint32_t> invalid_, invalidDist_;
+    std::vector<Seed>          seeds_;
+    std::vector<std::uint32_t> touched_;
+    std::vector<std::uint32_t> mark_;  // époque de dernier "touched" par cellule
+    std::uint32_t              epoch_ = 0;
+
+    std::uint32_t cellIndex(int x, int y) const {
+        return static_cast<std::uint32_t>((y + 1) * stride_ + (x + 1));
+    }
+    void computeDirection(std::uint32_t idx);
+
+    void setDist(std::uint32_t idx, std::uint32_t d);
+    void touchAround(std::uint32_t idx);
+    void repairAfterBlock(std::uint32_t c);
+    void repairAfterUnblock(std::uint32_t c);
+    void propagateDecrease(std::size_t seedCount);
+};
+
+// Un champ par sortie de la carte. Les champs sont indépendants : avec un
+// JobSystem, construction et réparation se font un champ par tâche.
+struct FlowFieldSet {
+    std::vector<FlowField> fields;
+
+    void build(const GridMap& map, JobSystem* jobs = nullptr);
+    // Sortie la plus proche de la cellule (-1 si aucune n'est joignable)
+    int nearestExit(Cell c) const;
+
+    // Bloque/débloque une cellule de la carte et répare tous les champs
+    void setBlocked(GridMap& map, Cell c, bool blocked, JobSystem* jobs = nullptr);
+
+    // Bloquer c couperait-il un spawn (qui en avait une) de toute sortie ?
+    // Ne touche pas aux champs : test local sur l'anneau des 8 voisins (O(1)
+    // dans le cas courant), sinon inondation simultanée depuis les groupes de
+    // voisins séparés, arrêtée dès qu'ils se rejoignent. Appelable à chaque frame.
+    bool wouldFullyBlock(const GridMap& map, Cell c);
+
+    // Une tour peut-elle être posée en c ? (case libre, ni spawn ni sortie,
+    // et pas de blocage total si forbidTotalBlock)
+    bool canPlace(const GridMap& map, Cell c, bool forbidTotalBlock);
+
+private:
+    // Tampons de wouldFullyBlock (réutilisés : pas d'allocation par requête)
+    std::vector<std::uint32_t> visitEpoch_;
+    std::vector<std::uint8_t>  visitGroup_;
+    std::vector<std::uint32_t> floodQueue_[4];
+    std::vector<std::uint8_t>  exitInComponent_;
+    std::uint32_t              visitCounter_ = 0;
+};
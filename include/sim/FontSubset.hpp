@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Sous-ensemble de polices TrueType (tables glyf/loca) et paquet de polices,
+// pour l'outil td_font_pack et le chargement au démarrage. Sans dépendance.
+//
+// Le sous-ensemble garde les numéros de glyphe (les glyphes non retenus
+// deviennent vides), reconstruit cmap (format 4) et post (version 3), et
+// retire les tables de variation et de mise en forme avancée (fvar, gvar,
+// HVAR, GPOS, GSUB, GDEF...) : une police variable devient son instance par
+// défaut. FreeType/SFML n'utilisent que la table kern, qui est gardée.
+
+struct CodepointRange {
+    char32_t first = 0, last = 0;
+};
+
+// "20-7E,A0-FF,20AC" (hexadécimal)
+bool parseCodepointRanges(std::string_view text, std::vector<CodepointRange>& out);
+
+struct FontSubsetStats {
+    std::size_t glyphsKept  = 0;
+    std::size_t glyphsTotal = 0;
+    std::size_t bytesIn     = 0;
+    std::size_t bytesOut    = 0;
+    std::vector<std::string> droppedTables;
+};
+
+// false (et un message) si la police n'est pas une TrueType lisible
+bool subsetTrueType(const std::vector<std::uint8_t>& font, const std::vector<CodepointRange>& ranges,
+                    std::vector<std::uint8_t>& out, FontSubsetStats* stats = nullptr,
+                    std::string* error = nullptr);
+
+// Lecture (tests et diagnostics) : glyphe d'un point de code via cmap (0 si
+// absent) et taille de ses données dans glyf
+std::uint32_t fontGlyphIndex(const std::vector<std::uint8_t>& font, char32_t cp);
+std::size_t   fontGlyphDataSize(const std::vector<std::uint8_t>& font, std::uint32_t glyph);
+// Somme de contrôle globale valide (head.checkSumAdjustment)
+bool          fontChecksumValid(const std::vector<std::uint8_t>& font);
+
+// Paquet : "TDFB", version, nombre d'entrées, puis (nom, décalage, taille)
+// et les données. Les noms sont les chemins relatifs à assets/.
+struct FontBundleEntry {
+    std::string   name;
+    std::uint64_t offset = 0;
+    std::uint64_t size   = 0;
+};
+
+bool writeFontBundle(const std::string& path,
+                     const std::vector<std::pair<std::string, std::vector<std::uint8_t>>>& fonts);
+bool readFontBundleIndex(const std::string& path, std::vector<FontBundleEntry>& out);
+bool readFontBundleEntry(const std::string& path, const FontBundleEntry& entry, std::vector<char>& out);
@@ -0,0 +1,186 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "sim/Config.hpp"
+#include "sim/DifficultyPolicy.hpp"
+#include "sim/GridMap.hpp"
+#include "sim/MapGen.hpp"
+#include "sim/Rng.hpp"
+#include "sim/SpatialGrid.hpp"
+#include "sim/Systems.hpp"
+
+class JobSystem;
+
+// Partie complète sans fenêtre ni audio : carte tirée de la graine, vagues,
+// tours, vies et or. Entièrement déterministe (bit à bit) pour une graine,
+// une config et une suite de commandes : sert au jeu, au mode headless,
+// aux balayages d'équilibrage, aux replays et aux tests.
+//
+// Lockstep : le joueur n'agit que par des GameCommand, appliquées au début
+// du tick indiqué et dans l'ordre de soumission. Le seul hasard est celui
+// de la carte, tirée par MapGen depuis la graine ; le joueur automatique a
+// son propre flux (botRng_), hors état simulé.
+
+enum class CommandType : std::uint8_t {
+    PlaceTower    = 0, // (x, y), arg = TargetMode
+    SellTower     = 1, // (x, y) : rembourse la moitié
+    SetTargetMode = 2, // (x, y), arg = TargetMode
+    StartWave     = 3, // écourte la phase de construction
+};
+
+struct GameCommand {
+    std::uint32_t tick = 0;
+    CommandType   type = CommandType::PlaceTower;
+    std::uint8_t  arg  = 0;
+    std::int16_t  x = 0, y = 0;
+    friend bool operator==(const GameCommand&, const GameCommand&) = default;
+};
+
+struct GameSetup {
+    std::uint64_t    seed = 1;
+    DifficultyParams difficulty;
+    GameRules        rules;
+    int              maxWaves  = 40; // partie gagnée au-delà
+    int              mapWidth  = 32;
+    int              mapHeight = 20;
+    bool             autoPlayer = true; // false : seules les commandes soumises agissent
+};
+
+struct GameResult {
+    std::uint64_t seed         = 0;
+    int           wavesCleared = 0;
+    int           livesLost    = 0;
+    bool          survived     = false; // maxWaves atteint avec des vies restantes
+    std::uint64_t kills        = 0;
+    std::uint32_t towersBuilt  = 0;
+    std::uint64_t ticks        = 0;
+    std::vector<std::uint32_t> goldCurve; // or en fin de chaque vague gagnée
+};
+
+class Game {
+public:
+    static constexpr int   kTickHz = 120; // même pas que App
+    static constexpr float kDt     = 1.f / kTickHz;
+
+    // Équilibrage de base (multiplié par la difficulté)
+    static constexpr float         kEnemyHp         = 30.f;
+    static constexpr float         kEnemyHpGrowth   = 1.14f;  // par vague
+    static constexpr float         kEnemySpeed      = 1.5f;   // cellules / s
+    static constexpr std::uint32_t kEnemyReward     = 5;
+    static constexpr float         kSpawnInterval   = 0.5f;   // s
+    static constexpr float         kBuildTime       = 3.f;    // s entre deux vagues
+    static constexpr std::uint32_t kTowerCost       = 50;
+    static constexpr float         kTowerRange      = 3.f;
+    static constexpr float         kTowerDamage     = 15.f;
+    static constexpr float         kTowerFireRate   = 1.5f;
+    static constexpr float         kProjectileSpeed = 10.f;
+    static constexpr float         kHitRadius       = 0.3f;
+    static constexpr float         kWaveTimeout     = 300.f;  // s : garde-fou
+
+    // map : carte déjà générée pour cette graine (MapCache), sinon tirée ici.
+    // jobs : champs de flux, grille et ciblage répartis sur ses threads ;
+    // mêmes résultats (bit à bit) qu'en série. Doit survivre à la partie.
+    explicit Game(const GameSetup& setup, const GridMap* map = nullptr, JobSystem* jobs = nullptr);
+    // Paramètres de génération de la carte d'une partie
+    static MapGenParams mapParams(const GameSetup& setup);
+
+    void step();                       // un tick de kDt
+    bool over() const { return over_; }
+    GameResult run();                  // jusqu'à la fin de la partie
+
+    // Commande appliquée au début du prochain tick (son champ tick est
+    // renseigné ici). Les commandes invalides sont ignorées, de façon
+    // déterministe.
+    void submit(GameCommand cmd);
+    // Reçoit chaque commande au moment où elle est appliquée (enregistrement)
+    void setCommandSink(std::function<void(const GameCommand&)> sink) { sink_ = std::move(sink); }
+
+    // Réglages rechargés en cours de partie (config à chaud), appelé entre
+    // deux ticks : multiplicateurs des prochains ennemis (ceux déjà sur le
+    // terrain gardent les leurs) et règle de pose.
+    // Vies et matériaux de départ ne comptent qu'au lancement.
+    void retune(const DifficultyParams& difficulty, const GameRules& rules);
+
+    // Prochain tick à simuler
+    std::uint32_t tick() const { return tick_; }
+    // Empreinte FNV-1a de tout l'état simulé (hors joueur automatique)
+    std::uint64_t stateHash() const;
+    const GameSetup& setup() const { return setup_; }
+
+    const GridMap&    map()    const { return map_; }
+    const World&      world()  const { return world_; }
+    const GameResult& result() const { return result_; }
+    int               lives()  const { return lives_; }
+    std::uint32_t     gold()   const { return gold_; }
+    int               wave()   const { return wave_; }
+
+private:
+    enum class Phase : std::uint8_t { Build, Wave };
+
+    GameSetup        setup_;
+    JobSystem*       jobs_   = nullptr;
+    DifficultyPreset preset_ = DifficultyPreset::Runtime; // des prochains ennemis
+    Rng              botRng_; // joueur automatique : hors état simulé
+    GridMap          map_;
+    FlowFieldSet     fields_;
+    World            world_;
+    SpatialGrid      grid_;
+
+    // Politique sous laquelle tous les ennemis du terrain sont apparus :
+    // boucles spécialisées tant qu'elle est commune, tableaux par ennemi
+    // (fieldMixed_) après un retune en pleine vague, jusqu'au terrain vide.
+    // Mêmes valeurs que e.speed/e.reward : hors empreinte d'état.
+    DifficultyPreset fieldPreset_ = DifficultyPreset::Runtime;
+    RuntimePolicy    fieldRuntime_;
+    bool             fieldMixed_  = false;
+
+    Phase         phase_     = Phase::Build;
+    float         phaseTime_ = 0.f;
+    std::uint32_t tick_      = 0;
+    int           wave_      = 0;  // vague en cours (1..maxWaves)
+    float         waveHp_    = 0.f; // pv des ennemis de la vague (croissance itérée, sans pow)
+    int           toSpawn_   = 0;
+    float         spawnTimer_ = 0.f;
+    std::uint32_t nextSpawn_ = 0;
+    int           lives_     = 0;
+    std::uint32_t gold_      = 0;
+    bool          over_      = false;
+    bool          botPending_ = true; // le joueur automatique doit construire
+    GameResult    result_;
+
+    std::vector<GameCommand>                 pending_;
+    std::function<void(const GameCommand&)>  sink_;
+
+    // Tampons par tick
+    std::vector<Handle>    arrived_, killed_;
+    std::vector<DamageHit> hits_;
+    std::vector<std::uint8_t> onPath_;
+
+    void setupMap(const GridMap* premade);
+    void startWave();
+    void spawnEnemies();
+    // Phase de vague d'un tick (après les apparitions), spécialisée par Tuning
+    template <class Tuning> void stepWave(const Tuning& tuning);
+    void fireTowers();
+    void runAutoPlayer();
+    void markPaths();
+    bool apply(const GameCommand& cmd);
+    std::size_t towerAt(int x, int y) const;
+};
+
+// Vitesse et récompense d'une politique de difficulté, les mêmes pour tous
+// les ennemis apparus sous elle (Tuning des systèmes d'ennemis, voir
+// Systems.hpp) : constantes pour les presets, rien à lire par ennemi
+template <class Policy>
+struct EnemyTuning {
+    Policy policy;
+
+    float speed(const EnemyStore&, std::size_t) const { return Game::kEnemySpeed * policy.speed; }
+    std::uint32_t reward(const EnemyStore&, std::size_t) const {
+        // lround, mais évaluable à la compilation
+        const float r = static_cast<float>(Game::kEnemyReward) * policy.reward;
+        return r <= 0.f ? 0u : static_cast<std::uint32_t>(static_cast<double>(r) + 0.5);
+    }
+};
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Cellule de la grille (coordonnées entières)
+struct Cell {
+    int x = 0, y = 0;
+    friend bool operator==(const Cell&, const Cell&) = default;
+};
+
+// Carte en grille : cellules libres/bloquées + points d'apparition et sorties.
+// Une entité en (px, py) (unités de cellule) occupe la cellule (floor(px), floor(py)).
+struct GridMap {
+    int width  = 0;
+    int height = 0;
+    std::vector<std::uint8_t> blocked; // 1 = obstacle ou tour
+    std::vector<Cell> spawns;
+    std::vector<Cell> exits;
+
+    GridMap() = default;
+    GridMap(int w, int h) : width(w), height(h), blocked(static_cast<std::size_t>(w) * h, 0) {}
+
+    std::size_t cellCount() const { return blocked.size(); }
+    bool inBounds(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+    std::uint32_t index(int x, int y) const { return static_cast<std::uint32_t>(y * width + x); }
+    std::uint32_t index(Cell c) const { return index(c.x, c.y); }
+    Cell cellAt(std::uint32_t idx) const { return Cell{static_cast<int>(idx % width), static_cast<int>(idx / width)}; }
+
+    bool passable(int x, int y) const { return inBounds(x, y) && !blocked[index(x, y)]; }
+    bool passable(Cell c) const { return passable(c.x, c.y); }
+};
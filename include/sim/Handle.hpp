@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Handle stable vers une entité : index de slot + génération.
+// Une entité détruite puis recréée dans le même slot change de génération,
+// donc un vieux handle ne résout plus (pas de "use after free" logique).
+struct Handle {
+    static constexpr std::uint32_t kInvalid = 0xFFFFFFFFu;
+
+    std::uint32_t index      = kInvalid;
+    std::uint32_t generation = 0;
+
+    bool valid() const { return index != kInvalid; }
+    friend bool operator==(const Handle&, const Handle&) = default;
+};
+
+// Table slots <-> indices denses. Les données vivent dans des tableaux
+// contigus (SoA) indexés par l'index dense ; la table garantit que
+// [0, size()) est toujours compact (swap-and-pop à la destruction).
+class HandleTable {
+public:
+    // Nouvelle entité, placée en fin de tableau dense (index = size() - 1)
+    Handle create();
+
+    // Détruit h. dst = index dense libéré ; le dernier élément dense y est
+    // déplacé, les tableaux SoA doivent faire arr[dst] = arr.back(); arr.pop_back().
+    bool destroy(Handle h, std::uint32_t& dst);
+
+    bool          alive(Handle h) const { return denseIndex(h) != Handle::kInvalid; }
+    std::uint32_t denseIndex(Handle h) const;          // kInvalid si mort/périmé
+    Handle        handleAt(std::uint32_t dense) const; // handle de l'élément dense
+
+    std::uint32_t size() const { return static_cast<std::uint32_t>(denseToSlot_.size()); }
+    void reserve(std::size_t n);
+    void clear();
+
+private:
+    struct Slot {
+        std::uint32_t dense;      // index dense si vivant, sinon slot libre suivant
+        std::uint32_t generation;
+    };
+
+    std::vector<Slot>          slots_;
+    std::vector<std::uint32_t> denseToSlot_;
+    std::uint32_t              freeHead_ = Handle::kInvalid;
+};
+
+// Swap-and-pop sur plusieurs tableaux SoA en une fois
+template <class... Arrays>
+void swapPop(std::uint32_t dst, Arrays&... arrays) {
+    ((arrays[dst] = arrays.back(), arrays.pop_back()), ...);
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Ordonnanceur de tâches à vol de travail. Chaque participant (l'appelant,
+// puis les threads de travail) a sa file : il empile et dépile ses tâches
+// par l'arrière (les plus récentes, encore en cache), les autres volent par
+// l'avant quand la leur est vide. Une tâche ne part qu'une fois toutes ses
+// dépendances terminées ; wait() et parallelFor() exécutent d'autres tâches
+// en attendant au lieu de dormir.
+//
+// Un seul thread extérieur (celui qui possède le JobSystem) soumet et
+// attend ; les tâches peuvent elles-mêmes en soumettre (parallelFor
+// imbriqué). Avec threads = 1, rien n'est lancé en parallèle : les tâches
+// s'exécutent dans wait(), les plus récemment prêtes d'abord (LIFO sur la
+// file de l'appelant), dépendances toujours respectées. Ne pas compter sur
+// l'ordre de soumission.
+//
+// Déterminisme : l'ordre d'exécution varie d'une fois à l'autre ; c'est aux
+// tâches d'écrire des sorties disjointes (par index, par tranche) pour que
+// le résultat ne dépende ni du nombre de threads ni du vol.
+class JobSystem {
+public:
+    class Job;
+    using JobHandle = std::shared_ptr<Job>;
+
+    // threads : participants, appelant compris (0 : un par cœur)
+    explicit JobSystem(unsigned threads = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned threads() const { return static_cast<unsigned>(queues_.size()); }
+
+    // Tâche lancée quand toutes ses dépendances sont terminées (les handles
+    // vides sont ignorés)
+    JobHandle add(std::function<void()> fn, std::initializer_list<JobHandle> deps = {});
+    JobHandle add(std::function<void()> fn, const std::vector<JobHandle>& deps);
+    // Revient quand la tâche est terminée (en exécutant d'autres tâches)
+    void wait(const JobHandle& job);
+    static bool done(const JobHandle& job);
+
+    // f(begin, end) sur des tranches de [0, n) d'au plus `grain` indices,
+    // coupées en deux récursivement : une moitié reste, l'autre peut être
+    // volée. Avec un seul thread, f(0, n) d'un bloc. Revient quand tout est fait.
+    void parallelFor(std::size_t n, std::size_t grain, const std::function<void(std::size_t, std::size_t)>& f);
+
+    struct Stats {
+        std::uint64_t executed = 0; // tâches exécutées
+        std::uint64_t stolen   = 0; // dont prises dans la file d'un autre
+    };
+    Stats stats() const;
+
+private:
+    struct Queue {
+        std::mutex            mutex;
+        std::deque<JobHandle> jobs;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_; // [0] : thread propriétaire
+    std::vector<std::thread>            threads_;
+
+    std::mutex              sleepMutex_;
+    std::condition_variable sleepCv_;
+    std::atomic<int>        queued_{0}; // tâches prêtes dans les files
+    bool                    stop_ = false;
+
+    std::atomic<std::uint64_t> executed_{0}, stolen_{0};
+
+    unsigned  selfIndex() const;
+    void      push(JobHandle job);
+    JobHandle take(unsigned self, bool& stolen);
+    bool      runOne();
+    void      execute(const JobHandle& job);
+    void      workerLoop(unsigned index);
+    template <class Pred> void helpUntil(Pred&& pred);
+    void      split(std::size_t begin, std::size_t end, std::size_t grain,
+                    const std::function<void(std::size_t, std::size_t)>& f, std::atomic<std::size_t>& left);
+    template <class Range> JobHandle addJob(std::function<void()> fn, const Range& deps);
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Lecteur/écrivain JSON minimal pour les fichiers de config/ et les index
+// générés (pas de dépendance externe). Les objets gardent l'ordre du fichier.
+class JsonValue {
+public:
+    enum class Type : std::uint8_t { Null, Bool, Number, String, Array, Object };
+    using Member = std::pair<std::string, JsonValue>;
+
+    JsonValue() = default;
+
+    Type type() const { return type_; }
+    bool isNull()   const { return type_ == Type::Null; }
+    bool isBool()   const { return type_ == Type::Bool; }
+    bool isNumber() const { return type_ == Type::Number; }
+    bool isString() const { return type_ == Type::String; }
+    bool isArray()  const { return type_ == Type::Array; }
+    bool isObject() const { return type_ == Type::Object; }
+
+    // Accès tolérants : valeur par défaut si le type ne correspond pas
+    bool        asBool(bool fallback = false) const     { return isBool() ? bool_ : fallback; }
+    double      asNumber(double fallback = 0.0) const  { return isNumber() ? number_ : fallback; }
+    const std::string& asString() const                { return string_; }
+
+    const std::vector<JsonValue>& items()   const { return items_; }   // tableau
+    const std::vector<Member>&    members() const { return members_; } // objet
+
+    // Membre d'un objet (nullptr si absent ou si ce n'est pas un objet)
+    const JsonValue* find(std::string_view key) const;
+    double number(std::string_view key, double fallback) const;
+    bool   boolean(std::string_view key, bool fallback) const;
+
+    // --- Construction
+    static JsonValue makeBool(bool b);
+    static JsonValue makeNumber(double d);
+    static JsonValue makeString(std::string s);
+    static JsonValue makeArray();
+    static JsonValue makeObject();
+    void push(JsonValue v);                          // tableau
+    void set(std::string key, JsonValue v);          // objet (remplace si présent)
+
+private:
+    Type                   type_   = Type::Null;
+    bool                   bool_   = false;
+    double                 number_ = 0.0;
+    std::string            string_;
+    std::vector<JsonValue> items_;
+    std::vector<Member>    members_;
+};
+
+// Retourne false (et un message dans `error`) si le texte n'est pas du JSON valide
+bool parseJson(std::string_view text, JsonValue& out, std::string* error = nullptr);
+bool loadJsonFile(const std::string& path, JsonValue& out, std::string* error = nullptr);
+
+// Sérialise v ; indent < 0 : sur une seule ligne
+std::string writeJson(const JsonValue& v, int indent = 2);
@@ -0,0 +1,122 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Classement local : un journal binaire en ajout seul (un score = un
+// enregistrement écrit d'un coup, sur le disque (fsync) avant que submit
+// rende la main) et un index en mémoire reconstruit à l'ouverture. Un arrêt
+// pendant une écriture ne laisse qu'une fin d'enregistrement incomplète,
+// coupée à la réouverture. Un enregistrement abîmé au milieu ne coûte que
+// lui : les suivants sont relus, le journal réécrit sans lui et l'original
+// gardé en .bad. Rien n'est jamais réécrit en place.
+//
+//   "TDLB" u8 version | { u32 taille | u32 FNV-1a | varint score, waves,
+//   seed | zigzag time | varint n, difficulté | varint n, nom }*
+//
+// Remplace config/scores.json (migrateScoresJson), qu'il fallait relire et
+// réécrire en entier à chaque score.
+
+struct ScoreEntry {
+    std::string   name;
+    std::string   difficulty;
+    std::uint64_t score = 0;
+    std::uint32_t waves = 0;
+    std::uint64_t seed  = 0;
+    std::int64_t  time  = 0; // secondes depuis l'époque Unix
+};
+
+// Un enregistrement (taille, FNV-1a, champs) ajouté à out ; aussi utilisé
+// par le protocole du serveur de classement
+void encodeScore(const ScoreEntry& e, std::vector<std::uint8_t>& out);
+// Enregistrement complet et intact en p (avancé derrière), sinon false
+bool decodeScore(const std::uint8_t*& p, const std::uint8_t* end, ScoreEntry& e);
+
+// Un arbre (treap) par difficulté, trié par score décroissant puis par ordre
+// d'arrivée ; chaque nœud connaît la taille de son sous-arbre. Insertion,
+// rang et début du top en O(log n).
+class ScoreIndex {
+public:
+    void clear();
+    void reserve(std::size_t n) { nodes_.reserve(n); }
+
+    // id = ordre d'arrivée (0, 1, 2...) : un nœud par id
+    void insert(std::uint32_t id, std::uint16_t difficulty, std::uint64_t score);
+    // Place qu'obtiendrait ce score : 1 + nombre de scores strictement meilleurs
+    std::size_t rank(std::uint16_t difficulty, std::uint64_t score) const;
+    std::size_t count(std::uint16_t difficulty) const;
+    // Ids des n meilleurs, du premier au n-ième
+    void top(std::uint16_t difficulty, std::size_t n, std::vector<std::uint32_t>& out) const;
+
+private:
+    static constexpr std::uint32_t kNil = 0xFFFFFFFFu;
+    struct Node {
+        std::uint64_t score = 0;
+        std::uint32_t left  = kNil;
+        std::uint32_t right = kNil;
+        std::uint32_t size  = 1;
+        std::uint32_t prio  = 0;
+    };
+    std::vector<Node>          nodes_; // par id
+    std::vector<std::uint32_t> roots_; // par difficulté
+
+    std::uint32_t size(std::uint32_t t) const { return t == kNil ? 0 : nodes_[t].size; }
+    bool before(std::uint32_t a, std::uint32_t b) const {
+        return nodes_[a].score > nodes_[b].score || (nodes_[a].score == nodes_[b].score && a < b);
+    }
+    // Coupe le sous-arbre t : nœuds classés avant key à gauche, les autres à droite
+    void split(std::uint32_t t, std::uint32_t key, std::uint32_t& l, std::uint32_t& r);
+};
+
+class Leaderboard {
+public:
+    // La compaction automatique attend au moins autant de scores à écarter
+    // que de scores gardés, et au moins kMinCompactRecords
+    static constexpr std::size_t kMinCompactRecords = 4096;
+
+    // keepPerDifficulty : scores gardés par difficulté à la compaction (0 : tous)
+    explicit Leaderboard(std::size_t keepPerDifficulty = 0) : keep_(keepPerDifficulty) {}
+
+    // Relit le journal (créé s'il manque) et reconstruit l'index
+    bool open(const std::string& path);
+    void close() { out_.close(); }
+    bool isOpen() const { return out_.is_open(); }
+
+    // Écrit au journal (sur le disque avant de rendre la main) puis indexé
+    bool submit(const ScoreEntry& e);
+    // Une seule écriture pour tous (migration)
+    bool submit(const std::vector<ScoreEntry>& entries);
+
+    std::vector<const ScoreEntry*> top(const std::string& difficulty, std::size_t n) const;
+    std::size_t rank(const std::string& difficulty, std::uint64_t score) const;
+    std::size_t count(const std::string& difficulty) const;
+    std::size_t size() const { return entries_.size(); }
+
+    // Réécrit le journal avec les scores gardés, dans l'ordre du classement
+    // (fichier temporaire synchronisé puis renommage : l'ancien reste valide
+    // jusque-là)
+    bool compact();
+
+private:
+    std::string                path_;
+    std::ofstream              out_;
+    std::size_t                keep_;
+    std::vector<ScoreEntry>    entries_;      // par id
+    std::vector<std::string>   difficulties_; // id de difficulté -> nom
+    ScoreIndex                 index_;
+    std::vector<std::uint8_t>  buf_;
+
+    int  difficultyId(const std::string& name) const; // -1 si inconnue
+    void add(ScoreEntry e);
+    bool append();
+    // Remplace le journal par ces scores (.tmp, fsync, renommage, fsync du dossier)
+    bool writeLog(const std::vector<ScoreEntry>& entries);
+    // Après chaque ajout, quel que soit le chemin (un score ou un lot)
+    void compactIfNeeded();
+    std::size_t kept() const;
+};
+
+// Reprend un ancien { "scores": [{ name, difficulty, score, waves, seed, time }] }
+// dans le classement. Retourne le nombre de scores repris (-1 : fichier illisible).
+int migrateScoresJson(const std::string& jsonPath, Leaderboard& board);
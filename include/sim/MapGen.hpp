@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sim/GridMap.hpp"
+
+// Génération procédurale de carte depuis une graine : spawns sur le bord
+// gauche, sorties sur les bords droit, haut ou bas, obstacles tirés case par
+// case. Une carte n'est acceptée que si chaque spawn rejoint une sortie
+// (l'invariant que forbidTotalBlock garde ensuite à la pose des tours) par
+// un chemin d'au moins minPathLength cases.
+//
+// Le candidat n° i ne dépend que de (graine, i) : les candidats se tirent et
+// se valident en parallèle, sans verrou, et la carte retenue est toujours le
+// plus petit i valide. Même graine = même carte, quel que soit le nombre de
+// threads.
+
+struct MapGenParams {
+    int width           = 32;
+    int height          = 20;
+    int minSpawns       = 1, maxSpawns = 2;
+    int minExits        = 1, maxExits  = 2;
+    int obstaclePercent = 12;
+    int minPathLength   = -1; // cases (4-voisinage) ; < 0 : (width + height) / 2
+    int maxAttempts     = 64; // au-delà, carte de repli sans obstacle
+
+    int pathLength() const { return minPathLength >= 0 ? minPathLength : (width + height) / 2; }
+    // Empreinte des paramètres (clé du cache avec la graine)
+    std::uint32_t hash() const;
+};
+
+struct MapGenStats {
+    std::uint32_t candidates = 0; // tirés et validés
+    std::uint32_t rejected   = 0;
+    std::uint32_t attempt    = 0; // indice du candidat retenu
+};
+
+// Candidat n° attempt (non validé)
+GridMap generateCandidate(const MapGenParams& params, std::uint64_t seed, std::uint32_t attempt);
+
+// Tampons de validation, réutilisés d'un candidat à l'autre
+struct MapCheckScratch {
+    std::vector<std::uint32_t> dist, queue;
+};
+
+// Connexité et longueur minimale en une seule passe : BFS depuis toutes les
+// sorties, arrêté dès que tous les spawns sont atteints ou qu'un spawn est
+// trop proche. Retourne le plus court chemin spawn -> sortie (-1 : rejetée).
+int validateMap(const GridMap& map, int minPathLength, MapCheckScratch& scratch);
+
+// Plus petit candidat valide (threads = 0 : un par cœur, 1 : sur l'appelant).
+// false si aucun candidat ne passe : out reçoit alors la carte de repli
+// (spawns à gauche, sorties à droite, sans obstacle).
+bool generateMap(const MapGenParams& params, std::uint64_t seed, GridMap& out,
+                 MapGenStats* stats = nullptr, unsigned threads = 1);
+
+// Cartes déjà générées, une par (graine, paramètres), dans un dossier :
+//   "TDMP" u8 version | u64 seed | u32 paramsHash | u16 w, h |
+//   u8 n, (u16 x, u16 y)* spawns | u8 n, (u16 x, u16 y)* exits |
+//   obstacles (1 bit par case) | u64 FNV-1a de ce qui précède
+// Un fichier illisible ou d'une autre version est ignoré (et régénéré).
+class MapCache {
+public:
+    explicit MapCache(std::string dir) : dir_(std::move(dir)) {}
+
+    bool load(const MapGenParams& params, std::uint64_t seed, GridMap& out) const;
+    // Écrit dans un fichier temporaire puis renomme : jamais de fichier à moitié écrit
+    bool store(const MapGenParams& params, std::uint64_t seed, const GridMap& map) const;
+
+    // Depuis le cache, sinon générée puis mise en cache (sauf la carte de
+    // repli, retentée à chaque appel) ; hit = trouvée en cache
+    GridMap loadOrGenerate(const MapGenParams& params, std::uint64_t seed, unsigned threads = 0,
+                           bool* hit = nullptr) const;
+
+    std::string pathFor(const MapGenParams& params, std::uint64_t seed) const;
+
+private:
+    std::string dir_;
+};
+
+void encodeMap(const GridMap& map, std::uint64_t seed, std::uint32_t paramsHash, std::vector<std::uint8_t>& out);
+bool decodeMap(const std::uint8_t* data, std::size_t size, std::uint64_t seed, std::uint32_t paramsHash, GridMap& out);
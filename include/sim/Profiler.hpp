@@ -0,0 +1,121 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Profileur CPU à portées : PROFILE_SCOPE("Menu::draw") mesure la portée
+// englobante et l'écrit dans le tampon circulaire du thread courant (ni
+// verrou ni allocation à l'enregistrement, hors création du tampon au premier
+// événement du thread ; il est rendu à la sortie du thread, ses derniers
+// événements gardés). Désactivé, une portée coûte la lecture d'un booléen ;
+// compilé avec TD_PROFILE=0, rien du tout.
+// Les portées s'imbriquent (profondeur gardée) ; les événements se relisent
+// pour l'overlay ou s'écrivent en trace Chrome (chrome://tracing, Perfetto).
+
+#ifndef TD_PROFILE
+#define TD_PROFILE 1
+#endif
+
+struct ProfileEvent {
+    const char*   name    = nullptr; // littéral (regroupé par texte)
+    std::int64_t  startNs = 0;       // depuis le lancement du programme
+    std::int64_t  durNs   = 0;
+    std::uint32_t thread  = 0;       // index d'enregistrement du thread
+    std::uint32_t depth   = 0;       // 0 = portée la plus externe
+};
+
+// Temps cumulé d'une portée sur un lot d'événements
+struct ScopeStat {
+    const char*   name    = nullptr;
+    double        totalMs = 0.0; // portée entière (enfants compris)
+    double        selfMs  = 0.0; // hors portées enfants
+    double        maxMs   = 0.0;
+    std::uint32_t calls   = 0;
+};
+
+class Profiler {
+public:
+    static constexpr std::size_t kRingSize = std::size_t{1} << 16; // événements gardés par thread
+
+    static void setEnabled(bool on) { enabled_.store(on, std::memory_order_relaxed); }
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    static std::int64_t nowNs();
+
+    // Nom du thread courant dans la trace (sinon "thread N") ; n'alloue pas de tampon
+    static void setThreadName(const std::string& name);
+
+    // Événements encore dans les tampons, commencés à partir de sinceNs et
+    // après le dernier clear(), tous threads, triés par début
+    static std::vector<ProfileEvent> collect(std::int64_t sinceNs = 0);
+    static void clear();
+
+    // Temps par nom de portée, trié par temps total décroissant (n premiers)
+    static std::vector<ScopeStat> topScopes(const std::vector<ProfileEvent>& events, std::size_t n);
+
+    // Trace Chrome (événements "X" en µs, un tid par thread enregistré)
+    static void writeChromeTrace(std::ostream& os, const std::vector<ProfileEvent>& events);
+    static bool writeChromeTrace(const std::string& path);
+
+    class Scope {
+    public:
+        explicit Scope(const char* name) : name_(enabled() ? name : nullptr) {
+            if (name_) start_ = enter();
+        }
+        ~Scope() {
+            if (name_) leave(name_, start_);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char*  name_;
+        std::int64_t start_ = 0;
+    };
+
+private:
+    static std::atomic<bool> enabled_;
+
+    static std::int64_t enter();
+    static void         leave(const char* name, std::int64_t startNs);
+};
+
+#if TD_PROFILE
+#define TD_PROFILE_CAT2(a, b) a##b
+#define TD_PROFILE_CAT(a, b)  TD_PROFILE_CAT2(a, b)
+#define PROFILE_SCOPE(name)   Profiler::Scope TD_PROFILE_CAT(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name)   ((void)0)
+#endif
+
+// Historique des temps de frame (ms) et 99e centile glissant, pour le graphe
+// de l'overlay. Capacité fixe : pas d'allocation par frame.
+class FrameTimes {
+public:
+    static constexpr std::size_t kHistory = 240; // frames affichées
+    static constexpr std::size_t kWindow  = 120; // fenêtre du centile glissant
+
+    void push(float ms);
+
+    std::size_t size() const { return count_; }
+    // i = 0 : la plus ancienne gardée
+    float frame(std::size_t i) const { return frames_[(head_ + kHistory - count_ + i) % kHistory]; }
+    float p99(std::size_t i)   const { return p99_[(head_ + kHistory - count_ + i) % kHistory]; }
+    float last()    const { return count_ ? frame(count_ - 1) : 0.f; }
+    float lastP99() const { return count_ ? p99(count_ - 1) : 0.f; }
+    float average() const;
+
+    // Centile p (0..1) des n dernières frames
+    float percentile(float p, std::size_t n) const;
+
+private:
+    std::array<float, kHistory> frames_{};
+    std::array<float, kHistory> p99_{};
+    std::size_t head_  = 0; // prochaine case écrite
+    std::size_t count_ = 0;
+    mutable std::array<float, kHistory> scratch_{};
+};
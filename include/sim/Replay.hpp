@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "sim/Game.hpp"
+
+// Journal d'entrées binaire d'une partie : la config de départ, puis une
+// commande par enregistrement (type + delta de tick + case, en varints),
+// puis le tick final et l'empreinte d'état attendue.
+//
+//   "TDRP" u8 version | setup | { u8 type, varint dTick, u8 arg, zigzag x, zigzag y }*
+//   u8 0xFF | varint finalTick | u64 finalHash
+//
+// Une commande typique tient en 4-5 octets.
+
+struct ReplayLog {
+    GameSetup                setup;
+    std::vector<GameCommand> commands;  // triées par tick (ordre d'application)
+    std::uint32_t            finalTick = 0;
+    std::uint64_t            finalHash = 0;
+};
+
+void encodeReplay(const ReplayLog& log, std::vector<std::uint8_t>& out);
+bool decodeReplay(const std::uint8_t* data, std::size_t size, ReplayLog& out);
+
+bool writeReplay(const std::string& path, const ReplayLog& log);
+bool readReplay(const std::string& path, ReplayLog& out);
+
+// Écrit le journal pendant la partie : en-tête à l'ouverture, commandes au fil
+// de l'eau (tampon vidé toutes les kFlushBytes), pied à finish().
+class ReplayRecorder {
+public:
+    static constexpr std::size_t kFlushBytes = 4096;
+
+    bool open(const std::string& path, const GameSetup& setup);
+    void record(const GameCommand& cmd);
+    bool finish(std::uint32_t finalTick, std::uint64_t finalHash);
+    bool isOpen() const { return out_.is_open(); }
+
+    ~ReplayRecorder();
+
+private:
+    std::ofstream             out_;
+    std::vector<std::uint8_t> buf_;
+    std::uint32_t             lastTick_ = 0;
+
+    void flush();
+};
+
+struct ReplayCheck {
+    bool          ok           = false;
+    std::uint32_t ticks        = 0;
+    std::uint64_t expectedHash = 0;
+    std::uint64_t actualHash   = 0;
+};
+
+// Rejoue le journal sans joueur automatique, aussi vite que possible, et
+// compare l'empreinte d'état au tick final
+ReplayCheck verifyReplay(const ReplayLog& log);
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+
+// Générateur pseudo-aléatoire déterministe (PCG32) : même graine = même
+// suite sur toutes les plateformes, contrairement aux distributions de <random>.
+class Rng {
+public:
+    explicit Rng(std::uint64_t seed = 1, std::uint64_t stream = 0x9E3779B97F4A7C15ull) {
+        inc_ = (stream << 1u) | 1u;
+        next();
+        state_ += seed;
+        next();
+    }
+
+    std::uint32_t next() {
+        const std::uint64_t old = state_;
+        state_ = old * 6364136223846793005ull + inc_;
+        const std::uint32_t xorshifted = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const std::uint32_t rot        = static_cast<std::uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+    }
+
+    // Entier dans [0, bound) sans biais
+    std::uint32_t below(std::uint32_t bound) {
+        if (bound == 0) return 0;
+        const std::uint32_t threshold = (0u - bound) % bound;
+        for (;;) {
+            const std::uint32_t r = next();
+            if (r >= threshold) return r % bound;
+        }
+    }
+
+    // Entier dans [lo, hi]
+    int range(int lo, int hi) {
+        return lo + static_cast<int>(below(static_cast<std::uint32_t>(hi - lo + 1)));
+    }
+
+    // Flottant dans [0, 1) (24 bits de mantisse)
+    float uniform() { return static_cast<float>(next() >> 8) * (1.f / 16777216.f); }
+
+    // État interne (empreinte de l'état de simulation)
+    std::uint64_t state() const { return state_; }
+
+private:
+    std::uint64_t state_ = 0;
+    std::uint64_t inc_   = 0;
+};
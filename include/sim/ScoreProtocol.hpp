@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sim/Leaderboard.hpp"
+#include "sim/Rng.hpp"
+
+// Protocole du serveur de classement (TCP, td_leaderboard_server) :
+//   u32 taille (type + corps) | u8 type | corps
+// Submit    : varint n | n scores (encodeScore, comme le journal)
+// SubmitAck : varint n acceptés
+// TopQuery  : varint n | varint len, difficulté
+// TopReply  : varint total | varint len, difficulté | varint n | n scores
+// Les réponses arrivent dans l'ordre des requêtes de la connexion.
+
+enum class ScoreMessage : std::uint8_t { Submit = 1, SubmitAck = 2, TopQuery = 3, TopReply = 4 };
+
+constexpr unsigned short kScoreServerPort = 47800;
+constexpr std::uint32_t  kMaxScoreMessage = 1u << 20; // au-delà : connexion fermée
+constexpr std::uint32_t  kMaxTopQuery     = 1000;     // scores par TopReply
+
+void encodeSubmit(const ScoreEntry* entries, std::size_t count, std::vector<std::uint8_t>& out);
+void encodeSubmitAck(std::uint32_t accepted, std::vector<std::uint8_t>& out);
+void encodeTopQuery(const std::string& difficulty, std::uint32_t n, std::vector<std::uint8_t>& out);
+void encodeTopReply(const std::string& difficulty, std::uint64_t total,
+                    const std::vector<const ScoreEntry*>& top, std::vector<std::uint8_t>& out);
+
+// Message reçu (pointe dans le MessageBuffer, valable jusqu'au prochain append)
+struct ScoreMessageView {
+    ScoreMessage        type = ScoreMessage::Submit;
+    const std::uint8_t* body = nullptr;
+    std::size_t         size = 0;
+};
+
+bool decodeSubmit(const ScoreMessageView& m, std::vector<ScoreEntry>& out);
+bool decodeSubmitAck(const ScoreMessageView& m, std::uint32_t& accepted);
+bool decodeTopQuery(const ScoreMessageView& m, std::string& difficulty, std::uint32_t& n);
+bool decodeTopReply(const ScoreMessageView& m, std::string& difficulty, std::uint64_t& total,
+                    std::vector<ScoreEntry>& out);
+
+// Octets reçus par morceaux (sockets non bloquants) -> messages complets
+class MessageBuffer {
+public:
+    void append(const void* data, std::size_t size);
+    // Prochain message complet ; false s'il manque des octets ou si la trame
+    // est invalide (error() : la connexion est à fermer)
+    bool next(ScoreMessageView& out);
+    bool error() const { return error_; }
+    void clear() { data_.clear(); head_ = 0; error_ = false; }
+
+private:
+    std::vector<std::uint8_t> data_;
+    std::size_t               head_  = 0; // début du prochain message
+    bool                      error_ = false;
+};
+
+// Attente avant la n-ième nouvelle tentative (n >= 1) : double à chaque
+// échec jusqu'à maxMs, tirée dans [d/2, d] pour que des clients tombés
+// ensemble ne reviennent pas ensemble
+struct Backoff {
+    std::uint32_t baseMs = 250;
+    std::uint32_t maxMs  = 30'000;
+
+    std::uint32_t delayMs(std::uint32_t attempt, Rng& rng) const;
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sim/Systems.hpp"
+
+// Noyaux vectoriels des boucles les plus chaudes (déplacement le long d'un
+// chemin, intégration et impacts des projectiles). Le niveau est choisi au
+// lancement d'après le CPU (TD_SIMD=scalar|sse4.1|avx2 pour le plafonner) ;
+// tous donnent des résultats identiques bit à bit au scalaire : mêmes
+// opérations IEEE dans le même ordre, sans FMA. Les replays restent donc
+// valables d'une machine à l'autre.
+
+enum class SimdLevel : std::uint8_t {
+    Scalar = 0,
+    Sse41  = 1, // 4 voies
+    Avx2   = 2, // 8 voies, gathers
+};
+
+const char* simdName(SimdLevel level);
+int         simdLanes(SimdLevel level);
+
+// Meilleur niveau que le CPU (et l'OS) supporte
+SimdLevel detectSimd();
+// Niveau utilisé par les systèmes
+SimdLevel simdLevel();
+// Force un niveau (tests, benchmarks) ; plafonné à detectSimd(). Retourne le niveau retenu.
+SimdLevel setSimdLevel(SimdLevel level);
+
+// Table de noyaux d'un niveau. Chacun traite tout le tableau (la queue,
+// n % voies, en scalaire) et a le contrat de la fonction de Systems.hpp
+// correspondante.
+struct SimdKernels {
+    SimdLevel level;
+    // Positions += vitesses * dt, ttl -= dt (sans le compactage)
+    void (*integrate)(float* posX, float* posY, const float* velX, const float* velY, float* ttl,
+                      std::size_t n, float dt);
+    void (*moveAlongPath)(EnemyStore& e, const Path& path, float dt, std::vector<Handle>* arrived);
+    void (*resolveHits)(ProjectileStore& p, const EnemyStore& e, float hitRadius, std::vector<DamageHit>& hits);
+};
+
+const SimdKernels& simdKernels(SimdLevel level);
+inline const SimdKernels& simdKernels() { return simdKernels(simdLevel()); }
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sim/EntityStore.hpp"
+
+class JobSystem;
+
+// Grille de hachage uniforme (seaux) pour les requêtes de portée.
+// Reconstruite à chaque tick par tri par comptage : O(n), sans allocation
+// une fois les tampons dimensionnés. Les positions sont recopiées dans
+// l'ordre des seaux pour que les requêtes lisent de la mémoire contiguë.
+class SpatialGrid {
+public:
+    // Zone couverte [0, worldW) x [0, worldH) ; cellSize ~ portée typique d'une tour.
+    // Les entités hors zone sont rangées dans les seaux du bord.
+    void configure(float worldW, float worldH, float cellSize);
+
+    // Avec un JobSystem, comptage et dispersion par tranches de kRebuildChunk
+    // entités : même ordre dans les seaux qu'en série, quel que soit le
+    // nombre de threads
+    static constexpr std::size_t kRebuildChunk = 16384;
+    void rebuild(const float* x, const float* y, std::size_t n, JobSystem* jobs = nullptr);
+    void rebuild(const EnemyStore& e, JobSystem* jobs = nullptr) {
+        rebuild(e.posX.data(), e.posY.data(), e.size(), jobs);
+    }
+
+    // Appelle f(denseIndex, dist2) pour chaque entité à distance <= r de (x, y)
+    template <class F>
+    void forEachInRange(float x, float y, float r, F&& f) const;
+
+    // Variante qui remplit `out` avec les indices denses
+    void queryRange(float x, float y, float r, std::vector<std::uint32_t>& out) const;
+
+    std::size_t size() const { return items_.size(); }
+
+private:
+    float cellSize_ = 1.f;
+    float invCell_  = 1.f;
+    int   cols_ = 0, rows_ = 0;
+
+    std::vector<std::uint32_t> cellStart_;   // cols*rows + 1 (préfixes)
+    std::vector<std::uint32_t> items_;       // indices denses triés par seau
+    std::vector<float>         sx_, sy_;     // positions dans l'ordre des seaux
+    std::vector<std::uint32_t> cellOf_;      // seau de chaque entité (tampon)
+    std::vector<std::uint32_t> cursor_;      // position d'écriture par seau (tampon)
+    std::vector<std::uint32_t> chunkCursor_; // idem par (tranche, seau), en parallèle
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+};
+
+template <class F>
+void SpatialGrid::forEachInRange(float x, float y, float r, F&& f) const {
+    if (items_.empty()) return;
+    const int x0 = cellX(x - r), x1 = cellX(x + r);
+    const int y0 = cellY(y - r), y1 = cellY(y + r);
+    const float r2 = r * r;
+    for (int cy = y0; cy <= y1; ++cy) {
+        const std::size_t row = static_cast<std::size_t>(cy) * cols_;
+        // Les seaux d'une même ligne sont contigus : une seule plage
+        const std::uint32_t begin = cellStart_[row + x0];
+        const std::uint32_t end   = cellStart_[row + x1 + 1];
+        for (std::uint32_t k = begin; k < end; ++k) {
+            const float dx = sx_[k] - x;
+            const float dy = sy_[k] - y;
+            const float d2 = dx * dx + dy * dy;
+            if (d2 <= r2) f(items_[k], d2);
+        }
+    }
+}
+
+// Acquisition de cible pour toutes les tours en une passe : chaque tour
+// interroge la grille puis applique son mode (premier / plus proche / plus
+// fort). Écrit TowerStore::target (Handle invalide si rien à portée).
+// Avec un JobSystem, les tours sont réparties par tranches (chacune n'écrit
+// que sa cible).
+void acquireTargets(TowerStore& towers, const EnemyStore& enemies, const SpatialGrid& grid,
+                    JobSystem* jobs = nullptr);
+
+// Référence O(tours x ennemis), utilisée par les tests et les benchmarks
+void acquireTargetsBruteForce(TowerStore& towers, const EnemyStore& enemies);
@@ -0,0 +1,123 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "sim/EntityStore.hpp"
+#include "sim/FlowField.hpp"
+
+// Systèmes de simulation : fonctions libres qui parcourent les tableaux
+// SoA de façon linéaire. Aucun ne garde d'état entre deux ticks.
+
+// Chemin en polyligne (waypoints en unités de cellule)
+struct Path {
+    std::vector<float> x, y;
+    std::uint32_t size() const { return static_cast<std::uint32_t>(x.size()); }
+};
+
+struct DamageHit {
+    Handle target;
+    float  amount = 0.f;
+};
+
+// Avance chaque ennemi vers son waypoint courant. Ceux qui atteignent le
+// bout du chemin sont ajoutés à `arrived` (mais pas détruits).
+void moveEnemiesAlongPath(EnemyStore& e, const Path& path, float dt,
+                          std::vector<Handle>* arrived = nullptr);
+
+// Guidage par champ de flux : chaque ennemi lit la direction de sa cellule
+// dans le champ de sa sortie (goal) et se dirige vers le centre de la
+// cellule voisine indiquée. pathIdx reçoit l'index de la cellule courante.
+// Les ennemis sur leur sortie sont ajoutés à `arrived` (à retirer par l'appelant).
+void steerEnemiesByFlowField(EnemyStore& e, const FlowFieldSet& fields, float dt,
+                             std::vector<Handle>* arrived = nullptr);
+
+// Vitesse et récompense d'un ennemi : Tuning::speed(e, i), Tuning::reward(e, i).
+// PerEnemyTuning lit les tableaux (versions non gabarits) ; Game passe des
+// valeurs uniformes tirées de la politique de difficulté (DifficultyPolicy.hpp),
+// constantes de compilation pour les presets.
+struct PerEnemyTuning {
+    float         speed(const EnemyStore& e, std::size_t i) const { return e.speed[i]; }
+    std::uint32_t reward(const EnemyStore& e, std::size_t i) const { return e.reward[i]; }
+};
+template <class Tuning>
+void steerEnemiesByFlowField(EnemyStore& e, const FlowFieldSet& fields, float dt, const Tuning& tuning,
+                             std::vector<Handle>* arrived = nullptr);
+template <class Tuning>
+std::uint64_t removeDeadEnemies(EnemyStore& e, const Tuning& tuning, std::vector<Handle>* killed = nullptr);
+
+// Dégâts ciblés (les handles périmés sont ignorés)
+void applyHits(EnemyStore& e, const std::vector<DamageHit>& hits);
+// Dégâts de zone : un seul passage sur posX/posY/hp
+void applySplashDamage(EnemyStore& e, float x, float y, float radius, float amount);
+
+// Détruit les ennemis à hp <= 0 et retourne la somme de leurs récompenses
+std::uint64_t removeDeadEnemies(EnemyStore& e, std::vector<Handle>* killed = nullptr);
+
+void tickTowerCooldowns(TowerStore& t, float dt);
+
+// Projectiles à tête chercheuse : vitesse réorientée vers la position
+// courante de leur cible (inchangée si la cible a disparu)
+void steerProjectiles(ProjectileStore& p, const EnemyStore& e, float speed);
+// Intègre les projectiles puis détruit ceux dont le ttl est écoulé
+void integrateProjectiles(ProjectileStore& p, float dt);
+// Projectile à moins de hitRadius de sa cible : dégât émis + projectile détruit.
+// Cible disparue : le projectile est détruit sans effet.
+void resolveProjectileHits(ProjectileStore& p, const EnemyStore& e, float hitRadius,
+                           std::vector<DamageHit>& hits);
+
+// ============================
+//  Gabarits
+// ============================
+template <class Tuning>
+void steerEnemiesByFlowField(EnemyStore& e, const FlowFieldSet& fields, float dt, const Tuning& tuning,
+                             std::vector<Handle>* arrived) {
+    // Copie locale : le compilateur sait qu'elle ne vit pas dans les tableaux écrits
+    const Tuning      t = tuning;
+    const std::size_t n = e.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        const FlowField& f = fields.fields[e.goal[i]];
+        const int cx = static_cast<int>(std::floor(e.posX[i]));
+        const int cy = static_cast<int>(std::floor(e.posY[i]));
+        e.velX[i] = e.velY[i] = 0.f;
+        if (!f.inBounds(cx, cy)) continue;
+
+        e.pathIdx[i] = static_cast<std::uint32_t>(cy * f.width() + cx);
+        if (f.distance(cx, cy) == 0) {
+            if (arrived) arrived->push_back(e.ids.handleAt(static_cast<std::uint32_t>(i)));
+            continue;
+        }
+        const std::uint8_t d = f.direction(cx, cy);
+        if (d == FlowField::kNoDir) continue; // enfermé : attend une réparation du champ
+
+        const float tx   = static_cast<float>(cx + FlowField::kDirX[d]) + 0.5f;
+        const float ty   = static_cast<float>(cy + FlowField::kDirY[d]) + 0.5f;
+        const float dx   = tx - e.posX[i];
+        const float dy   = ty - e.posY[i];
+        const float dist = std::sqrt(dx * dx + dy * dy);
+        if (dist <= 0.f) continue;
+
+        const float speed = t.speed(e, i);
+        const float inv   = speed / dist;
+        e.velX[i] = dx * inv;
+        e.velY[i] = dy * inv;
+        e.posX[i] += e.velX[i] * dt;
+        e.posY[i] += e.velY[i] * dt;
+        e.progress[i] += speed * dt;
+    }
+}
+
+template <class Tuning>
+std::uint64_t removeDeadEnemies(EnemyStore& e, const Tuning& tuning, std::vector<Handle>* killed) {
+    const Tuning  t     = tuning;
+    std::uint64_t total = 0;
+    // Parcours à rebours : l'élément déplacé par swap-and-pop a déjà été vu
+    for (std::size_t i = e.size(); i-- > 0;) {
+        if (e.hp[i] > 0.f) continue;
+        const Handle h = e.ids.handleAt(static_cast<std::uint32_t>(i));
+        total += t.reward(e, i);
+        if (killed) killed->push_back(h);
+        e.destroy(h);
+    }
+    return total;
+}
@@ -1,109 +1,416 @@
 #include "App.hpp"
 #include "Menu.hpp"
+#include "ProfilerOverlay.hpp"
 
 #include <iostream>
-#include <cmath> // (facultatif)
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#ifndef TD_CONFIG_DIR
+#define TD_CONFIG_DIR "config"
+#endif
+#ifndef TD_FONT_BUNDLE
+#define TD_FONT_BUNDLE "fonts.tdfb"
+#endif
+
+namespace {
+// Budget mémoire du cache d'assets (TD_ASSET_BUDGET_MB=64 pour le réduire)
+std::size_t assetBudgetBytes(std::size_t fallback) {
+    const char* mb = std::getenv("TD_ASSET_BUDGET_MB");
+    if (!mb) return fallback;
+    return static_cast<std::size_t>(std::strtoull(mb, nullptr, 10)) << 20;
+}
+
+// Threads du JobSystem : TD_JOBS=n (1 : tout sur le thread principal), un par cœur par défaut
+unsigned jobThreads() {
+    const char* n = std::getenv("TD_JOBS");
+    return n ? static_cast<unsigned>(std::strtoul(n, nullptr, 10)) : 0u;
+}
+
+// Serveur de classement : TD_LEADERBOARD=hôte[:port] (127.0.0.1 par défaut, "off" pour s'en passer)
+std::unique_ptr<ScoreClient> makeScoreClient() {
+    const char* env = std::getenv("TD_LEADERBOARD");
+    std::string spec = env ? env : "127.0.0.1";
+    if (spec == "off") return nullptr;
+    unsigned short port = kScoreServerPort;
+    if (const auto colon = spec.find(':'); colon != std::string::npos) {
+        port = static_cast<unsigned short>(std::strtoul(spec.c_str() + colon + 1, nullptr, 10));
+        spec.resize(colon);
+    }
+    return std::make_unique<ScoreClient>(std::move(spec), port); // résolu par son thread
+}
+} // namespace
 
 App::App(int /*w*/, int /*h*/, const std::string& title)
-:  window_(sf::VideoMode::getDesktopMode(), title, sf::State::Fullscreen) {
-    // VSync pour éviter le tearing
-    window_.setVerticalSyncEnabled(true);
+:  window_(sf::VideoMode::getDesktopMode(), title, sf::State::Fullscreen),
+   jobs_(jobThreads()),
+   assets_(loader_, assetBudgetBytes(kDefaultAssetBudget)) {
+    // VSync pour éviter le tearing (TD_VSYNC=0 pour la couper, ex. tests de latence :
+    // la simulation à pas fixe rend le gameplay indépendant de la fréquence d'affichage)
+    const char* vsync = std::getenv("TD_VSYNC");
+    window_.setVerticalSyncEnabled(!(vsync && std::string(vsync) == "0"));
 
-    // --- Audio (chemins relatifs depuis build/ grâce au symlink CMake)
-    const char* menuPath = "assets/sounds/menu_theme.ogg";
-    const char* gamePath = "assets/sounds/game_theme.ogg";
+    // Profileur : avant tout chargement pour que TD_TRACE couvre le démarrage
+    Profiler::setThreadName("main");
+    profiler_ = std::make_unique<ProfilerOverlay>(assets_, text_);
+    if (const char* trace = std::getenv("TD_TRACE")) {
+        tracePath_ = trace;
+        profiler_->startCapture();
+    }
+
+    // Polices réduites (cible `fonts`) ; sinon les .ttf de assets/fonts
+    assets_.mountFontBundle(TD_FONT_BUNDLE);
+    // Police évincée : ses glyphes et mises en page partent avec elle
+    assets_.setFontEvicted([this](const sf::Font* font) { text_.clearFont(font); });
+
+    // --- Audio (via le cache, relatif à assets/), ouvert en arrière-plan :
+    //     chaque musique démarre à son arrivée si son état est actif
+    assets_.requestMusic("sounds/menu_theme.ogg", [this](AssetCache::MusicHandle m) {
+        if (!m) return;
+        musicMenu_ = std::move(m);
+        musicMenu_->setLooping(true);
+        if (state_ == State::Menu) startMenuMusic();
+    });
+    assets_.requestMusic("sounds/game_theme.ogg", [this](AssetCache::MusicHandle m) {
+        if (!m) return;
+        musicGame_ = std::move(m);
+        musicGame_->setLooping(true);
+        if (state_ == State::Playing) startGameMusic();
+    });
+
+    loadConfig();
+    leaderboard_.open("scores.tdlb", TD_CONFIG_DIR "/scores.json");
+    online_ = makeScoreClient(); // envoi seul : aucun écran n'affiche encore le top en ligne
+
+    // Shaders compilés par le loader (un par frame), puis le menu (ses
+    // assets arrivent aussi par le loader)
+    shaders_.compileAll(loader_);
+    menu_ = std::make_unique<Menu>(window_, assets_, shaders_, text_);
+
+    // Fermeture "hard" : servie avant tout état
+    input_.subscribe(InputSystem::Layer::System, [this](const InputEvent& e) {
+        if (!e.event.is<sf::Event::Closed>()) return false;
+        window_.close();
+        return true;
+    });
+    input_.subscribe(InputSystem::Layer::Overlay, [this](const InputEvent& e) {
+        return profiler_->handleEvent(e.event);
+    });
+    enterState(State::Menu);
+}
 
-    if (!musicMenu_.openFromFile(menuPath)) {
-        std::cerr << "[Audio] Failed to open " << menuPath << "\n";
+double App::msSinceStart() const {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime_).count();
+}
+
+App::~App() {
+    endGame();
+    // Compteurs de debug de l'étage d'entrée, par état
+    const char* names[] = {"Menu", "Playing"};
+    for (int i = 0; i < 2; ++i) {
+        const auto& st = input_.stats(i);
+        if (st.received == 0) continue;
+        std::cerr << "[Input] " << names[i]
+                  << ": received=" << st.received
+                  << " coalesced=" << st.coalesced
+                  << " dropped="   << st.dropped
+                  << " late="      << st.late
+                  << " unhandled=" << st.unhandled
+                  << " avg=" << st.avgLatencyMs() << "ms"
+                  << " max=" << st.latencyMaxUs / 1000.0 << "ms\n";
+    }
+    for (int i = 0; i < 2; ++i) {
+        const auto& rt = renderTotals_[static_cast<std::size_t>(i)];
+        if (rt.frames == 0) continue;
+        std::cerr << "[Render] " << names[i]
+                  << ": frames="       << rt.frames
+                  << " avg drawCalls=" << static_cast<double>(rt.drawCalls) / rt.frames
+                  << " vertices="      << static_cast<double>(rt.vertices) / rt.frames << "\n";
+        std::cerr << "[Text] " << names[i]
+                  << ": relayouts/frame=" << static_cast<double>(rt.relayouts) / rt.frames
+                  << " total="            << rt.relayouts
+                  << " cached="           << rt.layoutHits << "\n";
+        std::cerr << "[Shaders] " << names[i]
+                  << ": binds/frame="    << static_cast<double>(rt.shaderBinds) / rt.frames
+                  << " uploads/frame="   << static_cast<double>(rt.uniformUploads) / rt.frames << "\n";
+        if (i == 0) {
+            std::cerr << "[UI] Menu: rebuilds/frame=" << static_cast<double>(rt.uiRebuilds) / rt.frames << "\n";
+        }
+    }
+    if (online_) {
+        const ScoreClient::Stats st = online_->stats();
+        std::cerr << "[Online] sent=" << st.sent << " batches=" << st.batches << " failures=" << st.failures
+                  << " dropped=" << st.dropped << " unsent=" << st.queued << "\n";
+    }
+    const JobSystem::Stats js = jobs_.stats();
+    std::cerr << "[Jobs] threads=" << jobs_.threads() << " executed=" << js.executed << " stolen=" << js.stolen << "\n";
+    assets_.dumpStats(std::cerr);
+    if (!tracePath_.empty()) Profiler::writeChromeTrace(tracePath_);
+}
+
+void App::enterState(State s) {
+    if (stateSub_) input_.unsubscribe(stateSub_);
+    stateSub_ = 0;
+    state_ = s;
+    input_.setContext(static_cast<int>(s));
+
+    if (s == State::Menu) {
+        stateSub_ = input_.subscribe(InputSystem::Layer::State, [this](const InputEvent& e) {
+            return menu_->handleEvent(e.event);
+        });
+    } else if (s == State::Playing) {
+        stateSub_ = input_.subscribe(InputSystem::Layer::State, [this](const InputEvent& e) {
+            const auto* k = e.event.getIf<sf::Event::KeyPressed>();
+            if (!k || k->scancode != sf::Keyboard::Scan::Escape) return false;
+            backToMenu_ = true;
+            return true;
+        });
     }
-    if (!musicGame_.openFromFile(gamePath)) {
-        std::cerr << "[Audio] Failed to open " << gamePath << "\n";
+}
+
+// --- Config de partie
+void App::loadConfig() {
+    // Bloc compilé, sinon les JSON (les valeurs par défaut restent si un fichier manque)
+    if (!loadConfigBlob(TD_CONFIG_BLOB, difficulties_, rules_)) {
+        loadDifficulties(TD_CONFIG_DIR "/diffilculty.json", difficulties_);
+        loadGameRules(TD_CONFIG_DIR "/game_rules.json", rules_);
+    }
+    configWatcher_ = std::make_unique<ConfigWatcher>(TD_CONFIG_BLOB);
+}
+
+void App::applyConfigReload() {
+    const std::shared_ptr<const ConfigBlob> blob = configWatcher_->take();
+    if (!blob) return;
+    difficulties_ = blob->difficulties();
+    rules_        = blob->rules();
+    std::cerr << "[Config] reloaded " << TD_CONFIG_BLOB << " (" << difficulties_.size() << " difficulties)\n";
+    if (!game_) return;
+
+    const int d = blob->findDifficulty(game_->setup().difficulty.name.c_str());
+    if (d < 0) return; // difficulté retirée : la partie garde ses réglages
+    // Le replay ne sait pas rejouer un changement de config : il s'arrête ici
+    if (recording_) {
+        closeReplay();
+        std::cerr << "[Replay] config changed, replay stops at tick " << replay_.finalTick << "\n";
     }
+    game_->retune(blob->difficulty(static_cast<std::size_t>(d)), rules_);
+}
+
+// --- Partie
+void App::startGame() {
+    if (gameLoading_) return;
+    gameLoading_ = true;
+
+    struct Pending {
+        GameSetup setup;
+        GridMap   map;
+        bool      cached = false;
+    };
+    auto p = std::make_shared<Pending>();
+    GameSetup& setup = p->setup;
+    setup.seed = static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    if (const DifficultyParams* d = findDifficulty(difficulties_, "Normal")) setup.difficulty = *d;
+    setup.rules = rules_;
+    // En attendant le HUD de pose de tours, le joueur automatique joue
+    setup.autoPlayer = true;
 
-    musicMenu_.setLooping(true);
-    musicGame_.setLooping(true);
+    // Carte tirée sur tous les cœurs (ou relue si la graine est déjà en cache)
+    loader_.submit(
+        [p] { p->map = MapCache("maps").loadOrGenerate(Game::mapParams(p->setup), p->setup.seed, 0, &p->cached); },
+        [this, p] {
+            gameLoading_ = false;
+            std::cerr << "[MapGen] seed " << p->setup.seed << (p->cached ? " (cached)\n" : "\n");
+            if (state_ != State::Menu || !window_.isOpen()) return;
+            beginGame(p->setup, p->map);
+        });
+}
 
-    // Menu UI
-    menu_ = std::make_unique<Menu>(window_);
+void App::beginGame(const GameSetup& setup, const GridMap& map) {
+    game_ = std::make_unique<Game>(setup, &map, &jobs_);
+    replay_       = ReplayLog{};
+    replay_.setup = setup;
+    recording_    = true;
+    game_->setCommandSink([this](const GameCommand& c) {
+        if (recording_) replay_.commands.push_back(c);
+    });
+    enterState(State::Playing);
+    startGameMusic();
+}
 
-    // Musique du menu au démarrage
-    startMenuMusic();
+// Tick final et empreinte : la suite de la partie n'est plus enregistrée
+void App::closeReplay() {
+    if (!recording_) return;
+    recording_        = false;
+    replay_.finalTick = game_->tick();
+    replay_.finalHash = game_->stateHash();
 }
 
-App::~App() = default;
+void App::endGame() {
+    if (!game_) return;
+    closeReplay();
+    leaderboard_.saveReplay("replays/last.tdr", std::move(replay_));
+    const GameResult& r = game_->result();
+
+    // Vagues d'abord, les ennemis tués départagent
+    ScoreEntry score;
+    score.name       = "Player";
+    score.difficulty = game_->setup().difficulty.name;
+    score.score      = static_cast<std::uint64_t>(r.wavesCleared) * 1000u + r.kills;
+    score.waves      = static_cast<std::uint32_t>(r.wavesCleared);
+    score.seed       = r.seed;
+    score.time       = std::chrono::duration_cast<std::chrono::seconds>(
+                           std::chrono::system_clock::now().time_since_epoch()).count();
+    if (online_) online_->submit(score);
+    leaderboard_.submit(std::move(score)); // écrit (et rang affiché) par son thread
+    std::cerr << "[Game] seed=" << r.seed << " waves=" << r.wavesCleared
+              << " livesLost=" << r.livesLost << " ticks=" << game_->tick()
+              << " hash=" << std::hex << game_->stateHash() << std::dec
+              << " (replay: replays/last.tdr)\n";
+    game_.reset();
+}
 
 // --- Musiques
 void App::startMenuMusic() {
-    musicGame_.stop();
+    if (musicGame_) musicGame_->stop();
+    if (!musicMenu_) return; // démarrée à son arrivée
     // setVolume attend 0..100 (float)
-    musicMenu_.setVolume(menu_->musicVolume01() * 100.f);
-    musicMenu_.play();
+    musicMenu_->setVolume(menu_->musicVolume01() * 100.f);
+    musicMenu_->play();
 }
 
 void App::startGameMusic() {
-    musicMenu_.stop();
-    musicGame_.setVolume(menu_->musicVolume01() * 100.f);
-    musicGame_.play();
+    if (musicMenu_) musicMenu_->stop();
+    if (!musicGame_) return;
+    musicGame_->setVolume(menu_->musicVolume01() * 100.f);
+    musicGame_->play();
 }
 
 void App::run() {
     sf::Clock clk;
+    float accumulator = 0.f;
+
     while (window_.isOpen()) {
-        clk.restart();
+        PROFILE_SCOPE("App::frame");
+        float frameTime = clk.restart().asSeconds();
+        profiler_->frame(frameTime * 1000.f);
+        if (frameTime > kMaxFrameTime) frameTime = kMaxFrameTime;
+        accumulator += frameTime;
 
-        // (Le Menu gère ses propres événements dans Menu::tick())
-        // On garde tout de même la fermeture "hard" si jamais
-        while (auto ev = window_.pollEvent()) {
-            if (ev->is<sf::Event::Closed>()) {
-                window_.close();
-            }
-            // Tu peux aussi capter Escape si tu veux forcer un retour menu/fermeture:
-            // if (const auto* k = ev->getIf<sf::Event::KeyPressed>()) {
-            //     if (k->scancode == sf::Keyboard::Scan::Escape) window_.close();
-            // }
+        processEvents();
+        if (!window_.isOpen()) break;
+
+        // Uploads des assets décodés, dans un budget pour garder la frame fluide
+        {
+            PROFILE_SCOPE("AssetLoader::pump");
+            loader_.pump(kLoadBudgetMs);
+        }
+        if (!assetsReadyLogged_ && loader_.idle()) {
+            assetsReadyLogged_ = true;
+            std::cerr << "[Startup] assets ready after " << msSinceStart() << "ms ("
+                      << loader_.total() << " jobs)\n";
+            assets_.dumpStats(std::cerr);
         }
 
-        if (state_ == State::Menu) {
-            auto choice = menu_->tick();
-
-            // Suivre le slider "music" en temps réel
-            musicMenu_.setVolume(menu_->musicVolume01() * 100.f);
-
-            if (choice) {
-                if (choice->exit) {
-                    window_.close();
-                } else if (choice->openDifficulty) {
-                    // TODO: afficher l’overlay difficulté si besoin
-                } else if (choice->start) {
-                    state_ = State::Playing;
-                    startGameMusic();
-                }
-            }
-        } else if (state_ == State::Playing) {
-            // TODO: boucle de jeu, rendu, etc.
-            // Maintenir le volume sync avec le slider
-            musicGame_.setVolume(menu_->musicVolume01() * 100.f);
+        // Config rechargée : appliquée avant le prochain tick, jamais au milieu
+        applyConfigReload();
+
+        // Ticks de simulation à pas fixe
+        int steps = 0;
+        while (accumulator >= kSimDt && steps < kMaxCatchUpSteps) {
+            update(kSimDt);
+            accumulator -= kSimDt;
+            ++steps;
         }
+        // Trop en retard : on abandonne le surplus plutôt que de ralentir encore la frame
+        if (accumulator >= kSimDt) accumulator = std::fmod(accumulator, kSimDt);
 
-        // Le Menu dessine déjà; ici on ne fait que présenter la frame
-        window_.display();
+        render(accumulator / kSimDt);
     }
 }
 
 void App::processEvents() {
-    // L'essentiel est géré dans run(); cette fonction est là si tu veux séparer.
-    while (auto ev = window_.pollEvent()) {
-        if (ev->is<sf::Event::Closed>())
-            window_.close();
+    PROFILE_SCOPE("App::processEvents");
+    // Un seul poll par frame, puis distribution aux abonnés
+    input_.pump(window_, frame_);
+    input_.dispatch();
+
+    // Les transitions d'état se font après la distribution
+    if (state_ == State::Menu) {
+        if (auto choice = menu_->takeChoice()) {
+            if (choice->exit) {
+                window_.close();
+            } else if (choice->openDifficulty) {
+                // TODO: afficher l’overlay difficulté si besoin
+            } else if (choice->start) {
+                startGame(); // la partie commence quand la carte est prête
+            }
+        }
+    } else if (state_ == State::Playing && (backToMenu_ || (game_ && game_->over()))) {
+        backToMenu_ = false;
+        endGame();
+        enterState(State::Menu);
+        startMenuMusic();
     }
 }
 
-void App::update(float /*dt*/) {
-    // Si tu veux une boucle "classique", tu peux appeler menu_->tick() ici
-    // et déplacer la logique correspondante de run() vers update().
+void App::update(float dt) {
+    PROFILE_SCOPE("App::update");
+    if (state_ == State::Menu) {
+        menu_->update(dt);
+        // Suivre le slider "music" en temps réel
+        if (musicMenu_) musicMenu_->setVolume(menu_->musicVolume01() * 100.f);
+    } else if (state_ == State::Playing) {
+        // Un tick App = un tick de simulation : le pas fixe garde le lockstep
+        if (game_) game_->step();
+        // Maintenir le volume sync avec le slider
+        if (musicGame_) musicGame_->setVolume(menu_->musicVolume01() * 100.f);
+    }
 }
 
-void App::render() {
-    // Si tu décides de centraliser le rendu ici, clear/draw/display.
-    // Actuellement, Menu::tick() fait le draw et run() fait display().
+void App::render(float alpha) {
+    PROFILE_SCOPE("App::render");
+    window_.clear();
+    if (state_ == State::Menu) {
+        menu_->render(batch_, alpha);
+    } else if (state_ == State::Playing && game_) {
+        battlefield_.render(batch_, *game_, window_.getSize(), alpha, &jobs_);
+    }
+
+    // Barre de progression du chargement en bas de l'écran
+    if (!loader_.idle()) {
+        const sf::Vector2f view = window_.getView().getSize();
+        batch_.rect({0.f, view.y - 6.f}, {view.x, 6.f}, sf::Color(30,34,46), kLoadingLayer);
+        batch_.rect({0.f, view.y - 6.f}, {view.x * loader_.progress(), 6.f}, sf::Color(90,160,255), kLoadingLayer);
+    }
+    profiler_->render(batch_, window_.getView().getSize());
+    batch_.flush(window_);
+
+    const auto st = batch_.takeStats();
+    const auto tx = text_.takeStats();
+    text_.endFrame();
+    if (state_ != State::Exiting) {
+        auto& rt = renderTotals_[state_ == State::Menu ? 0 : 1];
+        ++rt.frames;
+        rt.drawCalls  += st.drawCalls;
+        rt.vertices   += st.vertices;
+        rt.relayouts  += tx.relayouts;
+        rt.layoutHits += tx.hits;
+        rt.shaderBinds    += st.shaderBinds;
+        rt.uniformUploads += shaders_.takeUploads();
+        if (state_ == State::Menu) rt.uiRebuilds += menu_->takeUiRebuilds();
+    }
+    {
+        // Attente de la VSync comprise
+        PROFILE_SCOPE("RenderWindow::display");
+        window_.display();
+    }
+    if (!firstFrameLogged_) {
+        firstFrameLogged_ = true;
+        std::cerr << "[Startup] first frame after " << msSinceStart() << "ms\n";
+    }
+    input_.onFramePresented();
+    ++frame_;
 }
@@ -0,0 +1,198 @@
+#include "AssetCache.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <optional>
+
+#ifndef TD_ASSETS_DIR
+#define TD_ASSETS_DIR "assets"
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+bool readBytes(const std::string& path, std::vector<char>& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Empreinte du contenu (FNV-1a 64 bits)
+std::uint64_t contentHash(const std::vector<char>& bytes) {
+    std::uint64_t h = 1469598103934665603ull;
+    for (char c : bytes) { h ^= static_cast<unsigned char>(c); h *= 1099511628211ull; }
+    return h;
+}
+
+} // namespace
+
+AssetCache::AssetCache(AssetLoader& loader, std::size_t budgetBytes)
+    : loader_(loader), budget_(budgetBytes), root_(TD_ASSETS_DIR) {}
+
+std::string AssetCache::resolve(const std::string& path) const {
+    fs::path p(path);
+    if (p.is_relative()) p = fs::path(root_) / p;
+    std::error_code ec;
+    const fs::path canon = fs::weakly_canonical(p, ec);
+    return (ec ? p.lexically_normal() : canon).generic_string();
+}
+
+// ---- Textures
+void AssetCache::requestTexture(const std::string& path, std::function<void(TextureHandle)> onReady) {
+    const std::string key = resolve(path);
+    if (TextureHandle t = textures_.acquire(key, ++clock_)) { onReady(std::move(t)); return; }
+
+    auto& waiting = pendingTex_[key];
+    waiting.push_back(std::move(onReady));
+    if (waiting.size() > 1) { textures_.countPendingHit(); return; }
+
+    struct Decoded { bool ok = false; std::uint64_t hash = 0; sf::Image image; };
+    auto d = std::make_shared<Decoded>();
+    loader_.submit(
+        [key, d] {
+            std::vector<char> bytes;
+            if (!readBytes(key, bytes)) return;
+            d->hash = contentHash(bytes);
+            d->ok   = d->image.loadFromMemory(bytes.data(), bytes.size());
+        },
+        [this, key, d] {
+            TextureHandle handle;
+            if (!d->ok) {
+                std::cerr << "[Assets] cannot load texture " << key << "\n";
+            } else if (!(handle = textures_.findContent(key, d->hash, ++clock_))) {
+                // Upload GPU seulement si le contenu n'est pas déjà résident
+                auto tex = std::make_shared<sf::Texture>();
+                if (tex->loadFromImage(d->image)) {
+                    tex->setSmooth(true);
+                    const std::size_t bytes = std::size_t{tex->getSize().x} * tex->getSize().y * 4;
+                    handle = textures_.insert(key, d->hash, std::move(tex), bytes, clock_);
+                }
+            }
+            auto callbacks = std::move(pendingTex_[key]);
+            pendingTex_.erase(key);
+            for (auto& cb : callbacks) cb(handle);
+            trim();
+        });
+}
+
+// ---- Polices
+bool AssetCache::mountFontBundle(const std::string& path) {
+    std::vector<FontBundleEntry> entries;
+    if (!readFontBundleIndex(path, entries)) {
+        std::cerr << "[Assets] no font bundle at " << path << ", loading font files\n";
+        return false;
+    }
+    fontBundle_ = path;
+    bundledFonts_.clear();
+    for (auto& e : entries) bundledFonts_[resolve(e.name)] = std::move(e);
+    return true;
+}
+
+void AssetCache::requestFont(const std::string& path, std::function<void(FontHandle)> onReady) {
+    const std::string key = resolve(path);
+    if (auto f = fonts_.acquire(key, ++clock_)) { onReady(FontHandle(f, &f->font)); return; }
+
+    auto& waiting = pendingFont_[key];
+    waiting.push_back(std::move(onReady));
+    if (waiting.size() > 1) { fonts_.countPendingHit(); return; }
+
+    struct Loaded { bool ok = false; std::uint64_t hash = 0; std::vector<char> bytes; };
+    auto d = std::make_shared<Loaded>();
+    // Dans le paquet de polices réduites si elle y est
+    std::optional<FontBundleEntry> entry;
+    if (auto it = bundledFonts_.find(key); it != bundledFonts_.end()) entry = it->second;
+    loader_.submit(
+        [key, d, entry, bundle = fontBundle_] {
+            d->ok   = (entry ? readFontBundleEntry(bundle, *entry, d->bytes) : readBytes(key, d->bytes))
+                   && !d->bytes.empty();
+            d->hash = contentHash(d->bytes);
+        },
+        [this, key, d] {
+            std::shared_ptr<const FontAsset> slot;
+            if (!d->ok) {
+                std::cerr << "[Assets] cannot load font " << key << "\n";
+            } else if (!(slot = fonts_.findContent(key, d->hash, ++clock_))) {
+                auto asset = std::make_shared<FontAsset>();
+                asset->bytes = std::move(d->bytes);
+                if (asset->font.openFromMemory(asset->bytes.data(), asset->bytes.size())) {
+                    const std::size_t bytes = asset->bytes.size();
+                    slot = fonts_.insert(key, d->hash, std::move(asset), bytes, clock_);
+                }
+            }
+            // Handle sur la police, qui garde aussi ses octets en vie
+            const FontHandle handle = slot ? FontHandle(slot, &slot->font) : nullptr;
+            slot.reset();
+            auto callbacks = std::move(pendingFont_[key]);
+            pendingFont_.erase(key);
+            for (auto& cb : callbacks) cb(handle);
+            trim();
+        });
+}
+
+// ---- Musiques
+void AssetCache::requestMusic(const std::string& path, std::function<void(MusicHandle)> onReady) {
+    const std::string key = resolve(path);
+    if (MusicHandle m = music_.acquire(key, ++clock_)) { onReady(std::move(m)); return; }
+
+    auto& waiting = pendingMusic_[key];
+    waiting.push_back(std::move(onReady));
+    if (waiting.size() > 1) { music_.countPendingHit(); return; }
+
+    auto music = std::make_shared<sf::Music>();
+    auto ok    = std::make_shared<bool>(false);
+    loader_.submit(
+        [key, music, ok] { *ok = music->openFromFile(key); },
+        [this, key, music, ok] {
+            MusicHandle handle;
+            if (!*ok) std::cerr << "[Assets] cannot open music " << key << "\n";
+            else      handle = music_.insert(key, std::hash<std::string>{}(key), music, 0, ++clock_);
+            auto callbacks = std::move(pendingMusic_[key]);
+            pendingMusic_.erase(key);
+            for (auto& cb : callbacks) cb(handle);
+        });
+}
+
+// ---- Budget
+std::size_t AssetCache::residentBytes() const {
+    return textures_.stats().bytes + fonts_.stats().bytes + music_.stats().bytes;
+}
+
+void AssetCache::trim() {
+    while (residentBytes() > budget_) {
+        // Le plus ancien inutilisé, tous types confondus
+        const std::uint64_t t = textures_.oldestUnused();
+        const std::uint64_t f = fonts_.oldestUnused();
+        if (t == UINT64_MAX && f == UINT64_MAX) break; // tout est utilisé
+        if (t <= f) {
+            textures_.evictOldestUnused();
+            continue;
+        }
+        AssetTable<const FontAsset>::Handle font;
+        fonts_.evictOldestUnused(&font);
+        if (fontEvicted_) fontEvicted_(&font->font);
+    }
+}
+
+void AssetCache::dumpStats(std::ostream& os) const {
+    auto line = [&](const char* name, const auto& st) {
+        os << "[Assets] " << std::left << std::setw(8) << name << std::right
+           << " resident=" << st.resident
+           << " (" << std::fixed << std::setprecision(1) << static_cast<double>(st.bytes) / (1024.0 * 1024.0) << " MB)"
+           << std::defaultfloat
+           << " hits="      << st.hits
+           << " misses="    << st.misses
+           << " dedup="     << st.dedups
+           << " evicted="   << st.evictions << "\n";
+    };
+    line("textures", textures_.stats());
+    line("fonts",    fonts_.stats());
+    line("music",    music_.stats());
+    os << "[Assets] total " << std::fixed << std::setprecision(1)
+       << static_cast<double>(residentBytes()) / (1024.0 * 1024.0) << " / "
+       << static_cast<double>(budget_) / (1024.0 * 1024.0) << " MB\n" << std::defaultfloat;
+}
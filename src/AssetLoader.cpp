@@ -0,0 +1,75 @@
+#include "AssetLoader.hpp"
+
+#include <chrono>
+#include <string>
+
+#include "sim/Profiler.hpp"
+
+AssetLoader::AssetLoader(unsigned workers) {
+    if (workers == 0) workers = 1;
+    for (unsigned i = 0; i < workers; ++i) {
+        threads_.emplace_back([this, i] {
+            Profiler::setThreadName("loader " + std::to_string(i));
+            workerLoop();
+        });
+    }
+}
+
+AssetLoader::~AssetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        queue_.clear(); // les décodages non commencés sont abandonnés
+    }
+    cv_.notify_all();
+    for (auto& t : threads_) t.join();
+}
+
+void AssetLoader::submit(std::function<void()> work, std::function<void()> finish) {
+    ++total_;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (work) queue_.push_back(Job{std::move(work), std::move(finish)});
+        else      ready_.push_back(Job{{}, std::move(finish)});
+    }
+    cv_.notify_one();
+}
+
+void AssetLoader::workerLoop() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (stop_) return;
+            job = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        {
+            PROFILE_SCOPE("AssetLoader::work");
+            job.work();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.push_back(Job{{}, std::move(job.finish)});
+    }
+}
+
+std::size_t AssetLoader::pump(double budgetMs) {
+    using Clock = std::chrono::steady_clock;
+    const auto t0 = Clock::now();
+    std::size_t done = 0;
+    for (;;) {
+        Job job;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (ready_.empty()) break;
+            job = std::move(ready_.front());
+            ready_.pop_front();
+        }
+        if (job.finish) job.finish();
+        ++completed_;
+        ++done;
+        if (std::chrono::duration<double, std::milli>(Clock::now() - t0).count() >= budgetMs) break;
+    }
+    return done;
+}
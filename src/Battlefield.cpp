@@ -0,0 +1,86 @@
+#include "Battlefield.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "sim/JobSystem.hpp"
+#include "sim/Profiler.hpp"
+
+namespace {
+
+// f(begin, end) sur [0, n), réparti si un JobSystem est là
+void forRange(JobSystem* jobs, std::size_t n, std::size_t grain,
+              const std::function<void(std::size_t, std::size_t)>& f) {
+    if (jobs) jobs->parallelFor(n, grain, f);
+    else      f(0, n);
+}
+
+constexpr std::size_t kQuadGrain = 2048; // quads par tâche
+
+} // namespace
+
+void Battlefield::render(SpriteBatch& batch, const Game& game, sf::Vector2u viewSize, float alpha,
+                         JobSystem* jobs) const {
+    PROFILE_SCOPE("Battlefield::render");
+    const GridMap& map = game.map();
+    if (map.width <= 0 || map.height <= 0) return;
+
+    // Carte centrée, cellules carrées
+    const float vw   = static_cast<float>(viewSize.x);
+    const float vh   = static_cast<float>(viewSize.y);
+    const float cell = std::min(vw / static_cast<float>(map.width), vh / static_cast<float>(map.height));
+    const sf::Vector2f origin{(vw - cell * static_cast<float>(map.width))  * 0.5f,
+                              (vh - cell * static_cast<float>(map.height)) * 0.5f};
+    auto toScreen = [&](float x, float y) { return origin + sf::Vector2f{x * cell, y * cell}; };
+
+    // Sol : un quad par cellule (obstacles et tours plus sombres)
+    sf::Vertex* ground = batch.reserveQuads(map.cellCount(), kGround);
+    forRange(jobs, map.cellCount(), kQuadGrain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const int x = static_cast<int>(i % static_cast<std::size_t>(map.width));
+            const int y = static_cast<int>(i / static_cast<std::size_t>(map.width));
+            const bool blocked = map.blocked[map.index(x, y)] != 0;
+            const sf::Color c = blocked ? sf::Color(52,56,66) : ((x + y) & 1 ? sf::Color(34,44,38) : sf::Color(38,49,42));
+            SpriteBatch::writeRect(ground + i * 6, toScreen(static_cast<float>(x), static_cast<float>(y)), {cell, cell}, c);
+        }
+    });
+    for (const Cell& s : map.spawns)
+        batch.rect(toScreen(static_cast<float>(s.x), static_cast<float>(s.y)), {cell, cell}, sf::Color(70,140,90), kGround);
+    for (const Cell& e : map.exits)
+        batch.rect(toScreen(static_cast<float>(e.x), static_cast<float>(e.y)), {cell, cell}, sf::Color(150,60,60), kGround);
+
+    const World& w = game.world();
+    const float  lag = (alpha - 1.f) * Game::kDt; // < 0 : on recule vers l'instant affiché
+
+    // Tours (centrées sur leur cellule)
+    const float towerSize = cell * 0.8f;
+    for (std::size_t i = 0; i < w.towers.size(); ++i) {
+        const sf::Vector2f c = toScreen(w.towers.posX[i], w.towers.posY[i]);
+        batch.rect(c - sf::Vector2f{towerSize, towerSize} * 0.5f, {towerSize, towerSize},
+                   sf::Color(90,160,255), kTowers);
+    }
+
+    // Ennemis
+    const float enemySize = cell * 0.5f;
+    const EnemyStore& en = w.enemies;
+    sf::Vertex* enemies = batch.reserveQuads(en.size(), kEnemies);
+    forRange(jobs, en.size(), kQuadGrain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const sf::Vector2f c = toScreen(en.posX[i] + en.velX[i] * lag, en.posY[i] + en.velY[i] * lag);
+            SpriteBatch::writeRect(enemies + i * 6, c - sf::Vector2f{enemySize, enemySize} * 0.5f,
+                                   {enemySize, enemySize}, sf::Color(230,90,70));
+        }
+    });
+
+    // Projectiles
+    const float shotSize = std::max(2.f, cell * 0.15f);
+    const ProjectileStore& pr = w.projectiles;
+    sf::Vertex* shots = batch.reserveQuads(pr.size(), kProjectiles);
+    forRange(jobs, pr.size(), kQuadGrain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const sf::Vector2f c = toScreen(pr.posX[i] + pr.velX[i] * lag, pr.posY[i] + pr.velY[i] * lag);
+            SpriteBatch::writeRect(shots + i * 6, c - sf::Vector2f{shotSize, shotSize} * 0.5f,
+                                   {shotSize, shotSize}, sf::Color(255,230,120));
+        }
+    });
+}
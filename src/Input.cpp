@@ -0,0 +1,111 @@
+#include "Input.hpp"
+
+#include <algorithm>
+
+// ============================
+//  InputQueue
+// ============================
+bool InputQueue::push(const InputEvent& e) {
+    if (count_ == kCapacity) return false;
+    ring_[(head_ + count_) % kCapacity] = e;
+    ++count_;
+    return true;
+}
+
+std::optional<InputEvent> InputQueue::pop() {
+    if (count_ == 0) return std::nullopt;
+    std::optional<InputEvent> e = std::move(ring_[head_]);
+    ring_[head_].reset();
+    head_ = (head_ + 1) % kCapacity;
+    --count_;
+    return e;
+}
+
+bool InputQueue::coalesceBack(const InputEvent& e) {
+    if (count_ == 0 || !e.event.is<sf::Event::MouseMoved>()) return false;
+    auto& back = ring_[(head_ + count_ - 1) % kCapacity];
+    if (!back || !back->event.is<sf::Event::MouseMoved>()) return false;
+    // On garde l'horodatage du plus ancien : c'est lui qui fixe la latence
+    const std::int64_t t = back->timeUs;
+    back = e;
+    back->timeUs = t;
+    return true;
+}
+
+// ============================
+//  InputSystem
+// ============================
+int InputSystem::subscribe(Layer layer, Handler handler) {
+    Subscriber s{nextId_++, layer, std::move(handler)};
+    const int id = s.id;
+    if (dispatching_) {
+        pendingSubs_.push_back(std::move(s));
+    } else {
+        subscribers_.push_back(std::move(s));
+        mergePending();
+    }
+    return id;
+}
+
+void InputSystem::unsubscribe(int id) {
+    auto match = [id](const Subscriber& s){ return s.id == id; };
+    std::erase_if(pendingSubs_, match);
+    if (dispatching_) {
+        // Pas d'effacement pendant l'itération : on neutralise, compacté après
+        for (auto& s : subscribers_) if (s.id == id) s.handler = nullptr;
+    } else {
+        std::erase_if(subscribers_, match);
+    }
+}
+
+void InputSystem::mergePending() {
+    for (auto& s : pendingSubs_) subscribers_.push_back(std::move(s));
+    pendingSubs_.clear();
+    std::erase_if(subscribers_, [](const Subscriber& s){ return !s.handler; });
+    // Stable : à couche égale, le premier abonné reste servi en premier
+    std::stable_sort(subscribers_.begin(), subscribers_.end(),
+                     [](const Subscriber& a, const Subscriber& b){
+                         return static_cast<int>(a.layer) < static_cast<int>(b.layer);
+                     });
+}
+
+void InputSystem::setContext(int ctx) {
+    context_ = std::clamp(ctx, 0, kMaxContexts - 1);
+}
+
+void InputSystem::pump(sf::Window& window, std::uint64_t frame) {
+    while (auto ev = window.pollEvent()) {
+        InputEvent e{*ev, clock_.getElapsedTime().asMicroseconds(), frame};
+        ++cur().received;
+        if (queue_.coalesceBack(e)) { ++cur().coalesced; continue; }
+        if (!queue_.push(e))        { ++cur().dropped; }
+    }
+}
+
+void InputSystem::dispatch() {
+    dispatching_ = true;
+    while (auto e = queue_.pop()) {
+        bool consumed = false;
+        for (auto& s : subscribers_) {
+            if (s.handler && s.handler(*e)) { consumed = true; break; }
+        }
+        if (!consumed) ++cur().unhandled;
+        awaitingPresent_.push_back(e->timeUs);
+    }
+    dispatching_ = false;
+    mergePending();
+}
+
+void InputSystem::onFramePresented() {
+    if (awaitingPresent_.empty()) return;
+    const std::int64_t now = clock_.getElapsedTime().asMicroseconds();
+    auto& st = cur();
+    for (std::int64_t t : awaitingPresent_) {
+        const std::int64_t lat = now - t;
+        ++st.presented;
+        st.latencySumUs += lat;
+        st.latencyMaxUs  = std::max(st.latencyMaxUs, lat);
+        if (lat > kLateThresholdUs) ++st.late;
+    }
+    awaitingPresent_.clear();
+}
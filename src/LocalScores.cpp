@@ -0,0 +1,66 @@
+#include "LocalScores.hpp"
+
+#include <filesystem>
+#include <iostream>
+
+LocalScores::LocalScores(std::size_t keepPerDifficulty)
+: board_(keepPerDifficulty), thread_([this] { run(); }) {}
+
+LocalScores::~LocalScores() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+void LocalScores::open(std::string path, std::string migrateFrom) {
+    push([this, path = std::move(path), migrateFrom = std::move(migrateFrom)] {
+        if (!board_.open(path)) return;
+        // Premier lancement : reprise de l'ancien scores.json
+        if (board_.size() == 0) {
+            const int n = migrateScoresJson(migrateFrom, board_);
+            if (n > 0) std::cerr << "[Leaderboard] migrated " << n << " scores from scores.json\n";
+        }
+    });
+}
+
+void LocalScores::submit(ScoreEntry e) {
+    push([this, e = std::move(e)] {
+        if (!board_.submit(e)) return;
+        std::cerr << "[Leaderboard] " << e.score << " points, rank "
+                  << board_.rank(e.difficulty, e.score) << "/"
+                  << board_.count(e.difficulty) << " (" << e.difficulty << ")\n";
+    });
+}
+
+void LocalScores::saveReplay(std::string path, ReplayLog log) {
+    push([path = std::move(path), log = std::move(log)] {
+        std::error_code ec;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+        writeReplay(path, log);
+    });
+}
+
+void LocalScores::push(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(task));
+    }
+    wake_.notify_one();
+}
+
+void LocalScores::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        // stop_ seulement une fois la file vide
+        if (queue_.empty()) return;
+        std::function<void()> task = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
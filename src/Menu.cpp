@@ -2,358 +2,341 @@
 #include <cmath>
 #include <cstdint>
 #include <algorithm> // std::clamp
+#include <charconv>
+#include <iostream>
 
-// ============================
-//  Shader panel (cadre)
-// ============================
-static const char* kPanelFragment = R"GLSL(
-uniform vec2  u_pos;
-uniform vec2  u_size;
-uniform float u_radius;
-uniform vec4  u_innerA;
-uniform vec4  u_innerB;
-uniform vec4  u_shadowCol;
-uniform vec4  u_borderCol;
-uniform float u_time;
-uniform float u_fillAlpha; // 0 = pas de remplissage, 1 = remplir
-
-float sdRoundBox(vec2 p, vec2 b, float r){
-    vec2 q = abs(p) - (b - vec2(r));
-    return length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;
-}
-
-void main() {
-    vec2 uv = gl_FragCoord.xy - u_pos;
-    vec2 halfSize = u_size * 0.5;
-    vec2 p = uv - halfSize;
-
-    float d = sdRoundBox(p, halfSize, u_radius);
-
-    // intérieur
-    float alpha = smoothstep(0.0, -1.5, d);
-    float gy = clamp(uv.y / u_size.y, 0.0, 1.0);
-    vec4 inner = mix(u_innerA, u_innerB, gy) * u_fillAlpha;
+#include "sim/Profiler.hpp"
 
-    // ombre soft extérieure
-    float shadowEdge = 28.0;
-    float shadowAmt = 1.0 - clamp(d / shadowEdge, 0.0, 1.0);
-    vec4 shadowCol = u_shadowCol * shadowAmt * (1.0 - alpha);
+#ifndef TD_ATLAS_DIR
+#define TD_ATLAS_DIR "atlas"
+#endif
 
-    // bord brillant
-    float pulse = 0.5 + 0.5 * sin(u_time * 2.6);
-    float borderMask = smoothstep(2.0, 0.0, abs(d));
-    vec4 borderCol = u_borderCol * borderMask * (0.25 + 0.75 * pulse);
-
-    vec4 fill = inner * alpha;
-    vec4 col = shadowCol + fill + borderCol;
-    col.a = max(max(fill.a, borderCol.a), shadowCol.a);
-    gl_FragColor = col;
-}
-)GLSL";
-
-// ============================
-//  Shader button (boutons)
-// ============================
-static const char* kButtonFragment = R"GLSL(
-uniform vec2  u_pos;
-uniform vec2  u_size;
-uniform float u_radius;
-uniform vec4  u_fillA;
-uniform vec4  u_fillB;
-uniform vec4  u_borderCol;
-uniform float u_time;
-uniform float u_hover; // 0..1
-
-float sdRoundBox(vec2 p, vec2 b, float r){
-    vec2 q = abs(p) - (b - vec2(r));
-    return length(max(q,0.0)) + min(max(q.x,q.y),0.0) - r;
+namespace {
+// Les lissages du menu ont été réglés "par frame" à 60 Hz ; on convertit le
+// facteur k (par frame 60 Hz) en facteur équivalent pour un pas dt quelconque.
+float smoothFactor(float k60, float dt) {
+    return 1.f - std::pow(1.f - k60, dt * 60.f);
 }
-
-void main() {
-    vec2 uv = gl_FragCoord.xy - u_pos;
-    vec2 halfSize = u_size * 0.5;
-    vec2 p = uv - halfSize;
-    float d = sdRoundBox(p, halfSize, u_radius);
-
-    float alpha = smoothstep(0.0, -1.2, d);
-    float gy = clamp(uv.y / u_size.y, 0.0, 1.0);
-
-    // bord toujours visible, plus fort en hover + pulse
-    float pulse = 0.5 + 0.5 * sin(u_time * 3.0);
-    float borderMask  = smoothstep(2.0, 0.0, abs(d));
-    float borderAlpha = mix(0.30, 1.0, u_hover) * (0.65 + 0.35 * pulse);
-    vec4 border = u_borderCol * borderMask * borderAlpha;
-
-    // remplissage apparaît avec le hover (gradient)
-    vec4 inner = mix(vec4(0.0), mix(u_fillA, u_fillB, gy), u_hover);
-
-    vec4 col = inner * alpha + border;
-    col.a = max(inner.a * alpha, border.a);
-    gl_FragColor = col;
-}
-)GLSL";
-
+// Couches de dessin du menu (ordre croissant)
+enum MenuLayer : int {
+    kLayerBg, kLayerShadow, kLayerCard, kLayerPanel, kLayerSoft, kLayerTitle,
+    kLayerButtons, kLayerLabels, kLayerGear, kLayerGearIcon, kLayerOptPanel, kLayerOptText,
+};
+} // namespace
 
 // ---- Constructor
-Menu::Menu(sf::RenderWindow& win) : win_(win) {
-    loadAssets();
-
-    shaderOk_    = panelShader_.loadFromMemory(kPanelFragment,  sf::Shader::Type::Fragment);
-    btnShaderOk_ = buttonShader_.loadFromMemory(kButtonFragment, sf::Shader::Type::Fragment);
-
+Menu::Menu(sf::RenderWindow& win, AssetCache& assets, ShaderManager& shaders, TextSystem& text)
+    : win_(win), text_(text),
+      panelShader_(shaders.get(ShaderId::Panel)), buttonShader_(shaders.get(ShaderId::Button)) {
+    // Rien de lourd ici : la première frame s'affiche tout de suite, avec des
+    // formes de remplacement tant que les assets ne sont pas arrivés
     buildLayout();
     buildSettings();     // Doit exister avant le premier positionnement
     positionElements();
+
+    // Après l'arbre : un asset déjà en cache rappelle tout de suite
+    loadAssets(assets, shaders);
 }
 
-// ---- tick: events + update + draw (sans clear/display)
-std::optional<MenuChoice> Menu::tick() {
-    MenuChoice choice;
+// ---- handleEvent: un événement de la file d'entrée
+bool Menu::handleEvent(const sf::Event& ev) {
+    // Un choix est déjà en attente : l'App changera d'état avant la frame suivante
+    if (pendingChoice_) return false;
 
-    // Temps animé pour le glow
-    animTime_ += animClock_.restart().asSeconds();
+    auto choose = [&](auto field) {
+        MenuChoice choice;
+        choice.*field = true;
+        pendingChoice_ = choice;
+        return true;
+    };
 
-    while (auto ev = win_.pollEvent()) {
-        if (ev->is<sf::Event::Closed>()) {
-            choice.exit = true; return choice;
-        }
-        if (ev->is<sf::Event::Resized>()) {
-            positionElements();
-        }
-        if (const auto* k = ev->getIf<sf::Event::KeyPressed>()) {
-            using Scan = sf::Keyboard::Scan;
-            if (k->scancode == Scan::Up) {
-                focusIndex_ = (focusIndex_ + (int)buttons_.size() - 1) % (int)buttons_.size();
-            } else if (k->scancode == Scan::Down) {
-                focusIndex_ = (focusIndex_ + 1) % (int)buttons_.size();
-            } else if (k->scancode == Scan::Enter) {
-                const auto& id = buttons_[focusIndex_].id;
-                if (id == "start")      { choice.start = true; return choice; }
-                if (id == "difficulty") { choice.openDifficulty = true; return choice; }
-                if (id == "exit")       { choice.exit = true; return choice; }
-            }
+    if (ev.is<sf::Event::Resized>()) {
+        positionElements();
+        return true;
+    }
+    if (const auto* k = ev.getIf<sf::Event::KeyPressed>()) {
+        using Scan = sf::Keyboard::Scan;
+        if (k->scancode == Scan::Up) {
+            focusIndex_ = (focusIndex_ + (int)buttons_.size() - 1) % (int)buttons_.size();
+            return true;
+        } else if (k->scancode == Scan::Down) {
+            focusIndex_ = (focusIndex_ + 1) % (int)buttons_.size();
+            return true;
+        } else if (k->scancode == Scan::Enter) {
+            const auto& id = buttons_[focusIndex_].id;
+            if (id == "start")      return choose(&MenuChoice::start);
+            if (id == "difficulty") return choose(&MenuChoice::openDifficulty);
+            if (id == "exit")       return choose(&MenuChoice::exit);
         }
+        return false;
+    }
 
-        // --- Bouton "gear" (cercle) : hover + click
-        if (const auto* m = ev->getIf<sf::Event::MouseMoved>()) {
-            sf::Vector2f mp{(float)m->position.x, (float)m->position.y};
-            sf::Vector2f center = gearButton_.getPosition()
-                                + sf::Vector2f{gearButton_.getRadius(), gearButton_.getRadius()};
-            gearHover_ = hitCircle(mp, center, gearButton_.getRadius());
+    // --- Bouton "gear" (cercle) : hover + drag des sliders
+    if (const auto* m = ev.getIf<sf::Event::MouseMoved>()) {
+        sf::Vector2f mp{(float)m->position.x, (float)m->position.y};
+        const bool hover = hitCircle(mp, gearCenter(), kGearRadius);
+        if (hover != gearHover_) {
+            // Léger zoom depuis le coin haut-gauche
+            gearHover_ = hover;
+            const float d = 2.f * kGearRadius * (hover ? 1.06f : 1.f);
+            gear_->setSize({d, d});
         }
-        if (const auto* m = ev->getIf<sf::Event::MouseButtonPressed>()) {
-            if (m->button == sf::Mouse::Button::Left) {
-                sf::Vector2f mp{(float)m->position.x, (float)m->position.y};
-                sf::Vector2f center = gearButton_.getPosition()
-                                    + sf::Vector2f{gearButton_.getRadius(), gearButton_.getRadius()};
-                if (hitCircle(mp, center, gearButton_.getRadius())) {
-                    optionsOpen_ = !optionsOpen_; // toggle
-                }
-                // sliders: commence drag si options ouvertes
-                if (optionsOpen_) {
-                    auto grab = [&](Slider& s){
-                        sf::FloatRect bar(s.pos, s.size);
-                        if (bar.contains(mp)) { s.dragging = true; }
-                    };
-                    grab(sliderMusic_);
-                    grab(sliderSfx_);
-                }
-            }
+
+        if (optionsOpen_) {
+            // si on drag, on met à jour la valeur 0..1
+            auto drag = [&](Slider& s, float& outVal){
+                if (!s.dragging) return;
+                outVal = s.node->valueAt((float)m->position.x);
+                s.node->setValue(outVal);
+            };
+            drag(sliderMusic_, musicVol01_);
+            drag(sliderSfx_,   sfxVol01_);
         }
-        if (const auto* m = ev->getIf<sf::Event::MouseButtonReleased>()) {
-            if (m->button == sf::Mouse::Button::Left) {
-                sliderMusic_.dragging = false;
-                sliderSfx_.dragging   = false;
-            }
+        return true;
+    }
+    if (const auto* m = ev.getIf<sf::Event::MouseButtonPressed>()) {
+        if (m->button != sf::Mouse::Button::Left) return false;
+
+        sf::Vector2f mp{(float)m->position.x, (float)m->position.y};
+        if (hitCircle(mp, gearCenter(), kGearRadius)) {
+            optionsOpen_ = !optionsOpen_; // toggle
+            options_->setVisible(optionsOpen_);
         }
-        if (const auto* m = ev->getIf<sf::Event::MouseMoved>()) {
-            if (optionsOpen_) {
-                // si on drag, on met à jour la valeur 0..1
-                auto drag = [&](Slider& s, float& outVal){
-                    if (!s.dragging) return;
-                    float x = (float)m->position.x;
-                    float t = (x - s.pos.x) / s.size.x;
-                    outVal = clamp01(t);
-                };
-                drag(sliderMusic_, musicVol01_);
-                drag(sliderSfx_,   sfxVol01_);
-            }
+        // sliders: commence drag si options ouvertes
+        if (optionsOpen_) {
+            auto grab = [&](Slider& s){
+                if (s.node->contains(mp)) { s.dragging = true; }
+            };
+            grab(sliderMusic_);
+            grab(sliderSfx_);
         }
 
-        // --- Click sur les boutons rectangulaires
-        if (const auto* m = ev->getIf<sf::Event::MouseButtonPressed>()) {
-            if (m->button == sf::Mouse::Button::Left) {
-                auto mp = win_.mapPixelToCoords(sf::Vector2i{m->position.x, m->position.y});
-                for (auto& b : buttons_) {
-                    sf::Vector2f scaled{ b.size.x * b.scale, b.size.y * b.scale };
-                    sf::Vector2f topLeft{
-                        b.pos.x + (b.size.x - scaled.x)*0.5f,
-                        b.pos.y + (b.size.y - scaled.y)*0.5f
-                    };
-                    sf::FloatRect bounds(topLeft, scaled);
-                    if (bounds.contains(mp)) {
-                        if (b.id == "start")      { choice.start = true;      return choice; }
-                        if (b.id == "difficulty") { choice.openDifficulty = true; return choice; }
-                        if (b.id == "exit")       { choice.exit = true;       return choice; }
-                    }
-                }
+        // --- Click sur les boutons rectangulaires (rectangle affiché)
+        auto mpv = win_.mapPixelToCoords(sf::Vector2i{m->position.x, m->position.y});
+        for (auto& b : buttons_) {
+            if (b.node->shownRect().contains(mpv)) {
+                if (b.id == "start")      return choose(&MenuChoice::start);
+                if (b.id == "difficulty") return choose(&MenuChoice::openDifficulty);
+                if (b.id == "exit")       return choose(&MenuChoice::exit);
             }
         }
+        return true;
+    }
+    if (const auto* m = ev.getIf<sf::Event::MouseButtonReleased>()) {
+        if (m->button != sf::Mouse::Button::Left) return false;
+        sliderMusic_.dragging = false;
+        sliderSfx_.dragging   = false;
+        return true;
+    }
+    return false;
+}
+
+std::optional<MenuChoice> Menu::takeChoice() {
+    auto c = pendingChoice_;
+    pendingChoice_.reset();
+    return c;
+}
+
+// ---- update: un pas de simulation fixe
+void Menu::update(float dt) {
+    PROFILE_SCOPE("Menu::update");
+    // Mémorise l'état courant pour l'interpolation au rendu
+    prevAnimTime_    = animTime_;
+    prevTitlePulseT_ = titlePulseT_;
+    for (auto& b : buttons_) {
+        b.prevScale = b.scale;
+        b.prevHover = b.hover;
     }
 
+    // Temps animé pour le glow + pulsation du titre
+    animTime_    += dt;
+    titlePulseT_ += dt;
+
     // Hover/focus des boutons
     auto mouse = win_.mapPixelToCoords(sf::Mouse::getPosition(win_));
-    updateHoverFocus(mouse);
+    updateHoverFocus(mouse, dt);
 
-    // MAJ pourcentages sliders
-    if (pctMusic_) pctMusic_->setString(std::to_string((int)std::round(musicVol01_*100)) + "%");
-    if (pctSfx_)   pctSfx_->setString  (std::to_string((int)std::round(sfxVol01_*100))   + "%");
-
-    // Dessin (sans clear/display)
-    draw();
-    return std::nullopt;
+    // MAJ pourcentages sliders (mise en page seulement si la valeur change)
+    setPercent(*pctMusic_, musicVol01_);
+    setPercent(*pctSfx_,   sfxVol01_);
 }
 
-// ---- render: alias (utile si tu préfères appeler depuis App::run())
-void Menu::render() { draw(); }
+// ---- render: dessin interpolé (alpha = fraction du tick suivant déjà écoulée)
+void Menu::render(SpriteBatch& batch, float alpha) { draw(batch, clamp01(alpha)); }
 
 void Menu::setDifficultySubtitle(const std::string& text) {
     for (auto& b : buttons_) {
-        if (b.id == "difficulty" && b.label) {
-            b.label->setString("Difficulty\n" + text);
-            b.label->setLineSpacing(0.9f);
-        }
+        if (b.id != "difficulty") continue;
+        UiLabel& label = b.node->label();
+        label.edit().setString("Difficulty\n" + text);
+        label.edit().setLineSpacing(0.9f);
+        label.centerOrigin();
     }
 }
 
-// ---- Assets
-void Menu::loadAssets() {
-    // Police + icônes
-    loadFont("../assets/fonts/Roboto-Regular.ttf");
-
-    // Utiliser des PNG (SFML ne charge pas SVG, et .ico pas partout)
-   /*  loadTexture(icoStart_, "assets/images/start.png");
-    loadTexture(icoGear_,  "assets/images/gear.png");   // icône gear pour les boutons ET le bouton rond
-    loadTexture(icoExit_,  "assets/images/exit.png");*/
-
-    // Fond d'écran (cover)
-    if (loadTexture(texBg_, "../assets/images/background.png")) {
-        bg_ = std::make_unique<sf::Sprite>(texBg_);
-    }
-
-    // Fond du petit cadre (image)
-    if (loadTexture(texCardBg_, "../assets/images/first-bg.png")) {
-        cardBg_ = std::make_unique<sf::Sprite>(texCardBg_);
-    }
-
-    // Texture de bouton arrondi (optionnelle)
-    loadTexture(texBtn_, "assets/images/btn.png");
+// ---- Assets (via le cache : décodage en arrière-plan, upload GPU dans pump())
+void Menu::loadAssets(AssetCache& assets, ShaderManager& shaders) {
+    assets.requestFont("fonts/Roboto-Regular_2.ttf", [this](AssetCache::FontHandle f) {
+        if (!f) return;
+        font_ = std::move(f);
+        // Les textes ont été créés avec la police vide : rebrancher et recentrer
+        for (UiLabel* t : {title_, titleShadow_, optTitle_, lblMusic_, lblSfx_, pctMusic_, pctSfx_}) {
+            t->edit().setFont(*font_);
+        }
+        for (auto& b : buttons_) {
+            b.node->label().edit().setFont(*font_);
+            b.node->label().centerOrigin();
+        }
+        positionElements();
+    });
+
+    // Images : atlas généré à la compilation, sinon PNG un par un
+    atlas_.request(assets, TD_ATLAS_DIR "/atlas.json", "images", [this](bool) {
+        bg_->setSprite(atlas_.makeSprite("background")); // fond d'écran (cover)
+        cardBg_->setSprite(atlas_.makeSprite("first-bg")); // fond du petit cadre
+        positionElements();
+    });
+
+    // Shaders (compilés au démarrage par l'App) : le cadre et les boutons
+    // restent en formes unies jusque-là
+    shaders.whenReady(ShaderId::Panel, [this](ShaderProgram& p) {
+        panelU_ = PanelUniforms{p.uniform("u_size"),      p.uniform("u_radius"),
+                                p.uniform("u_innerA"),    p.uniform("u_innerB"),
+                                p.uniform("u_shadowCol"), p.uniform("u_borderCol"),
+                                p.uniform("u_time"),      p.uniform("u_fillAlpha")};
+        p.set(panelU_.radius,    cornerRadius_);
+        p.set(panelU_.innerA,    sf::Glsl::Vec4{0.13f, 0.15f, 0.22f, 0.98f});
+        p.set(panelU_.innerB,    sf::Glsl::Vec4{0.09f, 0.11f, 0.17f, 0.98f});
+        p.set(panelU_.shadowCol, sf::Glsl::Vec4{0.0f, 0.0f, 0.0f, 0.55f});
+        p.set(panelU_.borderCol, sf::Glsl::Vec4{0.40f, 0.60f, 1.0f, 0.70f});
+        card_->setShader(p.shader());
+    });
+    shaders.whenReady(ShaderId::Button, [this](ShaderProgram&) {
+        for (auto& b : buttons_) b.node->setShader(&buttonShader_);
+    });
 }
 
 // ---- Layout
 void Menu::buildLayout() {
+    UiNode& root = ui_.root();
+
+    // Fond, ombre, image du cadre, overlay shader, voile (dans l'ordre des couches)
+    bg_         = &root.add<UiImage>(kLayerBg, sf::Color(16,20,30));
+    dropShadow_ = &root.add<UiPanel>(kLayerShadow, sf::Color(0,0,0,105));
+    cardBg_     = &root.add<UiImage>(kLayerCard);
+    card_       = &root.add<UiPanel>(kLayerPanel);
+    soft_       = &root.add<UiPanel>(kLayerSoft, sf::Color(0,0,0,48));
+
     // Titre principal
-    title_ = std::make_unique<sf::Text>(font_, sf::String("Tower Defense"), 50u);
-    title_->setFillColor(sf::Color(235, 245, 255));
-    title_->setOutlineThickness(2.f);
-    title_->setOutlineColor(sf::Color(20, 30, 50, 200));
+    Label title(text_, currentFont(), "Tower Defense", 50u);
+    title.setFillColor(sf::Color(235, 245, 255));
+    title.setOutlineThickness(2.f);
+    title.setOutlineColor(sf::Color(20, 30, 50, 200));
 
     // Ombre du titre
-    titleShadow_ = std::make_unique<sf::Text>(*title_);
-    titleShadow_->setFillColor(sf::Color(0,0,0,1));
-    titleShadow_->setOutlineThickness(0.f);
+    Label shadow(title);
+    shadow.setFillColor(sf::Color(0,0,0,1));
+    shadow.setOutlineThickness(0.f);
+
+    titleShadow_ = &root.add<UiLabel>(kLayerTitle, std::move(shadow));
+    title_       = &root.add<UiLabel>(kLayerTitle, std::move(title));
 
     // Boutons
     buttons_.clear();
-    auto makeBtn = [&](const std::string& id, const std::string& text, const sf::Texture* icon) {
+    auto makeBtn = [&](const std::string& id, const std::string& text, const TextureAtlas::Region* icon,
+                       const UiButton::Theme& theme) {
+        Label label(text_, currentFont(), text, 26u);
+        label.setFillColor(sf::Color(235, 240, 250));
+        label.setOutlineThickness(1.f);
+        label.setOutlineColor(sf::Color(20, 30, 50, 160));
+
         MenuButton b;
         b.id   = id;
-        b.size = {360.f, 56.f};
-
-        b.label = std::make_unique<sf::Text>(font_, sf::String(text), 26u);
-        const auto lb = b.label->getLocalBounds();
-        b.label->setOrigin({lb.position.x + lb.size.x * 0.5f, lb.position.y + lb.size.y * 0.5f});
-        b.label->setFillColor(sf::Color(235, 240, 250));
-        b.label->setOutlineThickness(1.f);
-        b.label->setOutlineColor(sf::Color(20, 30, 50, 160));
-
-        if (icon && icon->getSize().x > 0) {
-            b.icon = std::make_unique<sf::Sprite>(*icon);
-            b.icon->setScale({0.6f, 0.6f});
+        b.node = &root.add<UiButton>(kLayerButtons, kLayerLabels, std::move(label));
+        b.node->label().centerOrigin();
+        b.node->setTheme(theme);
+        b.node->setRadius(btnRadius_);
+        b.node->setSize({360.f, 56.f});
+
+        if (icon) {
+            auto sprite = std::make_unique<sf::Sprite>(*icon->texture, icon->rect);
+            sprite->setScale({0.6f, 0.6f});
+            b.node->setIcon(std::move(sprite));
         }
-        return b;
+        buttons_.push_back(b);
     };
 
-    buttons_.push_back(makeBtn("start",      "Start",      &icoStart_));
-    buttons_.push_back(makeBtn("difficulty", "Difficulty", &icoGear_));
-    buttons_.push_back(makeBtn("exit",       "Exit",       &icoExit_));
-
-    // Bouton circulaire "Settings"
-    gearButton_.setRadius(26.f);
-    gearButton_.setFillColor(sf::Color(35,40,52));
-    gearButton_.setOutlineThickness(0.f);
-
-    if (icoGear_.getSize().x > 0) {
-        gearIcon_ = std::make_unique<sf::Sprite>(icoGear_);
-        gearIcon_->setScale(sf::Vector2f{0.7f, 0.7f});
-    }
+    // Icônes (start/gear/exit sont dans l'atlas) : désactivées, les PNG font
+    // 800 px et débordent des boutons à l'échelle 0.6
+    const TextureAtlas::Region* icoStart = nullptr;
+    const TextureAtlas::Region* icoGear  = nullptr;
+    const TextureAtlas::Region* icoExit  = nullptr;
 
     // Thèmes couleurs par bouton
-    for (auto& b : buttons_) {
-        if (b.id == "start") {
-            b.fillA       = sf::Color(255, 170,  90, 180);
-            b.fillB       = sf::Color( 85, 200, 120, 180);
-            b.border      = sf::Color(255, 185, 110, 180);
-
-            b.hoverFillA  = sf::Color(255, 155,  70, 255);
-            b.hoverFillB  = sf::Color( 70,  210, 140, 255);
-            b.hoverBorder = sf::Color(255, 205, 130, 255);
-        }
-        else if (b.id == "difficulty") {
-            b.fillA       = sf::Color(120, 170, 255, 180);
-            b.fillB       = sf::Color(255, 170,  90, 180);
-            b.border      = sf::Color(180, 210, 255, 190);
-
-            b.hoverFillA  = sf::Color(140, 190, 255, 255);
-            b.hoverFillB  = sf::Color(255, 150,  70, 255);
-            b.hoverBorder = sf::Color(210, 230, 255, 255);
-        }
-        else if (b.id == "exit") {
-            b.fillA       = sf::Color(220,  80,  80, 180);
-            b.fillB       = sf::Color(255, 150,  70, 180);
-            b.border      = sf::Color(255, 170, 120, 190);
-
-            b.hoverFillA  = sf::Color(240,  70,  70, 255);
-            b.hoverFillB  = sf::Color(255, 140,  60, 255);
-            b.hoverBorder = sf::Color(255, 190, 140, 255);
-        }
+    UiButton::Theme startTheme;
+    startTheme.fillA       = sf::Color(255, 170,  90, 180);
+    startTheme.fillB       = sf::Color( 85, 200, 120, 180);
+    startTheme.border      = sf::Color(255, 185, 110, 180);
+    startTheme.hoverFillA  = sf::Color(255, 155,  70, 255);
+    startTheme.hoverFillB  = sf::Color( 70,  210, 140, 255);
+    startTheme.hoverBorder = sf::Color(255, 205, 130, 255);
+
+    UiButton::Theme difficultyTheme;
+    difficultyTheme.fillA       = sf::Color(120, 170, 255, 180);
+    difficultyTheme.fillB       = sf::Color(255, 170,  90, 180);
+    difficultyTheme.border      = sf::Color(180, 210, 255, 190);
+    difficultyTheme.hoverFillA  = sf::Color(140, 190, 255, 255);
+    difficultyTheme.hoverFillB  = sf::Color(255, 150,  70, 255);
+    difficultyTheme.hoverBorder = sf::Color(210, 230, 255, 255);
+
+    UiButton::Theme exitTheme;
+    exitTheme.fillA       = sf::Color(220,  80,  80, 180);
+    exitTheme.fillB       = sf::Color(255, 150,  70, 180);
+    exitTheme.border      = sf::Color(255, 170, 120, 190);
+    exitTheme.hoverFillA  = sf::Color(240,  70,  70, 255);
+    exitTheme.hoverFillB  = sf::Color(255, 140,  60, 255);
+    exitTheme.hoverBorder = sf::Color(255, 190, 140, 255);
+
+    makeBtn("start",      "Start",      icoStart, startTheme);
+    makeBtn("difficulty", "Difficulty", icoGear,  difficultyTheme);
+    makeBtn("exit",       "Exit",       icoExit,  exitTheme);
+
+    // Bouton circulaire "Settings"
+    gear_ = &root.add<UiPanel>(kLayerGear, sf::Color(35,40,52), UiPanel::Shape::Circle);
+    gear_->setSize({2.f * kGearRadius, 2.f * kGearRadius});
+
+    gearIcon_ = &root.add<UiImage>(kLayerGearIcon);
+    if (icoGear) {
+        auto sprite = std::make_unique<sf::Sprite>(*icoGear->texture, icoGear->rect);
+        sprite->setScale(sf::Vector2f{0.7f, 0.7f});
+        gearIcon_->setSprite(std::move(sprite));
     }
 }
 
 void Menu::buildSettings() {
-    optShadow_.setSize(optSize_ + sf::Vector2f{18.f, 22.f});
-    optShadow_.setFillColor(sf::Color(0,0,0,100));
-
-    optTitle_ = std::make_unique<sf::Text>(font_, sf::String("Options"), 28u);
-    optTitle_->setFillColor(sf::Color(235,245,255));
-
-    lblMusic_ = std::make_unique<sf::Text>(font_, sf::String("Music"), 20u);
-    lblSfx_   = std::make_unique<sf::Text>(font_, sf::String("SFX"),   20u);
-    for (auto* t : {lblMusic_.get(), lblSfx_.get()}) {
-        t->setFillColor(sf::Color(215,220,230));
-    }
-
-    pctMusic_ = std::make_unique<sf::Text>(font_, sf::String("80%"), 18u);
-    pctSfx_   = std::make_unique<sf::Text>(font_, sf::String("80%"), 18u);
-    for (auto* t : {pctMusic_.get(), pctSfx_.get()}) {
-        t->setFillColor(sf::Color(235,245,255));
-    }
-
-    // sliders – zone cliquable (barre)
-    sliderMusic_.size = {280.f, 10.f};
-    sliderSfx_.size   = {280.f, 10.f};
-    sliderMusic_.value01 = musicVol01_;
-    sliderSfx_.value01   = sfxVol01_;
+    // Panneau masqué tant qu'il est fermé : sa géométrie reste en cache
+    options_ = &ui_.root().add<UiNode>();
+    options_->setVisible(optionsOpen_);
+
+    optShadow_ = &options_->add<UiPanel>(kLayerOptPanel, sf::Color(0,0,0,100));
+    optFrame_  = &options_->add<UiPanel>(kLayerOptPanel, sf::Color(32,36,48,240));
+
+    // sliders – zone cliquable (barre) ; même lot que le cadre (ils ne touchent pas les textes)
+    sliderMusic_.node = &options_->add<UiSlider>(kLayerOptPanel);
+    sliderSfx_.node   = &options_->add<UiSlider>(kLayerOptPanel);
+    sliderMusic_.node->setValue(musicVol01_);
+    sliderSfx_.node->setValue(sfxVol01_);
+
+    auto makeLabel = [&](const char* text, unsigned size, sf::Color color) {
+        Label label(text_, currentFont(), text, size);
+        label.setFillColor(color);
+        return &options_->add<UiLabel>(kLayerOptText, std::move(label));
+    };
+    optTitle_ = makeLabel("Options", 28u, sf::Color(235,245,255));
+    lblMusic_ = makeLabel("Music",   20u, sf::Color(215,220,230));
+    lblSfx_   = makeLabel("SFX",     20u, sf::Color(215,220,230));
+    pctMusic_ = makeLabel("80%",     18u, sf::Color(235,245,255));
+    pctSfx_   = makeLabel("80%",     18u, sf::Color(235,245,255));
 }
 
 void Menu::positionElements() {
@@ -364,122 +347,126 @@ void Menu::positionElements() {
     // --- Cadre central (card)
     cardPos_ = sf::Vector2f{ center.x - cardSize_.x * 0.5f,
                              center.y - cardSize_.y * 0.5f };
-
-    // --- Fond "cover"
-    if (bg_) {
-        const auto tex = bg_->getTexture().getSize();
+    card_->setPosition(cardPos_);
+    card_->setSize(cardSize_);
+
+    // --- Fond "cover" (uni sur toute la vue en attendant l'image)
+    bg_->setSize(viewSize);
+    if (bg_->hasSprite()) {
+        sf::Sprite& bg = *bg_->editSprite();
+        const auto tex = bg.getTextureRect().size;
         const float sx = viewSize.x / static_cast<float>(tex.x);
         const float sy = viewSize.y / static_cast<float>(tex.y);
         const float s  = std::max(sx, sy);
-        bg_->setScale(sf::Vector2f{ s, s });
-        bg_->setPosition(sf::Vector2f{ 0.f, 0.f });
+        bg.setScale(sf::Vector2f{ s, s });
+        bg.setPosition(sf::Vector2f{ 0.f, 0.f });
     }
 
     // --- Image du cadre
-    if (cardBg_) {
-        const sf::Vector2u texSz = texCardBg_.getSize();
+    if (cardBg_->hasSprite()) {
+        sf::Sprite& cardBg = *cardBg_->editSprite();
+        const sf::Vector2i texSz = cardBg.getTextureRect().size;
         const sf::Vector2f scale{ 0.66f, 0.48f };
-        cardBg_->setScale(scale);
+        cardBg.setScale(scale);
 
         const sf::Vector2f scaledSize{
             static_cast<float>(texSz.x) * scale.x,
             static_cast<float>(texSz.y) * scale.y
         };
         const sf::Vector2f cardCenter = cardPos_ + cardSize_ * 0.5f;
-        cardBg_->setPosition(cardCenter - scaledSize * 0.5f);
+        cardBg.setPosition(cardCenter - scaledSize * 0.5f);
     }
 
     // --- Ombre sous le cadre
-    dropShadow_.setSize(cardSize_ + sf::Vector2f{ 18.f, 24.f });
-    dropShadow_.setPosition(cardPos_ + sf::Vector2f{ -9.f, 7.f });
-    dropShadow_.setFillColor(sf::Color(0, 0, 0, 105));
+    dropShadow_->setSize(cardSize_ + sf::Vector2f{ 18.f, 24.f });
+    dropShadow_->setPosition(cardPos_ + sf::Vector2f{ -9.f, 7.f });
+
+    // --- Voile sur le cadre (échelle verticale 0.95 depuis le coin haut-gauche)
+    const sf::Vector2f softSize = cardSize_ + sf::Vector2f{36.f, 42.f};
+    soft_->setPosition(cardPos_ + sf::Vector2f{-18.f, 12.f});
+    soft_->setSize({softSize.x, softSize.y * 0.95f});
 
-    // --- Titre
-    const sf::FloatRect tb = title_->getLocalBounds();
-    const sf::Vector2f tpos{ tb.position.x, tb.position.y };
-    const sf::Vector2f tsz { tb.size.x,     tb.size.y     };
-    title_->setOrigin(sf::Vector2f{ tpos.x + tsz.x * 0.5f, tpos.y + tsz.y * 0.5f });
-    title_->setPosition(sf::Vector2f{ center.x, cardPos_.y - 56.f });
+    // --- Titre (et son ombre, 2 px plus bas)
+    const sf::Vector2f titlePos{ center.x, cardPos_.y - 56.f };
+    title_->centerOrigin();
+    title_->edit().setPosition(titlePos);
+    titleShadow_->centerOrigin();
+    titleShadow_->edit().setPosition(titlePos + sf::Vector2f{0.f, 2.f});
 
     // --- Boutons rectangulaires
     const float gap = 20.f;
     const float top = cardPos_.y + 86.f;
     for (std::size_t i = 0; i < buttons_.size(); ++i) {
-        auto& b = buttons_[i];
-
-        b.size = sf::Vector2f{ 360.f, 56.f };
-        const float bx = cardPos_.x + (cardSize_.x - b.size.x) * 0.5f;
-        const float by = top + static_cast<float>(i) * (b.size.y + gap);
-        b.pos = sf::Vector2f{ bx, by };
-
-        // Label centré
-        b.label->setPosition(sf::Vector2f{ bx + b.size.x * 0.5f, by + b.size.y * 0.5f });
-
-        // Icône à gauche si présente
-        if (b.hasIcon()) {
-            const sf::Vector2u texSz = b.icon->getTexture().getSize();
-            b.icon->setScale(sf::Vector2f{ 0.6f, 0.6f });
-            const float scaledH = static_cast<float>(texSz.y) * b.icon->getScale().y;
-            const float iy = by + (b.size.y - scaledH) * 0.5f;
-            b.icon->setPosition(sf::Vector2f{ bx + 16.f, iy });
-
-            // Décale légèrement le texte si icône
-            b.label->setPosition(sf::Vector2f{ bx + b.size.x * 0.5f + 10.f, by + b.size.y * 0.5f });
-        }
+        UiButton& b = *buttons_[i].node;
+
+        const sf::Vector2f size{ 360.f, 56.f };
+        const float bx = cardPos_.x + (cardSize_.x - size.x) * 0.5f;
+        const float by = top + static_cast<float>(i) * (size.y + gap);
+        b.setPosition(sf::Vector2f{ bx, by });
+        b.setSize(size);
+
+        // Label centré (le zoom se fait autour du centre : il ne bouge pas),
+        // légèrement décalé si icône
+        const float iconTextOffset = b.hasIcon() ? 10.f : 0.f;
+        b.label().edit().setPosition(sf::Vector2f{ bx + size.x * 0.5f + iconTextOffset, by + size.y * 0.5f });
     }
 
     // --- Bouton "settings" (gear)
-    const sf::Vector2f gearCenter{
-        cardPos_.x + cardSize_.x - 26.f - 14.f,
-        cardPos_.y - 34.f
-    };
-    gearButton_.setPosition(gearCenter - sf::Vector2f{ gearButton_.getRadius(), gearButton_.getRadius() });
-    if (gearIcon_) {
-        const sf::Vector2f gpos = gearButton_.getPosition();
-        gearIcon_->setPosition(gpos + sf::Vector2f{ 6.f, 6.f });
-    }
+    const sf::Vector2f gearPos = gearCenter() - sf::Vector2f{ kGearRadius, kGearRadius };
+    gear_->setPosition(gearPos);
+    if (gearIcon_->hasSprite()) gearIcon_->editSprite()->setPosition(gearPos + sf::Vector2f{ 6.f, 6.f });
 
     // --- Panneau "Options"
     positionSettings();
 }
 
+sf::Vector2f Menu::gearCenter() const {
+    return { cardPos_.x + cardSize_.x - kGearRadius - 14.f, cardPos_.y - 34.f };
+}
+
 // -- Hover/clavier : met à jour l'état des boutons
-void Menu::updateHoverFocus(const sf::Vector2f& mouse) {
+void Menu::updateHoverFocus(const sf::Vector2f& mouse, float dt) {
+    const float kScale = smoothFactor(0.25f, dt);
+    const float kHover = smoothFactor(0.30f, dt);
+    // Fin de transition : valeur posée exactement sur la cible, sinon le
+    // lissage exponentiel changerait la géométrie à chaque frame
+    auto settle = [](float& v, float target) {
+        if (std::abs(target - v) < 1e-3f) v = target;
+    };
     for (std::size_t i = 0; i < buttons_.size(); ++i) {
         auto& b = buttons_[i];
 
-        const sf::FloatRect rect(b.pos, b.size);
-        b.hovered = rect.contains(mouse);
+        b.hovered = b.node->contains(mouse);
         b.focused = (static_cast<int>(i) == focusIndex_);
 
         const bool hot = b.hovered || b.focused;
 
         b.targetScale = hot ? 1.06f : 1.0f;
-        b.scale += (b.targetScale - b.scale) * 0.25f;
+        b.scale += (b.targetScale - b.scale) * kScale;
+        settle(b.scale, b.targetScale);
 
         const float targetHover = hot ? 1.f : 0.f;
-        b.hover += (targetHover - b.hover) * 0.30f;
-        if (b.hover < 0.f) b.hover = 0.f;
-        if (b.hover > 1.f) b.hover = 1.f;
+        b.hover += (targetHover - b.hover) * kHover;
+        settle(b.hover, targetHover);
+        b.hover = clamp01(b.hover);
 
-        b.label->setFillColor(hot ? sf::Color(245, 248, 255)
-                                  : sf::Color(235, 240, 250));
+        // Sans effet si la couleur est déjà la bonne
+        b.node->label().setFillColor(hot ? sf::Color(245, 248, 255)
+                                         : sf::Color(235, 240, 250));
     }
 }
 
 void Menu::positionSettings() {
     const sf::Vector2f center = cardPos_ + cardSize_ * 0.5f;
     optPos_  = center - optSize_ * 0.5f - sf::Vector2f{0.f, cardSize_.y*0.10f};
-    optShadow_.setPosition(optPos_ + sf::Vector2f{-9.f, 7.f});
+    optShadow_->setPosition(optPos_ + sf::Vector2f{-9.f, 7.f});
+    optShadow_->setSize(optSize_ + sf::Vector2f{18.f, 22.f});
+    optFrame_->setPosition(optPos_);
+    optFrame_->setSize(optSize_);
 
     // Titre
-    if (optTitle_) {
-        const auto tb = optTitle_->getLocalBounds();
-        optTitle_->setOrigin(sf::Vector2f{tb.position.x + tb.size.x * 0.5f,
-                                          tb.position.y + tb.size.y * 0.5f});
-        optTitle_->setPosition(sf::Vector2f{optPos_.x + optSize_.x * 0.5f,
-                                            optPos_.y + 28.f});
-    }
+    optTitle_->centerOrigin();
+    optTitle_->edit().setPosition(sf::Vector2f{optPos_.x + optSize_.x * 0.5f, optPos_.y + 28.f});
 
     // Références horizontales
     const float left   = optPos_.x + 36.f;
@@ -487,208 +474,72 @@ void Menu::positionSettings() {
     const float y1     = optPos_.y + 70.f;
     const float y2     = y1 + 56.f;
 
-    if (lblMusic_) lblMusic_->setPosition(sf::Vector2f{left,  y1 - 14.f});
-    if (lblSfx_)   lblSfx_->setPosition  (sf::Vector2f{left,  y2 - 14.f});
-
-    const int pctMusic = static_cast<int>(std::round(musicVol01_ * 100.f));
-    const int pctSfx   = static_cast<int>(std::round(sfxVol01_   * 100.f));
-
-    if (pctMusic_) {
-        pctMusic_->setString(std::to_string(pctMusic) + "%");
-        const auto pb = pctMusic_->getLocalBounds();
-        pctMusic_->setOrigin(sf::Vector2f{pb.position.x + pb.size.x, pb.position.y});
-        pctMusic_->setPosition(sf::Vector2f{right, y1 - 20.f});
-    }
-    if (pctSfx_) {
-        pctSfx_->setString(std::to_string(pctSfx) + "%");
-        const auto pb = pctSfx_->getLocalBounds();
-        pctSfx_->setOrigin(sf::Vector2f{pb.position.x + pb.size.x, pb.position.y});
-        pctSfx_->setPosition(sf::Vector2f{right, y2 - 20.f});
-    }
-
-    sliderMusic_.pos     = sf::Vector2f{left, y1};
-    sliderSfx_.pos       = sf::Vector2f{left, y2};
-    sliderMusic_.size.x  = std::max(140.f, optSize_.x - 36.f - 36.f - 70.f);
-    sliderSfx_.size.x    = sliderMusic_.size.x;
-
-    sliderMusic_.size.y  = (sliderMusic_.size.y > 0.f) ? sliderMusic_.size.y : 10.f;
-    sliderSfx_.size.y    = (sliderSfx_.size.y   > 0.f) ? sliderSfx_.size.y   : 10.f;
+    lblMusic_->edit().setPosition(sf::Vector2f{left, y1 - 14.f});
+    lblSfx_->edit().setPosition  (sf::Vector2f{left, y2 - 14.f});
 
+    // Alignés à droite (origine recalculée : la police a pu changer)
     musicVol01_ = clamp01(musicVol01_);
     sfxVol01_   = clamp01(sfxVol01_);
+    setPercent(*pctMusic_, musicVol01_);
+    setPercent(*pctSfx_,   sfxVol01_);
+    pctMusic_->rightAlignOrigin();
+    pctSfx_->rightAlignOrigin();
+    pctMusic_->edit().setPosition(sf::Vector2f{right, y1 - 20.f});
+    pctSfx_->edit().setPosition  (sf::Vector2f{right, y2 - 20.f});
+
+    const sf::Vector2f barSize{std::max(140.f, optSize_.x - 36.f - 36.f - 70.f), 10.f};
+    sliderMusic_.node->setPosition(sf::Vector2f{left, y1});
+    sliderSfx_.node->setPosition  (sf::Vector2f{left, y2});
+    sliderMusic_.node->setSize(barSize);
+    sliderSfx_.node->setSize(barSize);
+    sliderMusic_.node->setValue(musicVol01_);
+    sliderSfx_.node->setValue(sfxVol01_);
 }
 
-void Menu::draw() {
-    // Fond
-    if (bg_) win_.draw(*bg_);
-
-    // Ombre douce large
-    win_.draw(dropShadow_);
-
-    // 1) Image de fond du cadre si disponible
-    if (cardBg_) win_.draw(*cardBg_);
-
-    // 2) Overlay shader (ombre/glow + remplissage optionnel)
-    if (shaderOk_) {
-        sf::RectangleShape panel(cardSize_);
-        panel.setPosition(cardPos_);
-
-        panelShader_.setUniform("u_pos",       sf::Glsl::Vec2{cardPos_.x, cardPos_.y});
-        panelShader_.setUniform("u_size",      sf::Glsl::Vec2{cardSize_.x, cardSize_.y});
-        panelShader_.setUniform("u_radius",    cornerRadius_);
-        panelShader_.setUniform("u_innerA",    sf::Glsl::Vec4{0.13f, 0.15f, 0.22f, 0.98f});
-        panelShader_.setUniform("u_innerB",    sf::Glsl::Vec4{0.09f, 0.11f, 0.17f, 0.98f});
-        panelShader_.setUniform("u_shadowCol", sf::Glsl::Vec4{0.0f, 0.0f, 0.0f, 0.55f});
-        panelShader_.setUniform("u_borderCol", sf::Glsl::Vec4{0.40f, 0.60f, 1.0f, 0.70f});
-        panelShader_.setUniform("u_time",      animTime_);
+void Menu::draw(SpriteBatch& batch, float alpha) {
+    PROFILE_SCOPE("Menu::draw");
+    // Valeurs animées interpolées entre les deux derniers ticks ; les nœuds
+    // ne sont reconstruits que si la valeur affichée change
+    animT_ = lerp(prevAnimTime_, animTime_, alpha);
+    const float pulseT = lerp(prevTitlePulseT_, titlePulseT_, alpha);
 
-        float fillAlpha = cardBg_ ? 0.f : 1.f;
-        panelShader_.setUniform("u_fillAlpha", fillAlpha);
+    // Titre (avec légère pulsation/ombre) ; textes vides tant que la police manque
+    const float tPulse = 1.f + 0.02f * std::sin(pulseT * 2.2f);
+    titleShadow_->edit().setScale({tPulse, tPulse});
+    title_->edit().setScale({tPulse, tPulse});
 
-        sf::RenderStates rs; rs.shader = &panelShader_;
-        win_.draw(panel, rs);
-    }
-
-    // Titre (avec légère pulsation/ombre)
-    titlePulseT_ += 0.016f;
-    float tPulse = 1.f + 0.02f * std::sin(titlePulseT_ * 2.2f);
-
-    sf::RectangleShape soft(cardSize_ + sf::Vector2f{36.f, 42.f});
-    soft.setPosition(cardPos_ + sf::Vector2f{-18.f, 12.f});
-    soft.setFillColor(sf::Color(0,0,0,48));
-    soft.setScale({1.f, 0.95f});
-    win_.draw(soft);
-
-    titleShadow_->setPosition(title_->getPosition() + sf::Vector2f{0.f, 2.f});
-    titleShadow_->setScale({tPulse, tPulse});
-    win_.draw(*titleShadow_);
-
-    title_->setScale({tPulse, tPulse});
-    win_.draw(*title_);
-
-    // Boutons (shader + texte + icône)
+    // Boutons : zoom et hover affichés
     for (auto& b : buttons_) {
-        sf::Vector2f scaledSize{ b.size.x * b.scale, b.size.y * b.scale };
-        sf::Vector2f topLeft{
-            b.pos.x + (b.size.x - scaledSize.x) * 0.5f,
-            b.pos.y + (b.size.y - scaledSize.y) * 0.5f
-        };
-
-        sf::RectangleShape quad(scaledSize);
-        quad.setPosition(topLeft);
-
-        if (btnShaderOk_) {
-            auto lerp = [](float a, float b, float t){ return a + (b - a) * t; };
-            auto lerpColor = [&](sf::Color A, sf::Color B, float t){
-                auto L = [&](std::uint8_t x, std::uint8_t y){
-                    float xf = static_cast<float>(x);
-                    float yf = static_cast<float>(y);
-                    return static_cast<std::uint8_t>(std::lround(lerp(xf, yf, t)));
-                };
-                return sf::Color(L(A.r, B.r), L(A.g, B.g), L(A.b, B.b), L(A.a, B.a));
-            };
-            auto toVec4 = [](sf::Color c){
-                return sf::Glsl::Vec4{ c.r/255.f, c.g/255.f, c.b/255.f, c.a/255.f };
-            };
-
-            sf::Color curA      = lerpColor(b.fillA,      b.hoverFillA,   b.hover);
-            sf::Color curB      = lerpColor(b.fillB,      b.hoverFillB,   b.hover);
-            sf::Color curBorder = lerpColor(b.border,     b.hoverBorder,  b.hover);
-
-            float h = std::clamp(b.hover, 0.f, 1.f);
-            float smoothHover = std::clamp((h - 0.06f) / 0.94f, 0.f, 1.f);
-
-            buttonShader_.setUniform("u_hover",     smoothHover);
-            buttonShader_.setUniform("u_pos",       sf::Glsl::Vec2{topLeft.x, topLeft.y});
-            buttonShader_.setUniform("u_size",      sf::Glsl::Vec2{scaledSize.x, scaledSize.y});
-            buttonShader_.setUniform("u_radius",    btnRadius_);
-            buttonShader_.setUniform("u_fillA",     toVec4(curA));
-            buttonShader_.setUniform("u_fillB",     toVec4(curB));
-            buttonShader_.setUniform("u_borderCol", toVec4(curBorder));
-            buttonShader_.setUniform("u_time",      animTime_);
-
-            sf::RenderStates rs; rs.shader = &buttonShader_;
-            win_.draw(quad, rs);
-        } else {
-            quad.setFillColor(b.hover > 0.5f ? b.hoverFillA : b.fillA);
-            win_.draw(quad);
-        }
-
-        if (b.hasIcon()) {
-            auto texSz   = b.icon->getTexture().getSize();
-            float sY     = b.icon->getScale().y;
-            float scaledH= static_cast<float>(texSz.y) * sY;
-            float iy     = topLeft.y + (scaledSize.y - scaledH) * 0.5f;
-            b.icon->setPosition({ topLeft.x + 16.f, iy });
-            win_.draw(*b.icon);
-        }
-
-        float centerX = topLeft.x + scaledSize.x * 0.5f;
-        float centerY = topLeft.y + scaledSize.y * 0.5f;
-        float iconTextOffset = b.hasIcon() ? 10.f : 0.f;
-        b.label->setPosition({ centerX + iconTextOffset, centerY });
-        win_.draw(*b.label);
+        b.node->setAnim(lerp(b.prevScale, b.scale, alpha), lerp(b.prevHover, b.hover, alpha));
     }
 
-    // Bouton gear (hover = léger zoom)
-    gearButton_.setScale(gearHover_ ? sf::Vector2f{1.06f, 1.06f} : sf::Vector2f{1.f, 1.f});
-    win_.draw(gearButton_);
-    if (gearIcon_) win_.draw(*gearIcon_);
-
-    // Panneau Options
-    if (optionsOpen_) drawSettings();
-}
+    // Reconstruit les nœuds sales puis rejoue la géométrie en cache
+    ui_.draw(batch);
 
-void Menu::drawSettings() {
-    // Ombre
-    win_.draw(optShadow_);
-
-    // Cadre simple (tu peux le remplacer par le shader panel si tu veux)
-    sf::RectangleShape panel(optSize_);
-    panel.setPosition(optPos_);
-    panel.setFillColor(sf::Color(32,36,48,240));
-    panel.setOutlineThickness(0.f);
-    win_.draw(panel);
-
-    // Titre + libellés
-    if (optTitle_)  win_.draw(*optTitle_);
-    if (lblMusic_)  win_.draw(*lblMusic_);
-    if (lblSfx_)    win_.draw(*lblSfx_);
-    if (pctMusic_)  win_.draw(*pctMusic_);
-    if (pctSfx_)    win_.draw(*pctSfx_);
-
-    // Sliders
-    auto drawSlider = [&](Slider& s, float val01){
-        sf::RectangleShape bar(s.size);
-        bar.setPosition(s.pos);
-        bar.setFillColor(sf::Color(60,66,82));
-        win_.draw(bar);
-
-        sf::RectangleShape fill({ s.size.x * clamp01(val01), s.size.y });
-        fill.setPosition(s.pos);
-        fill.setFillColor(sf::Color(90,160,255));
-        win_.draw(fill);
-
-        float x = s.pos.x + s.size.x * clamp01(val01);
-        float y = s.pos.y + s.size.y * 0.5f;
-        sf::CircleShape handle(8.f);
-        handle.setOrigin({8.f,8.f});
-        handle.setPosition({x,y});
-        handle.setFillColor(sf::Color(240,245,255));
-        win_.draw(handle);
-    };
-
-    drawSlider(sliderMusic_, musicVol01_);
-    drawSlider(sliderSfx_,   sfxVol01_);
+    // Uniforms de la frame (avant le flush de l'App) : seul ce qui a changé
+    // part au GPU, en pratique le temps et les boutons en transition
+    buttonShader_.upload(animT_);
+    if (panelShader_.ready()) {
+        panelShader_.set(panelU_.size,      sf::Glsl::Vec2{cardSize_.x, cardSize_.y});
+        panelShader_.set(panelU_.time,      animT_);
+        panelShader_.set(panelU_.fillAlpha, cardBg_->hasSprite() ? 0.f : 1.f);
+    }
 }
 
 // ---- Utils
-bool Menu::loadFont(const std::string& path)  { return font_.openFromFile(path); }
-bool Menu::loadTexture(sf::Texture& t, const std::string& path) {
-    t.setSmooth(true);
-    return t.loadFromFile(path);
+void Menu::setPercent(UiLabel& label, float v01) {
+    // Formatage sans allocation ; rien n'est touché si le texte est identique
+    char buf[8];
+    auto [end, ec] = std::to_chars(buf, buf + sizeof buf - 1, static_cast<int>(std::round(v01 * 100.f)));
+    *end++ = '%';
+    const std::string_view str(buf, static_cast<std::size_t>(end - buf));
+    if (str == label.get().getString()) return;
+    label.edit().setString(str);
+    // Aligné à droite
+    label.rightAlignOrigin();
 }
 
+
 bool Menu::hitCircle(const sf::Vector2f& p, const sf::Vector2f& c, float r) const {
     const float dx = p.x - c.x;
     const float dy = p.y - c.y;
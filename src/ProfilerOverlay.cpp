@@ -0,0 +1,152 @@
+#include "ProfilerOverlay.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+namespace {
+constexpr float kPad      = 10.f;
+constexpr float kWidth    = 420.f;
+constexpr float kGraphH   = 90.f;
+constexpr float kLineH    = 18.f;
+constexpr float kValuesX  = kWidth - kPad; // bord droit des colonnes chiffrées
+
+const sf::Color kBack(12, 14, 20, 210);
+const sf::Color kBar(90, 160, 255);
+const sf::Color kBarSlow(255, 110, 90);      // au-delà de 60 Hz
+const sf::Color kP99(255, 215, 90);
+const sf::Color kBudget(255, 255, 255, 50);  // 16.7 / 33.3 ms
+} // namespace
+
+ProfilerOverlay::ProfilerOverlay(AssetCache& assets, TextSystem& text) : text_(text) {
+    header_ = std::make_unique<Label>(text_, noFont_, "", 15u);
+    for (std::size_t i = 0; i < kTopScopes; ++i) {
+        names_.push_back(std::make_unique<Label>(text_, noFont_, "", 14u));
+        values_.push_back(std::make_unique<Label>(text_, noFont_, "", 14u));
+    }
+    assets.requestFont("fonts/Roboto-Regular_2.ttf", [this](AssetCache::FontHandle f) {
+        if (!f) return;
+        font_ = std::move(f);
+        header_->setFont(*font_);
+        for (auto& l : names_)  l->setFont(*font_);
+        for (auto& l : values_) l->setFont(*font_);
+    });
+}
+
+bool ProfilerOverlay::handleEvent(const sf::Event& ev) {
+    const auto* k = ev.getIf<sf::Event::KeyPressed>();
+    if (!k) return false;
+    if (k->scancode == sf::Keyboard::Scan::F3) {
+        visible_ = !visible_;
+        updateEnabled();
+        return true;
+    }
+    if (k->scancode == sf::Keyboard::Scan::F4) {
+        if (!capturing_) {
+            // Les tampons ne gardent que les ~kRingSize dernières portées par thread
+            capturing_ = true;
+            Profiler::clear();
+            updateEnabled();
+            std::cerr << "[Profiler] capture started (F4 again to write it)\n";
+        } else {
+            writeCapture();
+        }
+        return true;
+    }
+    return false;
+}
+
+void ProfilerOverlay::writeCapture() {
+    capturing_ = false;
+    std::error_code ec;
+    std::filesystem::create_directories("profiles", ec);
+    const auto stamp = std::chrono::system_clock::now().time_since_epoch() / std::chrono::seconds(1);
+    Profiler::writeChromeTrace("profiles/trace-" + std::to_string(stamp) + ".json");
+    updateEnabled();
+}
+
+void ProfilerOverlay::frame(float ms) {
+    // Historique tenu même masqué : le graphe est plein dès l'ouverture
+    times_.push(ms);
+    if (!visible_) return;
+    ++framesSinceRefresh_;
+    const std::int64_t now = Profiler::nowNs();
+    if (now - lastRefreshNs_ >= kRefreshNs) refresh();
+}
+
+void ProfilerOverlay::refresh() {
+    const std::int64_t now = Profiler::nowNs();
+    // Portées de la dernière période, ramenées à une frame
+    const auto events = Profiler::collect(std::max(lastRefreshNs_, now - kRefreshNs));
+    top_ = Profiler::topScopes(events, kTopScopes);
+    const double perFrame = framesSinceRefresh_ ? 1.0 / framesSinceRefresh_ : 0.0;
+
+    char buf[128];
+    std::snprintf(buf, sizeof(buf), "frame %.2f ms   avg %.2f   p99 %.2f   (%.0f fps)",
+                  times_.last(), times_.average(), times_.lastP99(),
+                  times_.average() > 0.f ? 1000.f / times_.average() : 0.f);
+    header_->setString(buf);
+
+    for (std::size_t i = 0; i < kTopScopes; ++i) {
+        if (i < top_.size()) {
+            const ScopeStat& s = top_[i];
+            names_[i]->setString(s.name);
+            std::snprintf(buf, sizeof(buf), "%.3f ms  self %.3f  x%.1f",
+                          s.totalMs * perFrame, s.selfMs * perFrame, s.calls * perFrame);
+            values_[i]->setString(buf);
+        } else {
+            names_[i]->setString("");
+            values_[i]->setString("");
+        }
+        const sf::FloatRect b = values_[i]->getLocalBounds();
+        values_[i]->setOrigin({b.position.x + b.size.x, 0.f});
+    }
+    lastRefreshNs_      = now;
+    framesSinceRefresh_ = 0;
+}
+
+void ProfilerOverlay::render(SpriteBatch& batch, sf::Vector2f view) {
+    if (!visible_) return;
+    PROFILE_SCOPE("ProfilerOverlay::render");
+
+    const std::size_t rows   = std::min(top_.size(), kTopScopes);
+    const float       height = kPad * 3.f + kLineH + kGraphH + kLineH * static_cast<float>(rows);
+    const sf::Vector2f origin{view.x - kWidth - kPad, kPad};
+    batch.rect(origin, {kWidth, height}, kBack, kLayer);
+
+    float y = origin.y + kPad;
+    header_->setPosition({origin.x + kPad, y});
+    header_->draw(batch, kLayer);
+    y += kLineH + kPad;
+
+    // Graphe : une barre par frame, le 99e centile glissant par-dessus
+    const float graphW = kWidth - 2.f * kPad;
+    const float barW   = graphW / static_cast<float>(FrameTimes::kHistory);
+    const float scale  = kGraphH / kGraphMs;
+    const float bottom = y + kGraphH;
+    for (const float ms : {1000.f / 60.f, 1000.f / 30.f}) {
+        batch.rect({origin.x + kPad, bottom - ms * scale}, {graphW, 1.f}, kBudget, kLayer);
+    }
+    const std::size_t n  = times_.size();
+    const float       x0 = origin.x + kPad + graphW - barW * static_cast<float>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float ms = std::min(times_.frame(i), kGraphMs);
+        const float x  = x0 + barW * static_cast<float>(i);
+        batch.rect({x, bottom - ms * scale}, {std::max(barW - 0.5f, 0.5f), ms * scale},
+                   ms > 1000.f / 60.f + 0.5f ? kBarSlow : kBar, kLayer);
+        const float p = std::min(times_.p99(i), kGraphMs);
+        batch.rect({x, bottom - p * scale - 1.f}, {barW, 2.f}, kP99, kLayer);
+    }
+    y = bottom + kPad;
+
+    // Portées les plus coûteuses (par frame)
+    for (std::size_t i = 0; i < rows; ++i) {
+        names_[i]->setPosition({origin.x + kPad, y});
+        names_[i]->draw(batch, kLayer);
+        values_[i]->setPosition({origin.x + kValuesX, y});
+        values_[i]->draw(batch, kLayer);
+        y += kLineH;
+    }
+}
@@ -0,0 +1,233 @@
+#include "ScoreClient.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+ScoreClient::ScoreClient(std::string host, unsigned short port)
+: host_(std::move(host)), port_(port), thread_([this] { run(); }) {}
+
+ScoreClient::~ScoreClient() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+// ============================
+//  Côté appelant
+// ============================
+void ScoreClient::submit(ScoreEntry e) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.size() >= kMaxQueue) {
+            queue_.pop_front();
+            ++stats_.dropped;
+        }
+        queue_.push_back(std::move(e));
+    }
+    wake_.notify_one();
+}
+
+void ScoreClient::watchTop(const std::string& difficulty, std::uint32_t n) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = std::find_if(watched_.begin(), watched_.end(),
+                                     [&](const Watched& w) { return w.difficulty == difficulty; });
+        if (it != watched_.end()) {
+            it->n = std::max(it->n, n);
+        } else {
+            watched_.push_back(Watched{difficulty, n, {}});
+        }
+        refreshNow_ = true;
+    }
+    wake_.notify_one();
+}
+
+std::vector<ScoreEntry> ScoreClient::top(const std::string& difficulty) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const Watched& w : watched_) {
+        if (w.difficulty == difficulty) return w.top;
+    }
+    return {};
+}
+
+ScoreClient::Stats ScoreClient::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats s  = stats_;
+    s.queued = queue_.size();
+    return s;
+}
+
+// ============================
+//  Thread réseau
+// ============================
+void ScoreClient::run() {
+    Rng             rng(static_cast<std::uint64_t>(Clock::now().time_since_epoch().count()));
+    const Backoff   backoff;
+    std::uint32_t   failures    = 0;
+    Clock::time_point retryAt     = Clock::now();
+    Clock::time_point nextRefresh = Clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        const Clock::time_point now = Clock::now();
+        const bool canTry   = now >= retryAt;
+        const bool refresh  = !watched_.empty() && (refreshNow_ || now >= nextRefresh);
+        if (!canTry || (queue_.empty() && !refresh)) {
+            // Réveillé par submit/watchTop, la fin du backoff ou le prochain rafraîchissement
+            if (!canTry)                wake_.wait_until(lock, retryAt);
+            else if (!watched_.empty()) wake_.wait_until(lock, nextRefresh);
+            else                        wake_.wait(lock);
+            continue;
+        }
+        refreshNow_ = false;
+        lock.unlock();
+
+        bool ok = connect() && sendQueued();
+        if (ok && refresh) {
+            ok = refreshTops();
+            if (ok) nextRefresh = Clock::now() + kRefresh;
+        }
+        if (ok) {
+            failures = 0;
+        } else {
+            disconnect();
+            retryAt = Clock::now() + std::chrono::milliseconds(backoff.delayMs(++failures, rng));
+        }
+
+        lock.lock();
+        stats_.connected = connected_;
+        if (stop_) break; // échange abandonné, pas un échec
+        if (!ok) {
+            ++stats_.failures;
+            // Le lot non acquitté repasse devant (il a pu être reçu : le
+            // serveur le comptera alors deux fois, on préfère ça à le perdre)
+            for (auto it = inflight_.rbegin(); it != inflight_.rend(); ++it) queue_.push_front(std::move(*it));
+            inflight_.clear();
+            while (queue_.size() > kMaxQueue) {
+                queue_.pop_front();
+                ++stats_.dropped;
+            }
+            if (refresh) refreshNow_ = true;
+        }
+    }
+}
+
+bool ScoreClient::connect() {
+    if (connected_) return true;
+    if (!address_) {
+        // Nom inconnu (ou pas encore de réseau) : réessayé avec le backoff
+        address_ = sf::IpAddress::resolve(host_);
+        if (!address_) {
+            if (!unknownHost_) std::cerr << "[Online] Unknown leaderboard host " << host_ << "\n";
+            unknownHost_ = true;
+            return false;
+        }
+    }
+    socket_.setBlocking(true);
+    if (socket_.connect(*address_, port_, sf::milliseconds(static_cast<std::int32_t>(kTimeout.count()))) !=
+        sf::Socket::Status::Done) {
+        return false;
+    }
+    socket_.setBlocking(false);
+    selector_.clear();
+    selector_.add(socket_);
+    in_.clear();
+    connected_ = true;
+    return true;
+}
+
+void ScoreClient::disconnect() {
+    if (!connected_) return;
+    selector_.clear();
+    socket_.disconnect();
+    connected_ = false;
+}
+
+bool ScoreClient::exchange(ScoreMessageView& reply) {
+    const Clock::time_point deadline = Clock::now() + kTimeout;
+    std::size_t sent = 0;
+    while (sent < out_.size()) {
+        std::size_t n = 0;
+        const sf::Socket::Status st = socket_.send(out_.data() + sent, out_.size() - sent, n);
+        sent += n;
+        if (st == sf::Socket::Status::Done) continue;
+        if (st != sf::Socket::Status::NotReady && st != sf::Socket::Status::Partial) return false;
+        if (Clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1)); // tampon d'envoi plein
+    }
+
+    char buf[16384];
+    while (!in_.next(reply)) {
+        if (in_.error()) return false;
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+        if (left.count() <= 0) return false;
+        if (!selector_.wait(sf::milliseconds(static_cast<std::int32_t>(left.count())))) continue;
+        std::size_t n = 0;
+        const sf::Socket::Status st = socket_.receive(buf, sizeof(buf), n);
+        if (n > 0) in_.append(buf, n);
+        if (st != sf::Socket::Status::Done && st != sf::Socket::Status::NotReady &&
+            st != sf::Socket::Status::Partial) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ScoreClient::sendQueued() {
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) return false; // un seul échange en cours à l'arrêt, pas toute la file
+            if (queue_.empty()) return true;
+            const std::size_t n = std::min(kMaxBatch, queue_.size());
+            inflight_.assign(std::make_move_iterator(queue_.begin()),
+                             std::make_move_iterator(queue_.begin() + static_cast<std::ptrdiff_t>(n)));
+            queue_.erase(queue_.begin(), queue_.begin() + static_cast<std::ptrdiff_t>(n));
+        }
+        out_.clear();
+        encodeSubmit(inflight_.data(), inflight_.size(), out_);
+        ScoreMessageView m;
+        std::uint32_t accepted = 0;
+        if (!exchange(m) || !decodeSubmitAck(m, accepted) || accepted != inflight_.size()) return false;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.sent += accepted;
+        ++stats_.batches;
+        inflight_.clear();
+    }
+}
+
+bool ScoreClient::refreshTops() {
+    std::vector<std::pair<std::string, std::uint32_t>> wanted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const Watched& w : watched_) wanted.emplace_back(w.difficulty, w.n);
+    }
+    // Toutes les requêtes d'un coup, réponses dans l'ordre
+    out_.clear();
+    for (const auto& [difficulty, n] : wanted) encodeTopQuery(difficulty, n, out_);
+
+    std::vector<ScoreEntry> top;
+    for (std::size_t i = 0; i < wanted.size(); ++i) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) return false;
+        }
+        ScoreMessageView m;
+        std::string      difficulty;
+        std::uint64_t    total = 0;
+        if (!exchange(m) || !decodeTopReply(m, difficulty, total, top)) return false;
+        out_.clear(); // envoyé avec la première attente
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Watched& w : watched_) {
+            if (w.difficulty == difficulty) w.top = std::move(top);
+        }
+        ++stats_.refreshes;
+        topVersion_.fetch_add(1, std::memory_order_release);
+    }
+    return true;
+}
@@ -0,0 +1,199 @@
+#include "ShaderManager.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+// ============================
+//  Shader panel (cadre)
+// ============================
+// Coordonnées locales du quad en pixels dans gl_TexCoord[0] (haut-gauche = 0)
+constexpr const char* kPanelFragment = R"GLSL(
+uniform vec2  u_size;
+uniform float u_radius;
+uniform vec4  u_innerA;
+uniform vec4  u_innerB;
+uniform vec4  u_shadowCol;
+uniform vec4  u_borderCol;
+uniform float u_time;
+uniform float u_fillAlpha; // 0 = pas de remplissage, 1 = remplir
+
+float sdRoundBox(vec2 p, vec2 b, float r){
+    vec2 q = abs(p) - (b - vec2(r));
+    return length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;
+}
+
+void main() {
+    vec2 uv = gl_TexCoord[0].xy;
+    vec2 halfSize = u_size * 0.5;
+    vec2 p = uv - halfSize;
+
+    float d = sdRoundBox(p, halfSize, u_radius);
+
+    // intérieur (dégradé innerA en bas -> innerB en haut)
+    float alpha = smoothstep(0.0, -1.5, d);
+    float gy = clamp(1.0 - uv.y / u_size.y, 0.0, 1.0);
+    vec4 inner = mix(u_innerA, u_innerB, gy) * u_fillAlpha;
+
+    // ombre soft extérieure
+    float shadowEdge = 28.0;
+    float shadowAmt = 1.0 - clamp(d / shadowEdge, 0.0, 1.0);
+    vec4 shadowCol = u_shadowCol * shadowAmt * (1.0 - alpha);
+
+    // bord brillant
+    float pulse = 0.5 + 0.5 * sin(u_time * 2.6);
+    float borderMask = smoothstep(2.0, 0.0, abs(d));
+    vec4 borderCol = u_borderCol * borderMask * (0.25 + 0.75 * pulse);
+
+    vec4 fill = inner * alpha;
+    vec4 col = shadowCol + fill + borderCol;
+    col.a = max(max(fill.a, borderCol.a), shadowCol.a);
+    gl_FragColor = col;
+}
+)GLSL";
+
+// ============================
+//  Shader button (boutons, tous en un draw)
+// ============================
+// Paramètres par bouton dans des tableaux d'uniforms, indexés par la
+// composante rouge de la couleur des sommets ; coordonnées locales en uv
+constexpr const char* kButtonVertex = R"GLSL(
+uniform vec4 u_box[8];    // taille.xy, rayon, hover
+uniform vec4 u_fillA[8];
+uniform vec4 u_fillB[8];
+uniform vec4 u_border[8];
+
+varying vec2 v_local;
+varying vec4 v_box;
+varying vec4 v_fillA;
+varying vec4 v_fillB;
+varying vec4 v_border;
+
+void main() {
+    int i = int(gl_Color.r * 255.0 + 0.5);
+    v_local  = gl_MultiTexCoord0.xy;
+    v_box    = u_box[i];
+    v_fillA  = u_fillA[i];
+    v_fillB  = u_fillB[i];
+    v_border = u_border[i];
+    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+}
+)GLSL";
+
+constexpr const char* kButtonFragment = R"GLSL(
+uniform float u_time;
+
+varying vec2 v_local;
+varying vec4 v_box;
+varying vec4 v_fillA;
+varying vec4 v_fillB;
+varying vec4 v_border;
+
+float sdRoundBox(vec2 p, vec2 b, float r){
+    vec2 q = abs(p) - (b - vec2(r));
+    return length(max(q,0.0)) + min(max(q.x,q.y),0.0) - r;
+}
+
+void main() {
+    vec2  size  = v_box.xy;
+    float hover = v_box.w;
+    vec2 halfSize = size * 0.5;
+    vec2 p = v_local - halfSize;
+    float d = sdRoundBox(p, halfSize, v_box.z);
+
+    float alpha = smoothstep(0.0, -1.2, d);
+    float gy = clamp(1.0 - v_local.y / size.y, 0.0, 1.0);
+
+    // bord toujours visible, plus fort en hover + pulse
+    float pulse = 0.5 + 0.5 * sin(u_time * 3.0);
+    float borderMask  = smoothstep(2.0, 0.0, abs(d));
+    float borderAlpha = mix(0.30, 1.0, hover) * (0.65 + 0.35 * pulse);
+    vec4 border = v_border * borderMask * borderAlpha;
+
+    // remplissage apparaît avec le hover (gradient)
+    vec4 inner = mix(vec4(0.0), mix(v_fillA, v_fillB, gy), hover);
+
+    vec4 col = inner * alpha + border;
+    col.a = max(inner.a * alpha, border.a);
+    gl_FragColor = col;
+}
+)GLSL";
+
+struct Source {
+    const char* name;
+    const char* vertex; // nullptr : pipeline fixe de SFML
+    const char* fragment;
+};
+constexpr std::array<Source, static_cast<std::size_t>(ShaderId::Count)> kSources = {{
+    {"panel",  nullptr,       kPanelFragment},
+    {"button", kButtonVertex, kButtonFragment},
+}};
+
+} // namespace
+
+// ---- Programme
+int ShaderProgram::uniform(const std::string& name) {
+    for (std::size_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].name == name) return static_cast<int>(i);
+    }
+    slots_.push_back(Slot{name, {}});
+    return static_cast<int>(slots_.size() - 1);
+}
+
+bool ShaderProgram::changed(int slot, const float* v, std::size_t n) {
+    if (!ready_) return false;
+    std::vector<float>& last = slots_[static_cast<std::size_t>(slot)].value;
+    if (last.size() == n && std::equal(v, v + n, last.begin())) return false;
+    last.assign(v, v + n);
+    ++*uploads_;
+    return true;
+}
+
+void ShaderProgram::set(int slot, float v) {
+    if (changed(slot, &v, 1)) shader_.setUniform(slots_[static_cast<std::size_t>(slot)].name, v);
+}
+
+void ShaderProgram::set(int slot, sf::Glsl::Vec2 v) {
+    const float f[2] = {v.x, v.y};
+    if (changed(slot, f, 2)) shader_.setUniform(slots_[static_cast<std::size_t>(slot)].name, v);
+}
+
+void ShaderProgram::set(int slot, sf::Glsl::Vec4 v) {
+    const float f[4] = {v.x, v.y, v.z, v.w};
+    if (changed(slot, f, 4)) shader_.setUniform(slots_[static_cast<std::size_t>(slot)].name, v);
+}
+
+void ShaderProgram::setArray(int slot, const sf::Glsl::Vec4* v, std::size_t count) {
+    static_assert(sizeof(sf::Glsl::Vec4) == 4 * sizeof(float));
+    if (changed(slot, &v->x, 4 * count)) shader_.setUniformArray(slots_[static_cast<std::size_t>(slot)].name, v, count);
+}
+
+// ---- Manager
+ShaderManager::ShaderManager() {
+    for (auto& p : programs_) p.uploads_ = &uploads_;
+}
+
+void ShaderManager::compileAll(AssetLoader& loader) {
+    for (std::size_t i = 0; i < kCount; ++i) {
+        loader.submit({}, [this, i] {
+            const Source& src = kSources[i];
+            ShaderProgram& p  = programs_[i];
+            p.ready_ = src.vertex ? p.shader_.loadFromMemory(src.vertex, src.fragment)
+                                  : p.shader_.loadFromMemory(src.fragment, sf::Shader::Type::Fragment);
+            auto callbacks = std::move(waiting_[i]);
+            waiting_[i].clear();
+            if (!p.ready_) {
+                std::cerr << "[Shaders] cannot compile " << src.name << ", using plain shapes\n";
+                return;
+            }
+            for (auto& cb : callbacks) cb(p);
+        });
+    }
+}
+
+void ShaderManager::whenReady(ShaderId id, std::function<void(ShaderProgram&)> fn) {
+    ShaderProgram& p = get(id);
+    if (p.ready_) fn(p);
+    else          waiting_[static_cast<std::size_t>(id)].push_back(std::move(fn));
+}
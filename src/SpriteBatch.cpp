@@ -0,0 +1,220 @@
+#include "SpriteBatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sim/Profiler.hpp"
+
+namespace {
+
+bool sameState(int layerA, const sf::Shader* shaderA, const sf::Texture* texA,
+               int layerB, const sf::Shader* shaderB, const sf::Texture* texB) {
+    return layerA == layerB && shaderA == shaderB && texA == texB;
+}
+
+// Clé de tri : couche, puis shader, puis texture
+bool keyLess(int layerA, const void* shaderA, const void* texA,
+             int layerB, const void* shaderB, const void* texB) {
+    if (layerA != layerB)   return layerA < layerB;
+    if (shaderA != shaderB) return std::less<const void*>{}(shaderA, shaderB);
+    return std::less<const void*>{}(texA, texB);
+}
+
+void appendQuad(std::vector<sf::Vertex>& v, const sf::Vector2f (&p)[4], sf::Color c,
+                sf::Vector2f uv0, sf::Vector2f uv1) {
+    // Deux triangles (SFML 3 n'a plus de primitive Quads)
+    const sf::Vector2f t[4] = {{uv0.x, uv0.y}, {uv1.x, uv0.y}, {uv1.x, uv1.y}, {uv0.x, uv1.y}};
+    for (int i : {0, 1, 3, 3, 1, 2}) v.push_back(sf::Vertex{p[i], c, t[i]});
+}
+
+} // namespace
+
+void SpriteBatch::push(int layer, const sf::Shader* shader, const sf::Texture* texture, std::uint32_t first) {
+    ++stats_.items;
+    const std::uint32_t end = static_cast<std::uint32_t>(verts_.size());
+    if (!items_.empty()) {
+        Item& last = items_.back();
+        if (!last.isCustom && last.first + last.count == first &&
+            sameState(last.layer, last.shader, last.texture, layer, shader, texture)) {
+            last.count = end - last.first;
+            return;
+        }
+    }
+    items_.push_back(Item{layer, shader, texture, first, end - first, false});
+}
+
+void SpriteBatch::rect(sf::Vector2f pos, sf::Vector2f size, sf::Color color, int layer) {
+    const sf::Vector2f p[4] = {pos, {pos.x + size.x, pos.y}, pos + size, {pos.x, pos.y + size.y}};
+    quad(p, color, layer);
+}
+
+void SpriteBatch::quad(const sf::Vector2f (&corners)[4], sf::Color color, int layer,
+                       const sf::Texture* texture, sf::FloatRect uv, const sf::Shader* shader) {
+    const auto first = static_cast<std::uint32_t>(verts_.size());
+    appendQuad(verts_, corners, color, uv.position, uv.position + uv.size);
+    push(layer, shader, texture, first);
+}
+
+sf::Vertex* SpriteBatch::reserveQuads(std::size_t count, int layer, const sf::Texture* texture) {
+    if (count == 0) return nullptr;
+    const auto first = static_cast<std::uint32_t>(verts_.size());
+    verts_.resize(verts_.size() + count * 6);
+    push(layer, nullptr, texture, first);
+    stats_.items += static_cast<std::uint32_t>(count - 1); // push en compte un
+    return verts_.data() + first;
+}
+
+void SpriteBatch::writeRect(sf::Vertex* quad, sf::Vector2f pos, sf::Vector2f size, sf::Color color) {
+    // Mêmes sommets que rect() : deux triangles 0-1-3, 3-1-2
+    const sf::Vector2f p[4] = {pos, {pos.x + size.x, pos.y}, pos + size, {pos.x, pos.y + size.y}};
+    int k = 0;
+    for (int i : {0, 1, 3, 3, 1, 2}) quad[k++] = sf::Vertex{p[i], color, {}};
+}
+
+void SpriteBatch::circle(sf::Vector2f center, float radius, sf::Color color, int layer, unsigned points) {
+    const auto first = static_cast<std::uint32_t>(verts_.size());
+    const float step = 6.2831853f / static_cast<float>(points);
+    sf::Vector2f prev{center.x + radius, center.y};
+    for (unsigned i = 1; i <= points; ++i) {
+        const float a = step * static_cast<float>(i);
+        const sf::Vector2f cur{center.x + radius * std::cos(a), center.y + radius * std::sin(a)};
+        verts_.push_back(sf::Vertex{center, color, {}});
+        verts_.push_back(sf::Vertex{prev, color, {}});
+        verts_.push_back(sf::Vertex{cur, color, {}});
+        prev = cur;
+    }
+    push(layer, nullptr, nullptr, first);
+}
+
+void SpriteBatch::sprite(const sf::Sprite& s, int layer) {
+    const sf::IntRect   r  = s.getTextureRect();
+    const sf::Transform xf = s.getTransform();
+    const sf::Vector2f  sz{std::abs(static_cast<float>(r.size.x)), std::abs(static_cast<float>(r.size.y))};
+    const sf::Vector2f  p[4] = {
+        xf.transformPoint({0.f, 0.f}),  xf.transformPoint({sz.x, 0.f}),
+        xf.transformPoint(sz),          xf.transformPoint({0.f, sz.y}),
+    };
+    const sf::FloatRect uv{sf::Vector2f(r.position), sf::Vector2f(r.size)};
+    quad(p, s.getColor(), layer, &s.getTexture(), uv);
+}
+
+void SpriteBatch::mesh(const std::vector<sf::Vertex>& v, const sf::Transform& xf, sf::Color color, int layer,
+                       const sf::Texture* texture) {
+    const auto first = static_cast<std::uint32_t>(verts_.size());
+    for (const sf::Vertex& src : v) verts_.push_back(sf::Vertex{xf.transformPoint(src.position), color, src.texCoords});
+    push(layer, nullptr, texture, first);
+}
+
+void SpriteBatch::custom(int layer, std::function<void(sf::RenderTarget&)> draw) {
+    ++stats_.items;
+    items_.push_back(Item{layer, nullptr, nullptr, static_cast<std::uint32_t>(customs_.size()), 0, true});
+    customs_.push_back(std::move(draw));
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target) {
+    PROFILE_SCOPE("SpriteBatch::flush");
+    order_.resize(items_.size());
+    for (std::uint32_t i = 0; i < order_.size(); ++i) order_[i] = i;
+    auto less = [&](std::uint32_t a, std::uint32_t b) {
+        const Item& A = items_[a];
+        const Item& B = items_[b];
+        // Un dessin libre ne se regroupe avec rien : sa clé est son rang
+        const void* sa = A.isCustom ? static_cast<const void*>(&A) : A.shader;
+        const void* sb = B.isCustom ? static_cast<const void*>(&B) : B.shader;
+        return keyLess(A.layer, sa, A.texture, B.layer, sb, B.texture);
+    };
+    // Déjà dans l'ordre (cas courant : soumission par couche) : pas de copie
+    const bool inOrder = std::is_sorted(order_.begin(), order_.end(), less);
+    if (!inOrder) std::stable_sort(order_.begin(), order_.end(), less);
+
+    std::size_t i = 0;
+    while (i < order_.size()) {
+        const Item& head = items_[order_[i]];
+        if (head.isCustom) {
+            customs_[head.first](target);
+            ++stats_.drawCalls;
+            ++i;
+            continue;
+        }
+
+        // Suite d'items de même shader/texture -> un seul draw (même à cheval
+        // sur deux couches : l'ordre de dessin reste celui du tri)
+        std::size_t j = i + 1;
+        while (j < order_.size()) {
+            const Item& it = items_[order_[j]];
+            if (it.isCustom || it.shader != head.shader || it.texture != head.texture) break;
+            ++j;
+        }
+
+        const sf::Vertex* data  = nullptr;
+        std::size_t       count = 0;
+        if (inOrder) {
+            // Plages contiguës dans verts_
+            const Item& last = items_[order_[j - 1]];
+            data  = verts_.data() + head.first;
+            count = last.first + last.count - head.first;
+        } else {
+            sorted_.clear();
+            for (std::size_t k = i; k < j; ++k) {
+                const Item& it = items_[order_[k]];
+                sorted_.insert(sorted_.end(), verts_.begin() + it.first, verts_.begin() + it.first + it.count);
+            }
+            data  = sorted_.data();
+            count = sorted_.size();
+        }
+
+        sf::RenderStates rs;
+        rs.texture = head.texture;
+        rs.shader  = head.shader;
+        target.draw(data, count, sf::PrimitiveType::Triangles, rs);
+        ++stats_.drawCalls;
+        if (head.shader) ++stats_.shaderBinds;
+        stats_.vertices += static_cast<std::uint32_t>(count);
+        i = j;
+    }
+
+    items_.clear();
+    verts_.clear();
+    customs_.clear();
+}
+
+void SpriteBatch::record(Recording& rec) {
+    // Copie plutôt que déplacement : les deux côtés gardent leur capacité
+    rec.items_.assign(items_.begin(), items_.end());
+    rec.verts_.assign(verts_.begin(), verts_.end());
+    rec.customs_.assign(customs_.begin(), customs_.end());
+    rec.submitted_ = stats_.items;
+    items_.clear();
+    verts_.clear();
+    customs_.clear();
+    stats_ = Stats{};
+}
+
+void SpriteBatch::replay(const Recording& rec) {
+    const auto base = static_cast<std::uint32_t>(verts_.size());
+    verts_.insert(verts_.end(), rec.verts_.begin(), rec.verts_.end());
+    for (const Item& it : rec.items_) {
+        if (it.isCustom) {
+            items_.push_back(Item{it.layer, nullptr, nullptr, static_cast<std::uint32_t>(customs_.size()), 0, true});
+            customs_.push_back(rec.customs_[it.first]);
+            continue;
+        }
+        const std::uint32_t first = base + it.first;
+        if (!items_.empty()) {
+            Item& last = items_.back();
+            if (!last.isCustom && last.first + last.count == first &&
+                sameState(last.layer, last.shader, last.texture, it.layer, it.shader, it.texture)) {
+                last.count += it.count;
+                continue;
+            }
+        }
+        items_.push_back(Item{it.layer, it.shader, it.texture, first, it.count, false});
+    }
+    stats_.items += rec.submitted_;
+}
+
+SpriteBatch::Stats SpriteBatch::takeStats() {
+    const Stats s = stats_;
+    stats_ = Stats{};
+    return s;
+}
@@ -0,0 +1,192 @@
+#include "TextCache.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "sim/Profiler.hpp"
+
+// ============================
+//  GlyphAtlas
+// ============================
+GlyphAtlas::GlyphAtlas(const sf::Font& font, unsigned size, bool bold, float outline)
+    : font_(&font), size_(size), bold_(bold), outline_(outline) {
+    // Tous les glyphes de la plage passent dans la page de la police d'un coup
+    range_.reserve(kLast - kFirst + 1);
+    for (char32_t c = kFirst; c <= kLast; ++c) range_.push_back(fetch(c));
+}
+
+GlyphInfo GlyphAtlas::fetch(char32_t c) const {
+    const sf::Glyph& g = font_->getGlyph(c, size_, bold_, outline_);
+    // Avance sans contour, comme sf::Text
+    const float advance = outline_ != 0.f ? font_->getGlyph(c, size_, bold_).advance : g.advance;
+    return GlyphInfo{advance, g.bounds, sf::FloatRect(g.textureRect)};
+}
+
+const GlyphInfo& GlyphAtlas::glyph(char32_t c) {
+    if (c >= kFirst && c <= kLast) return range_[c - kFirst];
+    auto it = extra_.find(c);
+    if (it == extra_.end()) it = extra_.emplace(c, fetch(c)).first;
+    return it->second;
+}
+
+// ============================
+//  TextSystem
+// ============================
+std::size_t TextSystem::KeyHash::operator()(const Key& k) const {
+    std::size_t h = std::hash<std::string>{}(k.utf8);
+    auto mix = [&](std::size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+    mix(std::hash<const void*>{}(k.style.font));
+    mix(k.style.size);
+    mix(k.style.bold);
+    mix(std::hash<float>{}(k.style.outline));
+    mix(std::hash<float>{}(k.style.lineSpacing));
+    return h;
+}
+
+GlyphAtlas& TextSystem::atlas(const sf::Font& font, unsigned size, bool bold, float outline) {
+    const TextStyle key{&font, size, bold, outline, 1.f};
+    for (auto& [k, a] : atlasKeys_) {
+        if (k == key) return *a;
+    }
+    atlases_.push_back(std::make_unique<GlyphAtlas>(font, size, bold, outline));
+    atlasKeys_.emplace_back(key, atlases_.back().get());
+    return *atlases_.back();
+}
+
+void TextSystem::clearFont(const sf::Font* font) {
+    std::erase_if(atlasKeys_, [&](const auto& p) { return p.first.font == font; });
+    std::erase_if(atlases_, [&](const auto& a) {
+        return std::none_of(atlasKeys_.begin(), atlasKeys_.end(), [&](const auto& p) { return p.second == a.get(); });
+    });
+    std::erase_if(layouts_, [&](const auto& e) { return e.first.style.font == font; });
+}
+
+std::shared_ptr<const TextLayout> TextSystem::layout(std::string_view utf8, const TextStyle& style) {
+    Key key{std::string(utf8), style};
+    auto it = layouts_.find(key);
+    if (it != layouts_.end()) {
+        it->second.lastFrame = frame_;
+        ++stats_.hits;
+        return it->second.layout;
+    }
+    ++stats_.relayouts;
+    auto l = build(utf8, style);
+    layouts_.emplace(std::move(key), Entry{l, frame_});
+    return l;
+}
+
+std::shared_ptr<const TextLayout> TextSystem::build(std::string_view utf8, const TextStyle& style) {
+    PROFILE_SCOPE("TextSystem::build");
+    auto out = std::make_shared<TextLayout>();
+    if (!style.font) return out;
+    const sf::Font& font = *style.font;
+    GlyphAtlas& fillAtlas = atlas(font, style.size, style.bold, 0.f);
+    GlyphAtlas* lineAtlas = style.outline != 0.f ? &atlas(font, style.size, style.bold, style.outline) : nullptr;
+    out->texture = &fillAtlas.texture();
+
+    const sf::String str = sf::String::fromUtf8(utf8.begin(), utf8.end());
+    const float whitespace  = fillAtlas.glyph(U' ').advance;
+    const float lineSpacing = font.getLineSpacing(style.size) * style.lineSpacing;
+
+    float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+    bool  any  = false;
+    auto quad = [&](std::vector<sf::Vertex>& v, sf::Vector2f pos, const GlyphInfo& g) {
+        // Glyphe vide (espace, police pas encore chargée) : rien à dessiner
+        if (g.bounds.size.x <= 0.f || g.bounds.size.y <= 0.f) return;
+        const sf::Vector2f pad{1.f, 1.f}; // même padding que sf::Text
+        const sf::Vector2f p1 = pos + g.bounds.position - pad;
+        const sf::Vector2f p2 = pos + g.bounds.position + g.bounds.size + pad;
+        const sf::Vector2f t1 = g.uv.position - pad;
+        const sf::Vector2f t2 = g.uv.position + g.uv.size + pad;
+        const sf::Vector2f p[4] = {p1, {p2.x, p1.y}, p2, {p1.x, p2.y}};
+        const sf::Vector2f t[4] = {t1, {t2.x, t1.y}, t2, {t1.x, t2.y}};
+        for (int i : {0, 1, 3, 3, 1, 2}) v.push_back(sf::Vertex{p[i], sf::Color::White, t[i]});
+
+        const sf::Vector2f b1 = pos + g.bounds.position;
+        const sf::Vector2f b2 = b1 + g.bounds.size;
+        if (!any) { minX = b1.x; minY = b1.y; maxX = b2.x; maxY = b2.y; any = true; }
+        minX = std::min(minX, b1.x); minY = std::min(minY, b1.y);
+        maxX = std::max(maxX, b2.x); maxY = std::max(maxY, b2.y);
+    };
+
+    float x = 0.f;
+    float y = static_cast<float>(style.size);
+    char32_t prev = 0;
+    for (std::size_t i = 0; i < str.getSize(); ++i) {
+        const char32_t c = str[i];
+        if (c == U'\r') continue;
+        x += font.getKerning(prev, c, style.size, style.bold);
+        prev = c;
+        if (c == U' ')  { x += whitespace; continue; }
+        if (c == U'\t') { x += whitespace * 4.f; continue; }
+        if (c == U'\n') { y += lineSpacing; x = 0.f; continue; }
+
+        if (lineAtlas) quad(out->outline, {x, y}, lineAtlas->glyph(c));
+        const GlyphInfo& g = fillAtlas.glyph(c);
+        quad(out->fill, {x, y}, g);
+        x += g.advance;
+    }
+    // Le contour élargit les bornes, comme sf::Text
+    const float o = std::abs(style.outline);
+    if (any) out->bounds = sf::FloatRect({minX - o, minY - o}, {maxX - minX + 2.f * o, maxY - minY + 2.f * o});
+    return out;
+}
+
+void TextSystem::endFrame() {
+    ++frame_;
+    if (frame_ % 60 != 0) return; // balayage peu fréquent
+    std::erase_if(layouts_, [&](const auto& e) { return frame_ - e.second.lastFrame > kKeepFrames; });
+}
+
+TextSystem::Stats TextSystem::takeStats() {
+    const Stats s = stats_;
+    stats_ = Stats{};
+    return s;
+}
+
+// ============================
+//  Label
+// ============================
+Label::Label(TextSystem& system, const sf::Font& font, std::string_view utf8, unsigned size)
+    : system_(&system), utf8_(utf8) {
+    style_.font = &font;
+    style_.size = size;
+    relayout();
+}
+
+void Label::setString(std::string_view utf8) {
+    if (utf8 == utf8_) return;
+    utf8_.assign(utf8);
+    relayout();
+}
+
+void Label::setFont(const sf::Font& font) {
+    if (style_.font == &font) return;
+    style_.font = &font;
+    relayout();
+}
+
+void Label::setCharacterSize(unsigned size) {
+    if (style_.size == size) return;
+    style_.size = size;
+    relayout();
+}
+
+void Label::setLineSpacing(float factor) {
+    if (style_.lineSpacing == factor) return;
+    style_.lineSpacing = factor;
+    relayout();
+}
+
+void Label::setOutlineThickness(float t) {
+    if (style_.outline == t) return;
+    style_.outline = t;
+    relayout();
+}
+
+void Label::draw(SpriteBatch& batch, int layer) const {
+    if (!layout_->texture) return;
+    const sf::Transform& xf = getTransform();
+    if (!layout_->outline.empty()) batch.mesh(layout_->outline, xf, outlineColor_, layer, layout_->texture);
+    if (!layout_->fill.empty())    batch.mesh(layout_->fill,    xf, fill_,         layer, layout_->texture);
+}
@@ -0,0 +1,84 @@
+#include "TextureAtlas.hpp"
+
+#include <filesystem>
+#include <iostream>
+
+#include "sim/Atlas.hpp"
+
+namespace fs = std::filesystem;
+
+void TextureAtlas::request(AssetCache& cache, const std::string& indexPath, const std::string& looseDir,
+                           std::function<void(bool)> onReady) {
+    // Fichiers de page et régions, depuis l'index ou le dossier d'images
+    std::vector<std::string>   files;
+    std::vector<PendingRegion> regions;
+
+    AtlasIndex idx;
+    if (fs::exists(indexPath) && loadAtlasIndex(indexPath, idx)) {
+        const fs::path dir = fs::path(indexPath).parent_path();
+        for (const auto& p : idx.pages) files.push_back((dir / p.file).string());
+        for (const auto& e : idx.entries) {
+            regions.push_back(PendingRegion{e.name, static_cast<std::size_t>(e.page),
+                                            sf::IntRect{{e.x, e.y}, {e.w, e.h}}});
+        }
+    } else {
+        std::cerr << "[Atlas] " << indexPath << " missing, loading loose images\n";
+        const std::string dir = cache.resolve(looseDir);
+        std::error_code ec;
+        for (const auto& de : fs::recursive_directory_iterator(dir, ec)) {
+            if (!de.is_regular_file() || de.path().extension() != ".png") continue;
+            fs::path rel = fs::relative(de.path(), dir);
+            rel.replace_extension();
+            // Rectangle complet : taille connue à l'arrivée de la texture
+            regions.push_back(PendingRegion{rel.generic_string(), files.size(), {}});
+            files.push_back(de.path().string());
+        }
+    }
+    if (files.empty()) { onReady(false); return; }
+
+    // Les pages arrivent dans n'importe quel ordre : on enregistre tout à la dernière
+    struct Gather {
+        std::vector<AssetCache::TextureHandle> pages;
+        std::vector<PendingRegion>             regions;
+        std::size_t                            remaining = 0;
+        std::function<void(bool)>              onReady;
+    };
+    auto g = std::make_shared<Gather>();
+    g->pages.resize(files.size());
+    g->regions   = std::move(regions);
+    g->remaining = files.size();
+    g->onReady   = std::move(onReady);
+
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        cache.requestTexture(files[i], [this, g, i](AssetCache::TextureHandle tex) {
+            g->pages[i] = std::move(tex);
+            if (--g->remaining > 0) return;
+
+            bool ok = true;
+            const std::size_t base = pages_.size();
+            for (auto& p : g->pages) {
+                ok = ok && p != nullptr;
+                pages_.push_back(std::move(p));
+            }
+            for (const auto& r : g->regions) {
+                const sf::Texture* t = pages_[base + r.page].get();
+                if (!t) continue;
+                sf::IntRect rect = r.rect;
+                if (rect.size.x == 0) rect.size = sf::Vector2i(t->getSize());
+                regions_[r.name] = Region{t, rect};
+            }
+            g->onReady(ok);
+        });
+    }
+}
+
+const TextureAtlas::Region* TextureAtlas::find(std::string_view name) const {
+    auto it = regions_.find(std::string(name));
+    return it != regions_.end() ? &it->second : nullptr;
+}
+
+std::unique_ptr<sf::Sprite> TextureAtlas::makeSprite(std::string_view name) const {
+    const Region* r = find(name);
+    if (!r) return nullptr;
+    return std::make_unique<sf::Sprite>(*r->texture, r->rect);
+}
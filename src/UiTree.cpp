@@ -0,0 +1,233 @@
+#include "UiTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sim/Profiler.hpp"
+
+namespace {
+
+sf::Glsl::Vec4 toVec4(sf::Color c) {
+    return sf::Glsl::Vec4{c.r / 255.f, c.g / 255.f, c.b / 255.f, c.a / 255.f};
+}
+
+sf::Color lerpColor(sf::Color a, sf::Color b, float t) {
+    auto L = [t](std::uint8_t x, std::uint8_t y) {
+        const float xf = static_cast<float>(x);
+        const float yf = static_cast<float>(y);
+        return static_cast<std::uint8_t>(std::lround(xf + (yf - xf) * t));
+    };
+    return sf::Color(L(a.r, b.r), L(a.g, b.g), L(a.b, b.b), L(a.a, b.a));
+}
+
+// Quad d'un shader : uv = coordonnées locales en pixels (haut-gauche = 0)
+void shaderQuad(SpriteBatch& rec, sf::FloatRect r, sf::Color color, int layer, const sf::Shader* shader) {
+    const sf::Vector2f p = r.position, s = r.size;
+    const sf::Vector2f corners[4] = {p, {p.x + s.x, p.y}, p + s, {p.x, p.y + s.y}};
+    rec.quad(corners, color, layer, nullptr, sf::FloatRect({0.f, 0.f}, s), shader);
+}
+
+} // namespace
+
+// ---- Nœud
+void UiNode::setPosition(sf::Vector2f p) {
+    if (p == pos_) return;
+    pos_ = p;
+    markDirty();
+}
+
+void UiNode::setSize(sf::Vector2f s) {
+    if (s == size_) return;
+    size_ = s;
+    markDirty();
+}
+
+void UiNode::markDirty() {
+    dirty_ = true;
+    // Les ancêtres déjà marqués ont aussi les leurs
+    for (UiNode* p = parent_; p && !p->childDirty_; p = p->parent_) p->childDirty_ = true;
+}
+
+std::size_t UiNode::refresh(SpriteBatch& scratch) {
+    std::size_t n = 0;
+    if (dirty_) {
+        build(scratch);
+        scratch.record(geometry_);
+        dirty_ = false;
+        ++n;
+    }
+    if (childDirty_) {
+        childDirty_ = false;
+        for (auto& c : children_) {
+            if (c->dirty_ || c->childDirty_) n += c->refresh(scratch);
+        }
+    }
+    return n;
+}
+
+void UiNode::submit(SpriteBatch& batch) const {
+    if (!visible_) return;
+    if (!geometry_.empty()) batch.replay(geometry_);
+    for (const auto& c : children_) c->submit(batch);
+}
+
+void UiTree::draw(SpriteBatch& batch) {
+    PROFILE_SCOPE("UiTree::draw");
+    rebuilds_ += root_.refresh(scratch_);
+    root_.submit(batch);
+}
+
+// ---- Panneau
+void UiPanel::setFill(sf::Color c) {
+    if (c == fill_) return;
+    fill_ = c;
+    markDirty();
+}
+
+void UiPanel::setShader(const sf::Shader* shader) {
+    shader_ = shader;
+    markDirty();
+}
+
+void UiPanel::build(SpriteBatch& rec) {
+    if (shader_) {
+        shaderQuad(rec, {position(), size()}, sf::Color::White, layer_, shader_);
+    } else if (fill_.a > 0) {
+        if (shape_ == Shape::Circle) rec.circle(position() + size() * 0.5f, size().x * 0.5f, fill_, layer_);
+        else                         rec.rect(position(), size(), fill_, layer_);
+    }
+}
+
+// ---- Image
+void UiImage::setSprite(std::unique_ptr<sf::Sprite> s) {
+    sprite_ = std::move(s);
+    markDirty();
+}
+
+void UiImage::build(SpriteBatch& rec) {
+    if (sprite_)                 rec.sprite(*sprite_, layer_);
+    else if (placeholder_.a > 0) rec.rect(position(), size(), placeholder_, layer_);
+}
+
+// ---- Texte
+void UiLabel::setFillColor(sf::Color c) {
+    if (label_.getFillColor() == c) return;
+    edit().setFillColor(c);
+}
+
+void UiLabel::centerOrigin() {
+    const auto b = label_.getLocalBounds();
+    edit().setOrigin({b.position.x + b.size.x * 0.5f, b.position.y + b.size.y * 0.5f});
+}
+
+void UiLabel::rightAlignOrigin() {
+    const auto b = label_.getLocalBounds();
+    edit().setOrigin({b.position.x + b.size.x, b.position.y});
+}
+
+// ---- Shader des boutons
+UiButtonShader::UiButtonShader(ShaderProgram& program)
+    : program_(program),
+      uBox_(program.uniform("u_box")), uFillA_(program.uniform("u_fillA")),
+      uFillB_(program.uniform("u_fillB")), uBorder_(program.uniform("u_border")),
+      uTime_(program.uniform("u_time")) {}
+
+int UiButtonShader::allocate() {
+    return used_ < kMaxButtons ? used_++ : -1;
+}
+
+void UiButtonShader::setInstance(int slot, const ButtonInstance& params) {
+    const auto i = static_cast<std::size_t>(slot);
+    box_[i]    = params.box;
+    fillA_[i]  = params.fillA;
+    fillB_[i]  = params.fillB;
+    border_[i] = params.border;
+}
+
+void UiButtonShader::upload(float time) {
+    // Le programme compare avec le dernier envoi : un menu immobile n'envoie que le temps
+    const auto n = static_cast<std::size_t>(used_);
+    program_.setArray(uBox_,    box_.data(),    n);
+    program_.setArray(uFillA_,  fillA_.data(),  n);
+    program_.setArray(uFillB_,  fillB_.data(),  n);
+    program_.setArray(uBorder_, border_.data(), n);
+    program_.set(uTime_, time);
+}
+
+// ---- Bouton
+UiButton::UiButton(int layer, int labelLayer, Label label)
+    : UiNode(layer), label_(&add<UiLabel>(labelLayer, std::move(label))), labelLayer_(labelLayer) {}
+
+void UiButton::setRadius(float r) {
+    if (r == radius_) return;
+    radius_ = r;
+    markDirty();
+}
+
+void UiButton::setAnim(float scale, float hover) {
+    if (scale == scale_ && hover == hover_) return;
+    scale_ = scale;
+    hover_ = hover;
+    markDirty();
+}
+
+void UiButton::setShader(UiButtonShader* shader) {
+    if (shader == shader_) return;
+    shader_ = shader;
+    slot_   = shader ? shader->allocate() : -1;
+    markDirty();
+}
+
+void UiButton::setIcon(std::unique_ptr<sf::Sprite> icon) {
+    icon_ = std::move(icon);
+    markDirty();
+}
+
+sf::FloatRect UiButton::shownRect() const {
+    const sf::Vector2f scaled = size() * scale_;
+    return {position() + (size() - scaled) * 0.5f, scaled};
+}
+
+void UiButton::build(SpriteBatch& rec) {
+    const sf::FloatRect r = shownRect();
+
+    if (shader_ && slot_ >= 0 && shader_->shader()) {
+        ButtonInstance params;
+        const float smoothHover = std::clamp((std::clamp(hover_, 0.f, 1.f) - 0.06f) / 0.94f, 0.f, 1.f);
+        params.box    = sf::Glsl::Vec4{r.size.x, r.size.y, radius_, smoothHover};
+        params.fillA  = toVec4(lerpColor(theme_.fillA,  theme_.hoverFillA,  hover_));
+        params.fillB  = toVec4(lerpColor(theme_.fillB,  theme_.hoverFillB,  hover_));
+        params.border = toVec4(lerpColor(theme_.border, theme_.hoverBorder, hover_));
+        shader_->setInstance(slot_, params);
+        // L'indice du slot voyage dans la couleur des sommets
+        shaderQuad(rec, r, sf::Color(static_cast<std::uint8_t>(slot_), 0, 0), layer_, shader_->shader());
+    } else {
+        rec.rect(r.position, r.size, hover_ > 0.5f ? theme_.hoverFillA : theme_.fillA, layer_);
+    }
+
+    // Icône à gauche, centrée verticalement ; même couche que le libellé
+    if (icon_) {
+        const float h = static_cast<float>(icon_->getTextureRect().size.y) * icon_->getScale().y;
+        icon_->setPosition({r.position.x + 16.f, r.position.y + (r.size.y - h) * 0.5f});
+        rec.sprite(*icon_, labelLayer_);
+    }
+}
+
+// ---- Slider
+void UiSlider::setValue(float v01) {
+    v01 = std::clamp(v01, 0.f, 1.f);
+    if (v01 == value01_) return;
+    value01_ = v01;
+    markDirty();
+}
+
+float UiSlider::valueAt(float x) const {
+    return std::clamp((x - position().x) / size().x, 0.f, 1.f);
+}
+
+void UiSlider::build(SpriteBatch& rec) {
+    const sf::Vector2f p = position(), s = size();
+    rec.rect(p, s, sf::Color(60,66,82), layer_);
+    rec.rect(p, {s.x * value01_, s.y}, sf::Color(90,160,255), layer_);
+    rec.circle({p.x + s.x * value01_, p.y + s.y * 0.5f}, 8.f, sf::Color(240,245,255), layer_);
+}
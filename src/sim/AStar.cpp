@@ -0,0 +1,87 @@
+#include "sim/AStar.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <queue>
+
+namespace {
+
+constexpr std::uint32_t kOrth = 10;
+constexpr std::uint32_t kDiag = 14;
+constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+
+std::uint32_t octile(Cell a, Cell b) {
+    const auto dx = static_cast<std::uint32_t>(std::abs(a.x - b.x));
+    const auto dy = static_cast<std::uint32_t>(std::abs(a.y - b.y));
+    return kOrth * (dx + dy) + (kDiag - 2 * kOrth) * std::min(dx, dy);
+}
+
+struct Node {
+    std::uint32_t f, g, idx;
+    // Tas min sur f, puis g le plus grand (plus proche du but), puis index : ordre déterministe
+    bool operator>(const Node& o) const {
+        if (f != o.f) return f > o.f;
+        if (g != o.g) return g < o.g;
+        return idx > o.idx;
+    }
+};
+
+} // namespace
+
+bool findPathAStar(const GridMap& map, Cell from, Cell to, std::vector<Cell>& out) {
+    out.clear();
+    if (!map.passable(from) || !map.passable(to)) return false;
+
+    const std::size_t n = map.cellCount();
+    std::vector<std::uint32_t> g(n, kNone);
+    std::vector<std::uint32_t> parent(n, kNone);
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+
+    const std::uint32_t start = map.index(from);
+    const std::uint32_t goal  = map.index(to);
+    g[start] = 0;
+    open.push(Node{octile(from, to), 0, start});
+
+    static constexpr int dx[8] = { 1,  1,  0, -1, -1, -1,  0,  1 };
+    static constexpr int dy[8] = { 0,  1,  1,  1,  0, -1, -1, -1 };
+
+    while (!open.empty()) {
+        const Node cur = open.top();
+        open.pop();
+        if (cur.g != g[cur.idx]) continue; // entrée obsolète
+        if (cur.idx == goal) break;
+
+        const Cell c = map.cellAt(cur.idx);
+        for (int d = 0; d < 8; ++d) {
+            const int nx = c.x + dx[d];
+            const int ny = c.y + dy[d];
+            if (!map.passable(nx, ny)) continue;
+            const bool diag = (d & 1) != 0;
+            if (diag && (!map.passable(nx, c.y) || !map.passable(c.x, ny))) continue;
+
+            const std::uint32_t j  = map.index(nx, ny);
+            const std::uint32_t ng = cur.g + (diag ? kDiag : kOrth);
+            if (ng >= g[j]) continue;
+            g[j]      = ng;
+            parent[j] = cur.idx;
+            open.push(Node{ng + octile(Cell{nx, ny}, to), ng, j});
+        }
+    }
+
+    if (g[goal] == kNone) return false;
+    for (std::uint32_t i = goal; i != kNone; i = parent[i]) out.push_back(map.cellAt(i));
+    std::reverse(out.begin(), out.end());
+    return true;
+}
+
+Path cellsToPath(const std::vector<Cell>& cells) {
+    Path p;
+    p.x.reserve(cells.size());
+    p.y.reserve(cells.size());
+    for (const Cell& c : cells) {
+        p.x.push_back(static_cast<float>(c.x) + 0.5f);
+        p.y.push_back(static_cast<float>(c.y) + 0.5f);
+    }
+    return p;
+}
@@ -0,0 +1,136 @@
+#include "sim/Atlas.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+const AtlasEntry* AtlasIndex::find(std::string_view name) const {
+    auto it = std::lower_bound(entries.begin(), entries.end(), name,
+                               [](const AtlasEntry& e, std::string_view n) { return e.name < n; });
+    return (it != entries.end() && it->name == name) ? &*it : nullptr;
+}
+
+bool packAtlas(const std::vector<AtlasPackInput>& inputs, int maxSize, int padding,
+               const std::string& stem, AtlasIndex& out, std::string* error) {
+    out = AtlasIndex{};
+
+    // Plus hautes d'abord : les étagères se remplissent sans gros trous
+    std::vector<std::size_t> order(inputs.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        const auto& A = inputs[a];
+        const auto& B = inputs[b];
+        if (A.h != B.h) return A.h > B.h;
+        if (A.w != B.w) return A.w > B.w;
+        return A.name < B.name;
+    });
+
+    int x = 0, shelfY = 0, shelfH = 0;
+    auto newPage = [&] {
+        out.pages.push_back(AtlasPage{stem + "_" + std::to_string(out.pages.size()) + ".png", 0, 0});
+        x = shelfY = shelfH = 0;
+    };
+
+    for (std::size_t k : order) {
+        const AtlasPackInput& in = inputs[k];
+        const int w = in.w + 2 * padding;
+        const int h = in.h + 2 * padding;
+        if (in.w <= 0 || in.h <= 0 || w > maxSize || h > maxSize) {
+            if (error) *error = in.name + ": " + std::to_string(in.w) + "x" + std::to_string(in.h)
+                              + " does not fit a " + std::to_string(maxSize) + " page";
+            return false;
+        }
+        if (out.pages.empty()) newPage();
+        if (x + w > maxSize) {        // étagère pleine
+            shelfY += shelfH;
+            x = shelfH = 0;
+        }
+        if (shelfY + h > maxSize) newPage();
+
+        AtlasPage& page = out.pages.back();
+        out.entries.push_back(AtlasEntry{in.name, static_cast<int>(out.pages.size() - 1),
+                                         x + padding, shelfY + padding, in.w, in.h});
+        x += w;
+        shelfH = std::max(shelfH, h);
+        page.width  = std::max(page.width, x);
+        page.height = std::max(page.height, shelfY + shelfH);
+    }
+
+    std::sort(out.entries.begin(), out.entries.end(),
+              [](const AtlasEntry& a, const AtlasEntry& b) { return a.name < b.name; });
+    for (std::size_t i = 1; i < out.entries.size(); ++i) {
+        if (out.entries[i].name == out.entries[i - 1].name) {
+            if (error) *error = "duplicate name " + out.entries[i].name;
+            return false;
+        }
+    }
+    return true;
+}
+
+JsonValue atlasToJson(const AtlasIndex& index) {
+    JsonValue pages = JsonValue::makeArray();
+    for (const auto& p : index.pages) {
+        JsonValue v = JsonValue::makeObject();
+        v.set("file",   JsonValue::makeString(p.file));
+        v.set("width",  JsonValue::makeNumber(p.width));
+        v.set("height", JsonValue::makeNumber(p.height));
+        pages.push(std::move(v));
+    }
+    JsonValue sprites = JsonValue::makeObject();
+    for (const auto& e : index.entries) {
+        JsonValue v = JsonValue::makeObject();
+        v.set("page", JsonValue::makeNumber(e.page));
+        v.set("x",    JsonValue::makeNumber(e.x));
+        v.set("y",    JsonValue::makeNumber(e.y));
+        v.set("w",    JsonValue::makeNumber(e.w));
+        v.set("h",    JsonValue::makeNumber(e.h));
+        sprites.set(e.name, std::move(v));
+    }
+    JsonValue root = JsonValue::makeObject();
+    root.set("pages",   std::move(pages));
+    root.set("sprites", std::move(sprites));
+    return root;
+}
+
+bool parseAtlas(const JsonValue& root, AtlasIndex& out) {
+    const JsonValue* pages   = root.find("pages");
+    const JsonValue* sprites = root.find("sprites");
+    if (!pages || !pages->isArray() || !sprites || !sprites->isObject()) return false;
+
+    out = AtlasIndex{};
+    for (const auto& p : pages->items()) {
+        const JsonValue* file = p.find("file");
+        if (!file || !file->isString()) return false;
+        out.pages.push_back(AtlasPage{file->asString(),
+                                      static_cast<int>(p.number("width", 0)),
+                                      static_cast<int>(p.number("height", 0))});
+    }
+    for (const auto& [name, v] : sprites->members()) {
+        AtlasEntry e;
+        e.name = name;
+        e.page = static_cast<int>(v.number("page", -1));
+        e.x    = static_cast<int>(v.number("x", 0));
+        e.y    = static_cast<int>(v.number("y", 0));
+        e.w    = static_cast<int>(v.number("w", 0));
+        e.h    = static_cast<int>(v.number("h", 0));
+        if (e.page < 0 || e.page >= static_cast<int>(out.pages.size())) return false;
+        out.entries.push_back(std::move(e));
+    }
+    std::sort(out.entries.begin(), out.entries.end(),
+              [](const AtlasEntry& a, const AtlasEntry& b) { return a.name < b.name; });
+    return true;
+}
+
+bool loadAtlasIndex(const std::string& path, AtlasIndex& out) {
+    JsonValue root;
+    std::string err;
+    if (!loadJsonFile(path, root, &err)) {
+        std::cerr << "[Atlas] " << path << ": " << err << "\n";
+        return false;
+    }
+    if (!parseAtlas(root, out)) {
+        std::cerr << "[Atlas] " << path << ": invalid index\n";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,62 @@
+#include "sim/Config.hpp"
+
+#include <iostream>
+
+bool parseDifficulties(const JsonValue& root, std::vector<DifficultyParams>& out) {
+    if (!root.isObject()) return false;
+    out.clear();
+    for (const auto& [name, v] : root.members()) {
+        if (!v.isObject()) continue;
+        DifficultyParams d;
+        d.name             = name;
+        d.hpMultiplier     = static_cast<float>(v.number("hpMultiplier", d.hpMultiplier));
+        d.speedMultiplier  = static_cast<float>(v.number("speedMultiplier", d.speedMultiplier));
+        d.rewardMultiplier = static_cast<float>(v.number("rewardMultiplier", d.rewardMultiplier));
+        d.livesStart       = static_cast<int>(v.number("livesStart", d.livesStart));
+        out.push_back(std::move(d));
+    }
+    return !out.empty();
+}
+
+bool loadDifficulties(const std::string& path, std::vector<DifficultyParams>& out) {
+    JsonValue root;
+    std::string err;
+    if (!loadJsonFile(path, root, &err)) {
+        std::cerr << "[Config] " << path << ": " << err << "\n";
+        return false;
+    }
+    if (!parseDifficulties(root, out)) {
+        std::cerr << "[Config] " << path << ": no difficulty found\n";
+        return false;
+    }
+    return true;
+}
+
+const DifficultyParams* findDifficulty(const std::vector<DifficultyParams>& all, std::string_view name) {
+    for (const auto& d : all) {
+        if (d.name == name) return &d;
+    }
+    return nullptr;
+}
+
+bool parseGameRules(const JsonValue& root, GameRules& out) {
+    if (!root.isObject()) return false;
+    out.forbidTotalBlock = root.boolean("forbidTotalBlock", out.forbidTotalBlock);
+    if (const JsonValue* m = root.find("startMaterials")) {
+        const char* keys[] = {"A", "B", "C"};
+        for (int i = 0; i < 3; ++i) {
+            out.startMaterials[i] = static_cast<std::uint32_t>(m->number(keys[i], out.startMaterials[i]));
+        }
+    }
+    return true;
+}
+
+bool loadGameRules(const std::string& path, GameRules& out) {
+    JsonValue root;
+    std::string err;
+    if (!loadJsonFile(path, root, &err)) {
+        std::cerr << "[Config] " << path << ": " << err << "\n";
+        return false;
+    }
+    return parseGameRules(root, out);
+}
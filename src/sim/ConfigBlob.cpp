@@ -0,0 +1,394 @@
+#include "sim/ConfigBlob.hpp"
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include "sim/Codec.hpp"
+#include "sim/Json.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TD_HAS_MMAP 1
+#else
+#define TD_HAS_MMAP 0
+#endif
+
+namespace {
+
+constexpr char        kMagic[4]       = {'T', 'D', 'C', 'B'};
+constexpr std::size_t kRulesOffset    = sizeof(ConfigBlobHeader);
+constexpr std::size_t kDifficultyBase = kRulesOffset + sizeof(RulesRecord);
+
+// Les enregistrements sont lus tels quels depuis le mapping
+constexpr bool kLittleEndian = std::endian::native == std::endian::little;
+
+// ============================
+//  Schéma
+// ============================
+void checkKeys(const JsonValue& obj, std::initializer_list<const char*> known, const std::string& where,
+               std::vector<std::string>& errors) {
+    for (const auto& [key, v] : obj.members()) {
+        bool ok = false;
+        for (const char* k : known) ok = ok || key == k;
+        if (!ok) errors.push_back(where + key + ": unknown key");
+    }
+}
+
+// Nombre obligatoire dans [lo, hi] (entier si integer)
+double checkNumber(const JsonValue& obj, const char* key, double lo, double hi, bool integer,
+                   const std::string& where, std::vector<std::string>& errors) {
+    const JsonValue* v = obj.find(key);
+    if (!v) {
+        errors.push_back(where + key + ": missing");
+        return lo;
+    }
+    const double d = v->asNumber(lo - 1.0);
+    if (!v->isNumber() || !(d >= lo && d <= hi) || (integer && d != static_cast<double>(static_cast<std::int64_t>(d)))) {
+        errors.push_back(where + key + ": expected " + (integer ? "an integer" : "a number") + " in [" +
+                         writeJson(JsonValue::makeNumber(lo)) + ", " + writeJson(JsonValue::makeNumber(hi)) + "]");
+        return lo;
+    }
+    return d;
+}
+
+template <class T>
+void put(std::vector<std::uint8_t>& out, std::size_t offset, const T& v) {
+    std::memcpy(out.data() + offset, &v, sizeof(T));
+}
+
+} // namespace
+
+bool validateDifficulties(const JsonValue& root, std::vector<std::string>& errors) {
+    const std::size_t before = errors.size();
+    if (!root.isObject() || root.members().empty()) {
+        errors.push_back("difficulties: expected a non-empty object");
+        return false;
+    }
+    for (const auto& [name, v] : root.members()) {
+        const std::string where = name + ".";
+        if (name.empty() || name.size() > DifficultyRecord::kMaxName) {
+            errors.push_back("\"" + name + "\": name must be 1 to " + std::to_string(DifficultyRecord::kMaxName) + " bytes");
+        }
+        if (!v.isObject()) {
+            errors.push_back(name + ": expected an object");
+            continue;
+        }
+        checkKeys(v, {"hpMultiplier", "speedMultiplier", "rewardMultiplier", "livesStart"}, where, errors);
+        checkNumber(v, "hpMultiplier", 0.01, 100.0, false, where, errors);
+        checkNumber(v, "speedMultiplier", 0.01, 10.0, false, where, errors);
+        checkNumber(v, "rewardMultiplier", 0.0, 100.0, false, where, errors);
+        checkNumber(v, "livesStart", 1.0, 10000.0, true, where, errors);
+    }
+    return errors.size() == before;
+}
+
+bool validateGameRules(const JsonValue& root, std::vector<std::string>& errors) {
+    const std::size_t before = errors.size();
+    if (!root.isObject()) {
+        errors.push_back("rules: expected an object");
+        return false;
+    }
+    checkKeys(root, {"forbidTotalBlock", "startMaterials"}, "", errors);
+    if (const JsonValue* b = root.find("forbidTotalBlock"); b && !b->isBool()) {
+        errors.push_back("forbidTotalBlock: expected true or false");
+    }
+    const JsonValue* m = root.find("startMaterials");
+    if (!m || !m->isObject()) {
+        errors.push_back("startMaterials: expected an object with A, B and C");
+    } else {
+        checkKeys(*m, {"A", "B", "C"}, "startMaterials.", errors);
+        for (const char* k : {"A", "B", "C"}) checkNumber(*m, k, 0.0, 1e6, true, "startMaterials.", errors);
+    }
+    return errors.size() == before;
+}
+
+// ============================
+//  Compilation
+// ============================
+bool compileConfig(const JsonValue& difficulties, const JsonValue& rules, std::vector<std::uint8_t>& out,
+                   std::vector<std::string>& errors) {
+    if (!kLittleEndian) {
+        errors.push_back("compiled config needs a little-endian host");
+        return false;
+    }
+    const bool okD = validateDifficulties(difficulties, errors);
+    const bool okR = validateGameRules(rules, errors);
+    if (!okD || !okR) return false;
+
+    // Mêmes conversions que les chargeurs JSON
+    std::vector<DifficultyParams> params;
+    GameRules                     r;
+    parseDifficulties(difficulties, params);
+    parseGameRules(rules, r);
+
+    const std::size_t n = params.size();
+    out.assign(kDifficultyBase + n * sizeof(DifficultyRecord), 0);
+
+    RulesRecord rr{};
+    for (int i = 0; i < 3; ++i) rr.startMaterials[i] = r.startMaterials[i];
+    rr.forbidTotalBlock = r.forbidTotalBlock ? 1 : 0;
+    put(out, kRulesOffset, rr);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        DifficultyRecord d{};
+        std::memcpy(d.name, params[i].name.data(), params[i].name.size());
+        d.hpMultiplier     = params[i].hpMultiplier;
+        d.speedMultiplier  = params[i].speedMultiplier;
+        d.rewardMultiplier = params[i].rewardMultiplier;
+        d.livesStart       = params[i].livesStart;
+        put(out, kDifficultyBase + i * sizeof(DifficultyRecord), d);
+    }
+
+    ConfigBlobHeader h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version         = ConfigBlob::kVersion;
+    h.size            = static_cast<std::uint32_t>(out.size());
+    h.checksum        = fnv1a(out.data() + kRulesOffset, out.size() - kRulesOffset);
+    h.difficultyCount = static_cast<std::uint32_t>(n);
+    put(out, 0, h);
+    return true;
+}
+
+bool compileConfigFiles(const std::string& difficultyPath, const std::string& rulesPath, const std::string& outPath) {
+    JsonValue   difficulties, rules;
+    std::string err;
+    if (!loadJsonFile(difficultyPath, difficulties, &err)) {
+        std::cerr << "[Config] " << difficultyPath << ": " << err << "\n";
+        return false;
+    }
+    if (!loadJsonFile(rulesPath, rules, &err)) {
+        std::cerr << "[Config] " << rulesPath << ": " << err << "\n";
+        return false;
+    }
+    std::vector<std::uint8_t> data;
+    std::vector<std::string>  errors;
+    if (!compileConfig(difficulties, rules, data, errors)) {
+        for (const std::string& e : errors) std::cerr << "[Config] " << e << "\n";
+        return false;
+    }
+
+    const std::string tmp = outPath + ".tmp";
+    {
+        std::ofstream os(tmp, std::ios::binary | std::ios::trunc);
+        os.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!os) {
+            std::cerr << "[Config] Failed to write " << tmp << "\n";
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp, outPath, ec);
+    if (ec) std::cerr << "[Config] Failed to replace " << outPath << ": " << ec.message() << "\n";
+    return !ec;
+}
+
+// ============================
+//  Lecture
+// ============================
+ConfigBlob::~ConfigBlob() { close(); }
+
+void ConfigBlob::close() {
+#if TD_HAS_MMAP
+    if (mapping_) munmap(mapping_, size_);
+#endif
+    mapping_ = nullptr;
+    data_    = nullptr;
+    size_    = 0;
+    copy_.clear();
+}
+
+bool ConfigBlob::open(const std::string& path) {
+    close();
+#if TD_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kDifficultyBase)) {
+        ::close(fd);
+        std::cerr << "[Config] " << path << ": not a compiled config\n";
+        return false;
+    }
+    void* p = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // le mapping reste valide
+    if (p == MAP_FAILED) return false;
+    mapping_ = p;
+    data_    = static_cast<const std::uint8_t*>(p);
+    size_    = static_cast<std::size_t>(st.st_size);
+#else
+    std::ifstream is(path, std::ios::binary);
+    if (!is) return false;
+    copy_.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    data_ = copy_.data();
+    size_ = copy_.size();
+#endif
+    return check(path);
+}
+
+bool ConfigBlob::openBytes(const std::uint8_t* data, std::size_t size) {
+    close();
+    copy_.assign(data, data + size);
+    data_ = copy_.data();
+    size_ = copy_.size();
+    return check("<memory>");
+}
+
+bool ConfigBlob::check(const std::string& what) {
+    const char* problem = nullptr;
+    if (!kLittleEndian) {
+        problem = "compiled config needs a little-endian host";
+    } else if (size_ < kDifficultyBase || std::memcmp(data_, kMagic, sizeof(kMagic)) != 0) {
+        problem = "not a compiled config";
+    } else if (header().version != kVersion) {
+        problem = "unknown version (recompile with td_config)";
+    } else if (header().size != size_ ||
+               size_ != kDifficultyBase + std::size_t{header().difficultyCount} * sizeof(DifficultyRecord)) {
+        problem = "truncated";
+    } else if (header().checksum != fnv1a(data_ + kRulesOffset, size_ - kRulesOffset)) {
+        problem = "checksum mismatch";
+    }
+    if (!problem) {
+        // Noms terminés par '\0' : findDifficulty/strcmp ne sort pas de l'enregistrement
+        for (std::size_t i = 0; i < difficultyCount(); ++i) {
+            if (difficultyRecord(i).name[DifficultyRecord::kMaxName] != '\0') problem = "bad difficulty name";
+        }
+    }
+    if (problem) {
+        std::cerr << "[Config] " << what << ": " << problem << "\n";
+        close();
+        return false;
+    }
+    return true;
+}
+
+const RulesRecord& ConfigBlob::rulesRecord() const {
+    return *reinterpret_cast<const RulesRecord*>(data_ + kRulesOffset);
+}
+
+const DifficultyRecord& ConfigBlob::difficultyRecord(std::size_t i) const {
+    return reinterpret_cast<const DifficultyRecord*>(data_ + kDifficultyBase)[i];
+}
+
+int ConfigBlob::findDifficulty(const char* name) const {
+    for (std::size_t i = 0; i < difficultyCount(); ++i) {
+        if (std::strcmp(difficultyRecord(i).name, name) == 0) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+GameRules ConfigBlob::rules() const {
+    const RulesRecord& r = rulesRecord();
+    GameRules out;
+    out.forbidTotalBlock = r.forbidTotalBlock != 0;
+    for (int i = 0; i < 3; ++i) out.startMaterials[i] = r.startMaterials[i];
+    return out;
+}
+
+DifficultyParams ConfigBlob::difficulty(std::size_t i) const {
+    const DifficultyRecord& r = difficultyRecord(i);
+    DifficultyParams d;
+    d.name             = r.name;
+    d.hpMultiplier     = r.hpMultiplier;
+    d.speedMultiplier  = r.speedMultiplier;
+    d.rewardMultiplier = r.rewardMultiplier;
+    d.livesStart       = r.livesStart;
+    return d;
+}
+
+std::vector<DifficultyParams> ConfigBlob::difficulties() const {
+    std::vector<DifficultyParams> out;
+    out.reserve(difficultyCount());
+    for (std::size_t i = 0; i < difficultyCount(); ++i) out.push_back(difficulty(i));
+    return out;
+}
+
+bool loadConfigBlob(const std::string& path, std::vector<DifficultyParams>& difficulties, GameRules& rules) {
+    ConfigBlob blob;
+    if (!blob.open(path)) return false;
+    difficulties = blob.difficulties();
+    rules        = blob.rules();
+    return true;
+}
+
+// ============================
+//  Surveillance
+// ============================
+namespace {
+
+bool stamp(const std::string& path, std::int64_t& time, std::uintmax_t& size) {
+    std::error_code ec;
+    const auto t = std::filesystem::last_write_time(path, ec);
+    if (ec) return false;
+    size = std::filesystem::file_size(path, ec);
+    if (ec) return false;
+    time = static_cast<std::int64_t>(t.time_since_epoch().count());
+    return true;
+}
+
+} // namespace
+
+ConfigWatcher::ConfigWatcher(std::string path, std::chrono::milliseconds interval, bool startThread)
+: path_(std::move(path)), interval_(interval) {
+    // Le bloc présent au démarrage est celui que le jeu vient de charger
+    if (stamp(path_, lastTime_, lastSize_)) {
+        ConfigBlob current;
+        if (current.open(path_)) lastChecksum_ = current.checksum();
+    }
+    if (startThread) thread_ = std::thread([this] { run(); });
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    if (thread_.joinable()) thread_.join();
+}
+
+bool ConfigWatcher::poll() {
+    std::int64_t   time = 0;
+    std::uintmax_t size = 0;
+    if (!stamp(path_, time, size) || (time == lastTime_ && size == lastSize_)) return false;
+    lastTime_ = time;
+    lastSize_ = size;
+
+    auto blob = std::make_shared<ConfigBlob>();
+    if (!blob->open(path_)) {
+        // Bloc invalide : le jeu garde la config en cours
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (blob->checksum() == lastChecksum_) return false; // touché, pas modifié
+    lastChecksum_ = blob->checksum();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ = std::move(blob);
+    }
+    reloads_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+std::shared_ptr<const ConfigBlob> ConfigWatcher::take() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::exchange(pending_, nullptr);
+}
+
+void ConfigWatcher::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        wake_.wait_for(lock, interval_);
+        if (stop_) break;
+        lock.unlock();
+        poll();
+        lock.lock();
+    }
+}
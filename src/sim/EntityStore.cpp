@@ -0,0 +1,100 @@
+#include "sim/EntityStore.hpp"
+
+// ============================
+//  Enemies
+// ============================
+Handle EnemyStore::spawn(const EnemySpawn& s) {
+    const Handle h = ids.create();
+    posX.push_back(s.x);
+    posY.push_back(s.y);
+    velX.push_back(0.f);
+    velY.push_back(0.f);
+    hp.push_back(s.hp);
+    progress.push_back(0.f);
+    pathIdx.push_back(0);
+    speed.push_back(s.speed);
+    reward.push_back(s.reward);
+    goal.push_back(s.goal);
+    return h;
+}
+
+bool EnemyStore::destroy(Handle h) {
+    std::uint32_t dst;
+    if (!ids.destroy(h, dst)) return false;
+    swapPop(dst, posX, posY, velX, velY, hp, progress, pathIdx, speed, reward, goal);
+    return true;
+}
+
+void EnemyStore::reserve(std::size_t n) {
+    ids.reserve(n);
+    for (auto* v : {&posX, &posY, &velX, &velY, &hp, &progress, &speed}) v->reserve(n);
+    pathIdx.reserve(n);
+    reward.reserve(n);
+    goal.reserve(n);
+}
+
+void EnemyStore::clear() {
+    ids.clear();
+    for (auto* v : {&posX, &posY, &velX, &velY, &hp, &progress, &speed}) v->clear();
+    pathIdx.clear();
+    reward.clear();
+    goal.clear();
+}
+
+// ============================
+//  Towers
+// ============================
+Handle TowerStore::build(const TowerSpec& s) {
+    const Handle h = ids.create();
+    posX.push_back(s.x);
+    posY.push_back(s.y);
+    range.push_back(s.range);
+    damage.push_back(s.damage);
+    cooldown.push_back(0.f);
+    fireRate.push_back(s.fireRate);
+    mode.push_back(s.mode);
+    target.push_back(Handle{});
+    return h;
+}
+
+bool TowerStore::destroy(Handle h) {
+    std::uint32_t dst;
+    if (!ids.destroy(h, dst)) return false;
+    swapPop(dst, posX, posY, range, damage, cooldown, fireRate, mode, target);
+    return true;
+}
+
+void TowerStore::clear() {
+    ids.clear();
+    for (auto* v : {&posX, &posY, &range, &damage, &cooldown, &fireRate}) v->clear();
+    mode.clear();
+    target.clear();
+}
+
+// ============================
+//  Projectiles
+// ============================
+Handle ProjectileStore::fire(const ProjectileSpawn& s) {
+    const Handle h = ids.create();
+    posX.push_back(s.x);
+    posY.push_back(s.y);
+    velX.push_back(s.vx);
+    velY.push_back(s.vy);
+    damage.push_back(s.damage);
+    ttl.push_back(s.ttl);
+    target.push_back(s.target);
+    return h;
+}
+
+bool ProjectileStore::destroy(Handle h) {
+    std::uint32_t dst;
+    if (!ids.destroy(h, dst)) return false;
+    swapPop(dst, posX, posY, velX, velY, damage, ttl, target);
+    return true;
+}
+
+void ProjectileStore::clear() {
+    ids.clear();
+    for (auto* v : {&posX, &posY, &velX, &velY, &damage, &ttl}) v->clear();
+    target.clear();
+}
@@ -0,0 +1,391 @@
+#include "sim/FlowField.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sim/JobSystem.hpp"
+
+void FlowField::build(const GridMap& map, std::span<const Cell> goals) {
+    width_  = map.width;
+    height_ = map.height;
+    stride_ = width_ + 2;
+    for (int d = 0; d < 8; ++d) offset_[d] = kDirY[d] * stride_ + kDirX[d];
+
+    const std::size_t n = static_cast<std::size_t>(stride_) * (height_ + 2);
+    wall_.assign(n, 1);
+    for (int y = 0; y < height_; ++y) {
+        const std::uint8_t* src = map.blocked.data() + static_cast<std::size_t>(y) * width_;
+        std::uint8_t*       dst = wall_.data() + cellIndex(0, y);
+        for (int x = 0; x < width_; ++x) dst[x] = src[x];
+    }
+    dist_.assign(n, kUnreachable);
+    dir_.assign(n, kNoDir);
+    mark_.assign(n, 0);
+    epoch_ = 0;
+    queue_.resize(static_cast<std::size_t>(width_) * height_);
+
+    goals_.clear();
+    std::size_t head = 0, tail = 0;
+    for (const Cell& g : goals) {
+        if (!map.inBounds(g.x, g.y)) continue;
+        const std::uint32_t idx = cellIndex(g.x, g.y);
+        goals_.push_back(idx);
+        if (wall_[idx] || dist_[idx] == 0) continue;
+        dist_[idx] = 0;
+        queue_[tail++] = idx;
+    }
+
+    // BFS : coût unitaire, la file est parcourue par distance croissante
+    const std::uint8_t* wall = wall_.data();
+    std::uint32_t*      dist = dist_.data();
+    std::uint32_t*      q    = queue_.data();
+    const auto          s    = static_cast<std::uint32_t>(stride_);
+    while (head < tail) {
+        const std::uint32_t idx = q[head++];
+        const std::uint32_t d   = dist[idx] + 1;
+        auto visit = [&](std::uint32_t j) {
+            if (wall[j] | (dist[j] != kUnreachable)) return;
+            dist[j] = d;
+            q[tail++] = j;
+        };
+        visit(idx + 1);
+        visit(idx - 1);
+        visit(idx + s);
+        visit(idx - s);
+    }
+
+    for (int y = 0; y < height_; ++y)
+        for (int x = 0; x < width_; ++x)
+            computeDirection(cellIndex(x, y));
+}
+
+void FlowField::computeDirection(std::uint32_t idx) {
+    dir_[idx] = kNoDir;
+    std::uint32_t best = dist_[idx];
+    if (best == 0 || best == kUnreachable) return;
+
+    // Orthogonaux d'abord (indices pairs) : à égalité, ils l'emportent
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::uint8_t d = static_cast<std::uint8_t>(pass); d < 8; d += 2) {
+            const std::uint32_t j = idx + offset_[d];
+            if (wall_[j]) continue;
+            // Diagonale : pas de coin coupé contre un obstacle
+            if ((d & 1) && (wall_[idx + kDirX[d]] || wall_[idx + kDirY[d] * stride_])) continue;
+            if (dist_[j] < best) {
+                best = dist_[j];
+                dir_[idx] = d;
+            }
+        }
+    }
+}
+
+std::uint8_t FlowField::sample(float px, float py) const {
+    const int x = static_cast<int>(std::floor(px));
+    const int y = static_cast<int>(std::floor(py));
+    if (!inBounds(x, y)) return kNoDir;
+    return dir_[cellIndex(x, y)];
+}
+
+// ============================
+//  Réparation incrémentale
+// ============================
+void FlowField::setDist(std::uint32_t idx, std::uint32_t d) {
+    dist_[idx] = d;
+    touchAround(idx);
+}
+
+void FlowField::touchAround(std::uint32_t idx) {
+    // La direction d'une cellule dépend des distances de ses 8 voisins
+    // (et des murs, pour la règle des coins) : on marque le 3x3.
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            const std::uint32_t j = idx + static_cast<std::uint32_t>(dy * stride_ + dx);
+            if (mark_[j] == epoch_) continue;
+            mark_[j] = epoch_;
+            touched_.push_back(j);
+        }
+    }
+}
+
+void FlowField::setBlocked(int x, int y, bool blocked) {
+    if (!inBounds(x, y)) return;
+    const std::uint32_t c = cellIndex(x, y);
+    const std::uint8_t  v = blocked ? 1 : 0;
+    if (wall_[c] == v) return;
+
+    ++epoch_;
+    touched_.clear();
+    wall_[c] = v;
+    touchAround(c);
+
+    if (blocked) repairAfterBlock(c);
+    else         repairAfterUnblock(c);
+
+    for (std::uint32_t j : touched_) computeDirection(j);
+}
+
+void FlowField::repairAfterBlock(std::uint32_t c) {
+    const std::uint32_t dc = dist_[c];
+    if (dc == kUnreachable) return;
+    setDist(c, kUnreachable);
+
+    // 1) Invalidation : une cellule à distance D+1 ne dépend de la cellule
+    //    invalidée (distance D) que si aucun autre voisin valide n'est à D.
+    //    Parcours par couches de distance croissante (FIFO).
+    invalid_.assign(1, c);
+    invalidDist_.assign(1, dc);
+    const auto s = static_cast<std::uint32_t>(stride_);
+    for (std::size_t head = 0; head < invalid_.size(); ++head) {
+        const std::uint32_t i  = invalid_[head];
+        const std::uint32_t di = invalidDist_[head];
+        for (std::uint32_t j : {i + 1, i - 1, i + s, i - s}) {
+            if (wall_[j] || dist_[j] != di + 1) continue;
+            bool supported = false;
+            for (std::uint32_t k : {j + 1, j - 1, j + s, j - s}) {
+                if (!wall_[k] && dist_[k] == di) { supported = true; break; }
+            }
+            if (supported) continue;
+            setDist(j, kUnreachable);
+            invalid_.push_back(j);
+            invalidDist_.push_back(di + 1);
+        }
+    }
+
+    // 2) Graines : chaque cellule invalidée repart du meilleur voisin resté valide
+    seeds_.clear();
+    for (std::size_t n = 1; n < invalid_.size(); ++n) {
+        const std::uint32_t i = invalid_[n];
+        std::uint32_t best = kUnreachable;
+        for (std::uint32_t k : {i + 1, i - 1, i + s, i - s}) {
+            if (!wall_[k] && dist_[k] != kUnreachable) best = std::min(best, dist_[k] + 1);
+        }
+        if (best != kUnreachable) seeds_.push_back(Seed{best, i});
+    }
+    std::sort(seeds_.begin(), seeds_.end(),
+              [](const Seed& a, const Seed& b){ return a.dist < b.dist; });
+
+    // 3) Propagation limitée à la zone invalidée
+    propagateDecrease(seeds_.size());
+}
+
+void FlowField::repairAfterUnblock(std::uint32_t c) {
+    std::uint32_t best = kUnreachable;
+    if (std::find(goals_.begin(), goals_.end(), c) != goals_.end()) {
+        best = 0;
+    } else {
+        const auto s = static_cast<std::uint32_t>(stride_);
+        for (std::uint32_t k : {c + 1, c - 1, c + s, c - s}) {
+            if (!wall_[k] && dist_[k] != kUnreachable) best = std::min(best, dist_[k] + 1);
+        }
+    }
+    if (best == kUnreachable) return; // zone isolée : reste injoignable
+
+    seeds_.assign(1, Seed{best, c});
+    propagateDecrease(1);
+}
+
+// Dijkstra à coût unitaire : fusion des graines triées et d'une file FIFO.
+// Une cellule n'est relâchée que si sa distance diminue.
+void FlowField::propagateDecrease(std::size_t seedCount) {
+    const auto     s    = static_cast<std::uint32_t>(stride_);
+    std::uint32_t* q    = queue_.data();
+    std::size_t    head = 0, tail = 0, si = 0;
+
+    while (si < seedCount || head < tail) {
+        std::uint32_t i;
+        if (head < tail && (si >= seedCount || dist_[q[head]] <= seeds_[si].dist)) {
+            i = q[head++];
+        } else {
+            const Seed sd = seeds_[si++];
+            if (sd.dist >= dist_[sd.idx]) continue;
+            setDist(sd.idx, sd.dist);
+            i = sd.idx;
+        }
+        const std::uint32_t d = dist_[i] + 1;
+        for (std::uint32_t j : {i + 1, i - 1, i + s, i - s}) {
+            if (wall_[j] || dist_[j] <= d) continue;
+            setDist(j, d);
+            q[tail++] = j;
+        }
+    }
+}
+
+// ============================
+//  FlowFieldSet
+// ============================
+void FlowFieldSet::build(const GridMap& map, JobSystem* jobs) {
+    fields.resize(map.exits.size());
+    const auto buildRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) fields[i].build(map, std::span<const Cell>(&map.exits[i], 1));
+    };
+    if (jobs) jobs->parallelFor(fields.size(), 1, buildRange);
+    else      buildRange(0, fields.size());
+}
+
+int FlowFieldSet::nearestExit(Cell c) const {
+    int best = -1;
+    std::uint32_t bestDist = FlowField::kUnreachable;
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        const std::uint32_t d = fields[i].distance(c);
+        if (d < bestDist) { bestDist = d; best = static_cast<int>(i); }
+    }
+    return best;
+}
+
+void FlowFieldSet::setBlocked(GridMap& map, Cell c, bool blocked, JobSystem* jobs) {
+    if (!map.inBounds(c.x, c.y)) return;
+    map.blocked[map.index(c)] = blocked ? 1 : 0;
+    const auto repairRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) fields[i].setBlocked(c.x, c.y, blocked);
+    };
+    if (jobs) jobs->parallelFor(fields.size(), 1, repairRange);
+    else      repairRange(0, fields.size());
+}
+
+bool FlowFieldSet::wouldFullyBlock(const GridMap& map, Cell c) {
+    if (!map.passable(c)) return false; // déjà bloquée : rien ne change
+
+    // Composante K de c : seules les sorties de K comptent. Si K n'a pas de
+    // sortie, aucun spawn de K n'en avait : rien à couper.
+    exitInComponent_.assign(fields.size(), 0);
+    bool anyExit = false;
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        exitInComponent_[i] = fields[i].distance(c) != FlowField::kUnreachable;
+        anyExit = anyExit || exitInComponent_[i];
+    }
+    if (!anyExit) return false;
+
+    auto spawnInComponent = [&](Cell s) {
+        for (std::size_t i = 0; i < fields.size(); ++i)
+            if (exitInComponent_[i] && fields[i].distance(s) != FlowField::kUnreachable) return true;
+        return false;
+    };
+    for (const Cell& s : map.spawns)
+        if (s == c && spawnInComponent(s)) return true;
+
+    // 1) Test local : groupes de voisins orthogonaux reliés par l'anneau des
+    //    8 voisins (N relié à E si NE est libre, etc.). Un seul groupe :
+    //    c n'est pas un point d'articulation, rien ne peut être coupé.
+    static constexpr int ox[4] = { 0, 1, 0, -1 }; // N, E, S, W
+    static constexpr int oy[4] = { -1, 0, 1, 0 };
+    bool open[4];
+    for (int k = 0; k < 4; ++k) open[k] = map.passable(c.x + ox[k], c.y + oy[k]);
+
+    int group[4] = {-1, -1, -1, -1};
+    int groups = 0;
+    for (int k = 0; k < 4; ++k) {
+        if (!open[k] || group[k] >= 0) continue;
+        // Parcourt l'anneau dans le sens horaire tant que les diagonales sont libres
+        group[k] = groups;
+        for (int m = k; ; ) {
+            const int n = (m + 1) % 4;
+            const bool diag = map.passable(c.x + ox[m] + ox[n], c.y + oy[m] + oy[n]);
+            if (!open[n] || !diag || group[n] >= 0) break;
+            group[n] = groups;
+            m = n;
+        }
+        ++groups;
+    }
+    // Fusion en fin d'anneau (W relié à N par NW)
+    if (groups > 1 && open[3] && open[0] && group[3] != group[0]
+        && map.passable(c.x - 1, c.y - 1)) {
+        const int from = group[3], to = group[0];
+        for (int& g : group) if (g == from) g = to;
+        --groups;
+    }
+    if (groups <= 1) return false;
+
+    // 2) Inondation simultanée depuis chaque groupe (c compte comme bloquée).
+    //    Deux groupes qui se touchent fusionnent ; on s'arrête dès qu'il n'en
+    //    reste qu'un, ou que tous sauf un sont fermés (régions enclavées).
+    const std::size_t n = map.cellCount();
+    if (visitEpoch_.size() != n) { visitEpoch_.assign(n, 0); visitGroup_.assign(n, 0); visitCounter_ = 0; }
+    const std::uint32_t epoch = ++visitCounter_;
+    const std::uint32_t cIdx  = map.index(c);
+
+    int parent[4] = {0, 1, 2, 3};
+    auto find = [&](int g) { while (parent[g] != g) g = parent[g]; return g; };
+    std::size_t head[4] = {0, 0, 0, 0};
+    for (auto& q : floodQueue_) q.clear();
+
+    int seedGroup[4] = {-1, -1, -1, -1}; // groupe d'inondation -> id compact
+    int floods = 0;
+    for (int k = 0; k < 4; ++k) {
+        if (group[k] < 0) continue;
+        if (seedGroup[group[k]] < 0) seedGroup[group[k]] = floods++;
+        const int g = seedGroup[group[k]];
+        const std::uint32_t j = map.index(c.x + ox[k], c.y + oy[k]);
+        visitEpoch_[j] = epoch;
+        visitGroup_[j] = static_cast<std::uint8_t>(g);
+        floodQueue_[g].push_back(j);
+    }
+
+    int roots = floods;
+    auto rootOpen = [&](int r) {
+        for (int g = 0; g < floods; ++g)
+            if (find(g) == r && head[g] < floodQueue_[g].size()) return true;
+        return false;
+    };
+
+    const auto w = static_cast<std::uint32_t>(map.width);
+    const auto h = static_cast<std::uint32_t>(map.height);
+    for (;;) {
+        for (int g = 0; g < floods; ++g) {
+            if (head[g] >= floodQueue_[g].size()) continue;
+            const std::uint32_t i = floodQueue_[g][head[g]++];
+            const std::uint32_t x = i % w, y = i / w;
+            const std::uint32_t nb[4] = {
+                y > 0     ? i - w : i, x + 1 < w ? i + 1 : i,
+                y + 1 < h ? i + w : i, x > 0     ? i - 1 : i };
+            for (std::uint32_t j : nb) {
+                if (j == i || j == cIdx || map.blocked[j]) continue;
+                if (visitEpoch_[j] == epoch) {
+                    const int a = find(g), b = find(visitGroup_[j]);
+                    if (a != b) {
+                        parent[b] = a;
+                        if (--roots == 1) return false; // tout se rejoint : pas de coupure
+                    }
+                    continue;
+                }
+                visitEpoch_[j] = epoch;
+                visitGroup_[j] = static_cast<std::uint8_t>(g);
+                floodQueue_[g].push_back(j);
+            }
+        }
+
+        int openRoots = 0;
+        for (int g = 0; g < floods; ++g)
+            if (find(g) == g && rootOpen(g)) ++openRoots;
+        if (openRoots <= 1) break;
+    }
+
+    // 3) Verdict : une région (fermée, ou la seule encore ouverte) contenant
+    //    un spawn de K mais aucune sortie de K signifie un spawn coupé.
+    int openRoot = -1;
+    for (int g = 0; g < floods; ++g)
+        if (find(g) == g && rootOpen(g)) openRoot = g;
+
+    auto regionOf = [&](Cell cell) {
+        const std::uint32_t j = map.index(cell);
+        return visitEpoch_[j] == epoch ? find(visitGroup_[j]) : openRoot;
+    };
+    bool hasExit[4] = {false, false, false, false};
+    for (std::size_t i = 0; i < map.exits.size(); ++i) {
+        if (!exitInComponent_[i]) continue;
+        const int r = regionOf(map.exits[i]);
+        if (r >= 0) hasExit[r] = true;
+    }
+    for (const Cell& s : map.spawns) {
+        if (!spawnInComponent(s)) continue;
+        const int r = regionOf(s);
+        if (r < 0 || !hasExit[r]) return true;
+    }
+    return false;
+}
+
+bool FlowFieldSet::canPlace(const GridMap& map, Cell c, bool forbidTotalBlock) {
+    if (!map.passable(c)) return false;
+    for (const Cell& s : map.spawns) if (s == c) return false;
+    for (const Cell& e : map.exits)  if (e == c) return false;
+    return !forbidTotalBlock || !wouldFullyBlock(map, c);
+}
@@ -0,0 +1,438 @@
+#include "sim/FontSubset.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+
+namespace {
+// --- Lecture/écriture big-endian (format sfnt)
+std::uint16_t rd16(const std::uint8_t* p) { return static_cast<std::uint16_t>((p[0] << 8) | p[1]); }
+std::uint32_t rd32(const std::uint8_t* p) {
+    return (std::uint32_t{p[0]} << 24) | (std::uint32_t{p[1]} << 16) | (std::uint32_t{p[2]} << 8) | p[3];
+}
+void put16(std::vector<std::uint8_t>& v, std::uint32_t x) {
+    v.push_back(static_cast<std::uint8_t>(x >> 8));
+    v.push_back(static_cast<std::uint8_t>(x));
+}
+void put32(std::vector<std::uint8_t>& v, std::uint32_t x) {
+    put16(v, x >> 16);
+    put16(v, x & 0xFFFF);
+}
+void set16(std::vector<std::uint8_t>& v, std::size_t at, std::uint32_t x) {
+    v[at]     = static_cast<std::uint8_t>(x >> 8);
+    v[at + 1] = static_cast<std::uint8_t>(x);
+}
+void set32(std::vector<std::uint8_t>& v, std::size_t at, std::uint32_t x) {
+    set16(v, at, x >> 16);
+    set16(v, at + 2, x & 0xFFFF);
+}
+
+std::uint32_t checksum(const std::uint8_t* p, std::size_t n) {
+    std::uint32_t sum = 0;
+    for (std::size_t i = 0; i < n; i += 4) {
+        std::uint8_t w[4] = {0, 0, 0, 0};
+        std::memcpy(w, p + i, std::min<std::size_t>(4, n - i));
+        sum += rd32(w);
+    }
+    return sum;
+}
+
+// Vue sur une table ; vide si absente ou hors du fichier
+struct Table {
+    const std::uint8_t* data = nullptr;
+    std::size_t         size = 0;
+    explicit operator bool() const { return data != nullptr; }
+};
+
+struct Font {
+    const std::vector<std::uint8_t>& bytes;
+    std::map<std::string, Table> tables;
+
+    explicit Font(const std::vector<std::uint8_t>& b) : bytes(b) {}
+
+    bool parse() {
+        if (bytes.size() < 12) return false;
+        const std::uint32_t version = rd32(bytes.data());
+        if (version != 0x00010000 && version != 0x74727565) return false; // TrueType ('true')
+        const std::uint16_t count = rd16(bytes.data() + 4);
+        if (bytes.size() < 12 + std::size_t{count} * 16) return false;
+        for (std::uint16_t i = 0; i < count; ++i) {
+            const std::uint8_t* rec = bytes.data() + 12 + i * 16;
+            const std::uint32_t off = rd32(rec + 8), len = rd32(rec + 12);
+            if (std::size_t{off} + len > bytes.size()) return false;
+            tables[std::string(reinterpret_cast<const char*>(rec), 4)] = Table{bytes.data() + off, len};
+        }
+        return true;
+    }
+    Table get(const std::string& tag) const {
+        auto it = tables.find(tag);
+        return it == tables.end() ? Table{} : it->second;
+    }
+};
+
+// Sous-table cmap la plus complète : (3,10) format 12, sinon Unicode BMP format 4
+Table findCmapSubtable(const Font& f) {
+    const Table cmap = f.get("cmap");
+    if (!cmap || cmap.size < 4) return {};
+    const std::uint16_t n = rd16(cmap.data + 2);
+    Table best{};
+    int bestRank = 0;
+    for (std::uint16_t i = 0; i < n && 4 + (i + 1) * 8u <= cmap.size; ++i) {
+        const std::uint8_t* rec = cmap.data + 4 + i * 8;
+        const std::uint16_t platform = rd16(rec), encoding = rd16(rec + 2);
+        const std::uint32_t off = rd32(rec + 4);
+        if (off + 4 > cmap.size) continue;
+        const std::uint16_t format = rd16(cmap.data + off);
+        int rank = 0;
+        if (format == 12 && (platform == 0 || (platform == 3 && encoding == 10))) rank = 2;
+        else if (format == 4 && (platform == 0 || (platform == 3 && encoding == 1))) rank = 1;
+        if (rank > bestRank) {
+            bestRank = rank;
+            best     = Table{cmap.data + off, cmap.size - off};
+        }
+    }
+    return best;
+}
+
+std::uint32_t cmapLookup(Table sub, char32_t cp) {
+    if (!sub || sub.size < 4) return 0;
+    const std::uint8_t* p = sub.data;
+    if (rd16(p) == 4) {
+        if (cp > 0xFFFF || sub.size < 14) return 0;
+        const std::size_t segX2 = rd16(p + 6);
+        if (16 + 4 * segX2 > sub.size) return 0;
+        const std::uint8_t* ends    = p + 14;
+        const std::uint8_t* starts  = ends + segX2 + 2;
+        const std::uint8_t* deltas  = starts + segX2;
+        const std::uint8_t* ranges  = deltas + segX2;
+        for (std::size_t s = 0; s < segX2; s += 2) {
+            if (cp > rd16(ends + s)) continue;
+            const std::uint16_t start = rd16(starts + s);
+            if (cp < start) return 0;
+            const std::uint16_t delta = rd16(deltas + s), ro = rd16(ranges + s);
+            if (ro == 0) return (cp + delta) & 0xFFFF;
+            const std::size_t at = static_cast<std::size_t>(ranges + s - p) + ro + 2 * (cp - start);
+            if (at + 2 > sub.size) return 0;
+            const std::uint16_t g = rd16(p + at);
+            return g == 0 ? 0 : (g + delta) & 0xFFFF;
+        }
+        return 0;
+    }
+    if (rd16(p) == 12) {
+        if (sub.size < 16) return 0;
+        const std::uint32_t groups = rd32(p + 12);
+        for (std::uint32_t i = 0; i < groups && 16 + (i + 1) * 12u <= sub.size; ++i) {
+            const std::uint8_t* g = p + 16 + i * 12;
+            const std::uint32_t first = rd32(g), last = rd32(g + 4);
+            if (cp >= first && cp <= last) return rd32(g + 8) + (cp - first);
+        }
+    }
+    return 0;
+}
+
+// Offsets glyf de chaque glyphe (numGlyphs + 1 entrées)
+bool readLoca(const Font& f, std::vector<std::uint32_t>& out) {
+    const Table head = f.get("head"), maxp = f.get("maxp"), loca = f.get("loca"), glyf = f.get("glyf");
+    if (!head || head.size < 54 || !maxp || maxp.size < 6 || !loca || !glyf) return false;
+    const bool longFormat = rd16(head.data + 50) != 0;
+    const std::size_t n   = rd16(maxp.data + 4);
+    if (loca.size < (n + 1) * (longFormat ? 4 : 2)) return false;
+    out.resize(n + 1);
+    for (std::size_t i = 0; i <= n; ++i)
+        out[i] = longFormat ? rd32(loca.data + 4 * i) : 2u * rd16(loca.data + 2 * i);
+    for (std::size_t i = 0; i < n; ++i)
+        if (out[i] > out[i + 1] || out[i + 1] > glyf.size) return false;
+    return true;
+}
+
+// Ajoute les composants d'un glyphe composite (récursivement)
+void addComponents(const Table& glyf, const std::vector<std::uint32_t>& loca, std::uint32_t glyph,
+                   std::set<std::uint32_t>& keep) {
+    const std::uint32_t begin = loca[glyph], end = loca[glyph + 1];
+    if (end - begin < 10 || static_cast<std::int16_t>(rd16(glyf.data + begin)) >= 0) return;
+    std::size_t at = begin + 10;
+    for (;;) {
+        if (at + 4 > end) return;
+        const std::uint16_t flags = rd16(glyf.data + at);
+        const std::uint16_t comp  = rd16(glyf.data + at + 2);
+        at += 4;
+        at += (flags & 0x0001) ? 4 : 2;        // ARG_1_AND_2_ARE_WORDS
+        if (flags & 0x0008)      at += 2;      // WE_HAVE_A_SCALE
+        else if (flags & 0x0040) at += 4;      // WE_HAVE_AN_X_AND_Y_SCALE
+        else if (flags & 0x0080) at += 8;      // WE_HAVE_A_TWO_BY_TWO
+        if (comp + 1u < loca.size() && keep.insert(comp).second) addComponents(glyf, loca, comp, keep);
+        if (!(flags & 0x0020)) return;         // MORE_COMPONENTS
+    }
+}
+
+// cmap (3,1) format 4 : segments de points de code consécutifs à glyphes consécutifs
+std::vector<std::uint8_t> buildCmap(const std::vector<std::pair<char32_t, std::uint32_t>>& map) {
+    struct Seg { std::uint32_t start, end, delta; };
+    std::vector<Seg> segs;
+    for (auto [cp, g] : map) {
+        if (cp > 0xFFFE || g == 0 || g > 0xFFFF) continue;
+        const std::uint32_t delta = (g - cp) & 0xFFFF;
+        if (!segs.empty() && segs.back().end + 1 == cp && segs.back().delta == delta) segs.back().end = cp;
+        else segs.push_back(Seg{cp, cp, delta});
+    }
+    segs.push_back(Seg{0xFFFF, 0xFFFF, 1});
+
+    const std::uint32_t segCount = static_cast<std::uint32_t>(segs.size());
+    std::uint32_t searchRange = 2, entrySelector = 0;
+    while (searchRange * 2 <= segCount * 2) { searchRange *= 2; ++entrySelector; }
+
+    std::vector<std::uint8_t> sub;
+    put16(sub, 4);
+    put16(sub, 16 + 8 * segCount);
+    put16(sub, 0);                     // language
+    put16(sub, segCount * 2);
+    put16(sub, searchRange);
+    put16(sub, entrySelector);
+    put16(sub, segCount * 2 - searchRange);
+    for (const Seg& s : segs) put16(sub, s.end);
+    put16(sub, 0);                     // reservedPad
+    for (const Seg& s : segs) put16(sub, s.start);
+    for (const Seg& s : segs) put16(sub, s.delta);
+    for (std::size_t i = 0; i < segs.size(); ++i) put16(sub, 0);
+
+    std::vector<std::uint8_t> out;
+    put16(out, 0);
+    put16(out, 1);
+    put16(out, 3);
+    put16(out, 1);
+    put32(out, 12);
+    out.insert(out.end(), sub.begin(), sub.end());
+    return out;
+}
+
+// Tables gardées telles quelles ; tout le reste est retiré
+const std::set<std::string> kKeptTables = {"OS/2", "cvt ", "fpgm", "gasp", "hhea", "hmtx",
+                                           "kern", "maxp", "name", "prep"};
+} // namespace
+
+bool parseCodepointRanges(std::string_view text, std::vector<CodepointRange>& out) {
+    out.clear();
+    while (!text.empty()) {
+        const std::size_t comma = text.find(',');
+        std::string_view item   = text.substr(0, comma);
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+        while (!item.empty() && item.front() == ' ') item.remove_prefix(1);
+        while (!item.empty() && item.back() == ' ') item.remove_suffix(1);
+        if (item.empty()) continue;
+
+        auto hex = [](std::string_view s, std::uint32_t& v) {
+            auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), v, 16);
+            return ec == std::errc{} && p == s.data() + s.size() && v <= 0x10FFFF;
+        };
+        const std::size_t dash = item.find('-');
+        std::uint32_t a = 0, b = 0;
+        if (!hex(item.substr(0, dash), a)) return false;
+        b = a;
+        if (dash != std::string_view::npos && !hex(item.substr(dash + 1), b)) return false;
+        if (b < a) return false;
+        out.push_back(CodepointRange{a, b});
+    }
+    return !out.empty();
+}
+
+bool subsetTrueType(const std::vector<std::uint8_t>& bytes, const std::vector<CodepointRange>& ranges,
+                    std::vector<std::uint8_t>& out, FontSubsetStats* stats, std::string* error) {
+    auto fail = [&](const char* msg) {
+        if (error) *error = msg;
+        return false;
+    };
+    Font f(bytes);
+    if (!f.parse()) return fail("not a TrueType font (CFF/OpenType fonts are not supported)");
+    std::vector<std::uint32_t> loca;
+    if (!readLoca(f, loca)) return fail("missing or invalid head/maxp/loca/glyf tables");
+    const Table sub = findCmapSubtable(f);
+    if (!sub) return fail("no Unicode cmap subtable");
+    const Table glyf = f.get("glyf"), head = f.get("head"), post = f.get("post");
+
+    // --- Glyphes retenus : .notdef, ceux des plages, et leurs composants
+    const std::size_t numGlyphs = loca.size() - 1;
+    std::set<std::uint32_t> keep = {0};
+    std::vector<std::pair<char32_t, std::uint32_t>> map;
+    for (const CodepointRange& r : ranges) {
+        for (char32_t cp = r.first; cp <= r.last; ++cp) {
+            const std::uint32_t g = cmapLookup(sub, cp);
+            if (g == 0 || g >= numGlyphs) continue;
+            map.emplace_back(cp, g);
+            keep.insert(g);
+        }
+    }
+    std::sort(map.begin(), map.end());
+    map.erase(std::unique(map.begin(), map.end()), map.end());
+    for (std::uint32_t g : std::vector<std::uint32_t>(keep.begin(), keep.end())) addComponents(glyf, loca, g, keep);
+
+    // --- glyf/loca : mêmes numéros de glyphe, données vides pour les autres
+    std::map<std::string, std::vector<std::uint8_t>> tables;
+    std::vector<std::uint8_t>& newGlyf = tables["glyf"];
+    std::vector<std::uint32_t> newLoca(numGlyphs + 1, 0);
+    for (std::size_t g = 0; g < numGlyphs; ++g) {
+        newLoca[g] = static_cast<std::uint32_t>(newGlyf.size());
+        if (!keep.count(static_cast<std::uint32_t>(g))) continue;
+        newGlyf.insert(newGlyf.end(), glyf.data + loca[g], glyf.data + loca[g + 1]);
+        while (newGlyf.size() % 4) newGlyf.push_back(0);
+    }
+    newLoca[numGlyphs] = static_cast<std::uint32_t>(newGlyf.size());
+    const bool longLoca = newGlyf.size() > 0x1FFFE;
+    std::vector<std::uint8_t>& locaOut = tables["loca"];
+    for (std::uint32_t off : newLoca) {
+        if (longLoca) put32(locaOut, off);
+        else          put16(locaOut, off / 2);
+    }
+
+    std::vector<std::uint8_t>& headOut = tables["head"];
+    headOut.assign(head.data, head.data + head.size);
+    set16(headOut, 50, longLoca ? 1 : 0);
+    set32(headOut, 8, 0); // checkSumAdjustment, recalculé à la fin
+
+    tables["cmap"] = buildCmap(map);
+
+    // post version 3 : pas de noms de glyphes
+    std::vector<std::uint8_t>& postOut = tables["post"];
+    postOut.assign(32, 0);
+    if (post && post.size >= 32) std::memcpy(postOut.data(), post.data, 32);
+    set32(postOut, 0, 0x00030000);
+
+    if (stats) {
+        *stats = FontSubsetStats{};
+        stats->glyphsKept  = keep.size();
+        stats->glyphsTotal = numGlyphs;
+        stats->bytesIn     = bytes.size();
+    }
+    for (const auto& [tag, t] : f.tables) {
+        if (kKeptTables.count(tag)) tables[tag].assign(t.data, t.data + t.size);
+        else if (!tables.count(tag) && stats) stats->droppedTables.push_back(tag);
+    }
+
+    // --- Assemblage : répertoire trié par tag, tables alignées sur 4 octets
+    const std::uint32_t count = static_cast<std::uint32_t>(tables.size());
+    std::uint32_t searchRange = 1, entrySelector = 0;
+    while (searchRange * 2 <= count) { searchRange *= 2; ++entrySelector; }
+    out.clear();
+    put32(out, 0x00010000);
+    put16(out, count);
+    put16(out, searchRange * 16);
+    put16(out, entrySelector);
+    put16(out, count * 16 - searchRange * 16);
+    std::size_t dir = out.size();
+    out.resize(out.size() + count * 16);
+    std::size_t headAt = 0;
+    for (const auto& [tag, data] : tables) {
+        const std::size_t at = out.size();
+        if (tag == "head") headAt = at;
+        std::memcpy(out.data() + dir, tag.data(), 4);
+        set32(out, dir + 4, checksum(data.data(), data.size()));
+        set32(out, dir + 8, static_cast<std::uint32_t>(at));
+        set32(out, dir + 12, static_cast<std::uint32_t>(data.size()));
+        dir += 16;
+        out.insert(out.end(), data.begin(), data.end());
+        while (out.size() % 4) out.push_back(0);
+    }
+    set32(out, headAt + 8, 0xB1B0AFBAu - checksum(out.data(), out.size()));
+
+    if (stats) stats->bytesOut = out.size();
+    return true;
+}
+
+std::uint32_t fontGlyphIndex(const std::vector<std::uint8_t>& bytes, char32_t cp) {
+    Font f(bytes);
+    return f.parse() ? cmapLookup(findCmapSubtable(f), cp) : 0;
+}
+
+std::size_t fontGlyphDataSize(const std::vector<std::uint8_t>& bytes, std::uint32_t glyph) {
+    Font f(bytes);
+    std::vector<std::uint32_t> loca;
+    if (!f.parse() || !readLoca(f, loca) || glyph + 1 >= loca.size()) return 0;
+    return loca[glyph + 1] - loca[glyph];
+}
+
+bool fontChecksumValid(const std::vector<std::uint8_t>& bytes) {
+    Font f(bytes);
+    if (!f.parse()) return false;
+    const Table head = f.get("head");
+    if (!head || head.size < 12) return false;
+    // Somme du fichier avec checkSumAdjustment à zéro
+    std::vector<std::uint8_t> copy = bytes;
+    const std::size_t at = static_cast<std::size_t>(head.data - bytes.data()) + 8;
+    const std::uint32_t adjustment = rd32(copy.data() + at);
+    set32(copy, at, 0);
+    return 0xB1B0AFBAu - checksum(copy.data(), copy.size()) == adjustment;
+}
+
+// --- Paquet de polices
+namespace {
+constexpr char          kBundleMagic[4] = {'T', 'D', 'F', 'B'};
+constexpr std::uint32_t kBundleVersion  = 1;
+} // namespace
+
+bool writeFontBundle(const std::string& path,
+                     const std::vector<std::pair<std::string, std::vector<std::uint8_t>>>& fonts) {
+    std::vector<std::uint8_t> index;
+    index.insert(index.end(), kBundleMagic, kBundleMagic + 4);
+    put32(index, kBundleVersion);
+    put32(index, static_cast<std::uint32_t>(fonts.size()));
+    std::size_t indexSize = index.size();
+    for (const auto& [name, data] : fonts) indexSize += 2 + name.size() + 8 + 8;
+
+    std::uint64_t offset = indexSize;
+    for (const auto& [name, data] : fonts) {
+        put16(index, static_cast<std::uint32_t>(name.size()));
+        index.insert(index.end(), name.begin(), name.end());
+        put32(index, static_cast<std::uint32_t>(offset >> 32));
+        put32(index, static_cast<std::uint32_t>(offset));
+        put32(index, static_cast<std::uint32_t>(data.size() >> 32));
+        put32(index, static_cast<std::uint32_t>(data.size()));
+        offset += data.size();
+    }
+
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if (!os) return false;
+    os.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size()));
+    for (const auto& [name, data] : fonts)
+        os.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(os);
+}
+
+bool readFontBundleIndex(const std::string& path, std::vector<FontBundleEntry>& out) {
+    out.clear();
+    std::ifstream is(path, std::ios::binary);
+    if (!is) return false;
+    is.seekg(0, std::ios::end);
+    const std::uint64_t fileSize = static_cast<std::uint64_t>(is.tellg());
+    is.seekg(0);
+
+    std::uint8_t hdr[12];
+    if (!is.read(reinterpret_cast<char*>(hdr), 12) || std::memcmp(hdr, kBundleMagic, 4) != 0
+        || rd32(hdr + 4) != kBundleVersion)
+        return false;
+    const std::uint32_t count = rd32(hdr + 8);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        std::uint8_t len[2];
+        if (!is.read(reinterpret_cast<char*>(len), 2)) return false;
+        FontBundleEntry e;
+        e.name.resize(rd16(len));
+        std::uint8_t pos[16];
+        if (!is.read(e.name.data(), static_cast<std::streamsize>(e.name.size()))
+            || !is.read(reinterpret_cast<char*>(pos), 16))
+            return false;
+        e.offset = (std::uint64_t{rd32(pos)} << 32) | rd32(pos + 4);
+        e.size   = (std::uint64_t{rd32(pos + 8)} << 32) | rd32(pos + 12);
+        if (e.offset + e.size > fileSize) return false;
+        out.push_back(std::move(e));
+    }
+    return true;
+}
+
+bool readFontBundleEntry(const std::string& path, const FontBundleEntry& entry, std::vector<char>& out) {
+    std::ifstream is(path, std::ios::binary);
+    if (!is) return false;
+    out.resize(static_cast<std::size_t>(entry.size));
+    is.seekg(static_cast<std::streamoff>(entry.offset));
+    return static_cast<bool>(is.read(out.data(), static_cast<std::streamsize>(out.size())));
+}
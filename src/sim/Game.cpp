@@ -0,0 +1,386 @@
+#include "sim/Game.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "sim/Profiler.hpp"
+
+Game::Game(const GameSetup& setup, const GridMap* map, JobSystem* jobs)
+: setup_(setup), jobs_(jobs), botRng_(setup.seed, 0xB07B07B07ull) {
+    preset_ = matchPreset(setup_.difficulty);
+    lives_  = setup_.difficulty.livesStart;
+    gold_   = setup_.rules.startMaterials[0];
+    result_.seed = setup_.seed;
+
+    setupMap(map);
+    grid_.configure(static_cast<float>(map_.width), static_cast<float>(map_.height), kTowerRange);
+}
+
+// ============================
+//  Carte
+// ============================
+MapGenParams Game::mapParams(const GameSetup& setup) {
+    MapGenParams p;
+    p.width  = setup.mapWidth;
+    p.height = setup.mapHeight;
+    return p;
+}
+
+void Game::setupMap(const GridMap* premade) {
+    // Carte fournie (cache) : seulement si elle correspond à la partie
+    if (premade && premade->width == setup_.mapWidth && premade->height == setup_.mapHeight) {
+        map_ = *premade;
+    } else {
+        generateMap(mapParams(setup_), setup_.seed, map_);
+    }
+    fields_.build(map_, jobs_);
+    onPath_.assign(map_.cellCount(), 0);
+}
+
+// Cellules empruntées par les ennemis (descente du champ depuis chaque spawn)
+void Game::markPaths() {
+    std::fill(onPath_.begin(), onPath_.end(), 0);
+    for (const Cell& s : map_.spawns) {
+        const int goal = fields_.nearestExit(s);
+        if (goal < 0) continue;
+        const FlowField& f = fields_.fields[static_cast<std::size_t>(goal)];
+        Cell c = s;
+        for (std::size_t guard = 0; guard < map_.cellCount(); ++guard) {
+            onPath_[map_.index(c)] = 1;
+            const std::uint8_t d = f.direction(c);
+            if (d == FlowField::kNoDir) break;
+            c = Cell{c.x + FlowField::kDirX[d], c.y + FlowField::kDirY[d]};
+        }
+    }
+}
+
+// ============================
+//  Commandes
+// ============================
+void Game::submit(GameCommand cmd) {
+    cmd.tick = tick_;
+    pending_.push_back(cmd);
+}
+
+std::size_t Game::towerAt(int x, int y) const {
+    const TowerStore& t = world_.towers;
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        if (static_cast<int>(t.posX[i]) == x && static_cast<int>(t.posY[i]) == y) return i;
+    }
+    return t.size();
+}
+
+bool Game::apply(const GameCommand& cmd) {
+    TowerStore& t = world_.towers;
+    const Cell  c{cmd.x, cmd.y};
+
+    switch (cmd.type) {
+        case CommandType::PlaceTower: {
+            if (gold_ < kTowerCost || cmd.arg > static_cast<std::uint8_t>(TargetMode::Strongest)) return false;
+            if (!fields_.canPlace(map_, c, setup_.rules.forbidTotalBlock)) return false;
+            // Pas de tour sur un ennemi (il resterait coincé dans la case)
+            const EnemyStore& e = world_.enemies;
+            for (std::size_t i = 0; i < e.size(); ++i) {
+                if (static_cast<int>(e.posX[i]) == c.x && static_cast<int>(e.posY[i]) == c.y) return false;
+            }
+            fields_.setBlocked(map_, c, true, jobs_);
+            t.build(TowerSpec{c.x + 0.5f, c.y + 0.5f, kTowerRange, kTowerDamage, kTowerFireRate,
+                              static_cast<TargetMode>(cmd.arg)});
+            gold_ -= kTowerCost;
+            ++result_.towersBuilt;
+            return true;
+        }
+        case CommandType::SellTower: {
+            const std::size_t i = towerAt(c.x, c.y);
+            if (i == t.size()) return false;
+            t.destroy(t.ids.handleAt(static_cast<std::uint32_t>(i)));
+            fields_.setBlocked(map_, c, false, jobs_);
+            gold_ += kTowerCost / 2;
+            return true;
+        }
+        case CommandType::SetTargetMode: {
+            const std::size_t i = towerAt(c.x, c.y);
+            if (i == t.size() || cmd.arg > static_cast<std::uint8_t>(TargetMode::Strongest)) return false;
+            t.mode[i] = static_cast<TargetMode>(cmd.arg);
+            return true;
+        }
+        case CommandType::StartWave:
+            if (phase_ != Phase::Build) return false;
+            startWave();
+            return true;
+    }
+    return false;
+}
+
+// ============================
+//  Joueur automatique
+// ============================
+// Entre deux vagues : dépense l'or en tours, chacune sur la case libre hors
+// chemin qui couvre le plus de cases du chemin (égalités tirées au sort).
+// Passe par les mêmes commandes qu'un joueur : elles sont enregistrées.
+void Game::runAutoPlayer() {
+    const int r = static_cast<int>(kTowerRange);
+    while (gold_ >= kTowerCost) {
+        markPaths();
+
+        int bestScore = 0;
+        std::uint32_t bestCount = 0;
+        Cell best{};
+        for (int y = 0; y < map_.height; ++y) {
+            for (int x = 0; x < map_.width; ++x) {
+                if (!map_.passable(x, y) || onPath_[map_.index(x, y)]) continue;
+                int score = 0;
+                for (int dy = -r; dy <= r; ++dy) {
+                    for (int dx = -r; dx <= r; ++dx) {
+                        if (dx * dx + dy * dy > r * r || !map_.inBounds(x + dx, y + dy)) continue;
+                        score += onPath_[map_.index(x + dx, y + dy)];
+                    }
+                }
+                if (score == 0 || score < bestScore) continue;
+                if (score > bestScore) { bestScore = score; bestCount = 0; }
+                // Tirage uniforme parmi les ex aequo (réservoir)
+                if (botRng_.below(++bestCount) == 0) best = Cell{x, y};
+            }
+        }
+        if (bestScore == 0) break;
+
+        GameCommand cmd;
+        cmd.tick = tick_;
+        cmd.type = CommandType::PlaceTower;
+        cmd.arg  = static_cast<std::uint8_t>(TargetMode::First);
+        cmd.x    = static_cast<std::int16_t>(best.x);
+        cmd.y    = static_cast<std::int16_t>(best.y);
+        if (!apply(cmd)) break;
+        if (sink_) sink_(cmd);
+    }
+}
+
+void Game::retune(const DifficultyParams& difficulty, const GameRules& rules) {
+    DifficultyParams& d = setup_.difficulty;
+    // Vague en cours : ses pv suivent le nouveau multiplicateur
+    if (wave_ > 0) waveHp_ *= difficulty.hpMultiplier / d.hpMultiplier;
+    d.hpMultiplier     = difficulty.hpMultiplier;
+    d.speedMultiplier  = difficulty.speedMultiplier;
+    d.rewardMultiplier = difficulty.rewardMultiplier;
+    setup_.rules.forbidTotalBlock = rules.forbidTotalBlock;
+    preset_ = matchPreset(d); // ennemis déjà apparus : fieldPreset_ inchangé
+}
+
+// ============================
+//  Vagues
+// ============================
+void Game::startWave() {
+    ++wave_;
+    phase_      = Phase::Wave;
+    phaseTime_  = 0.f;
+    toSpawn_    = 6 + 2 * wave_;
+    waveHp_     = wave_ == 1 ? kEnemyHp * setup_.difficulty.hpMultiplier : waveHp_ * kEnemyHpGrowth;
+    spawnTimer_ = 0.f;
+}
+
+void Game::spawnEnemies() {
+    spawnTimer_ -= kDt;
+    if (toSpawn_ <= 0 || spawnTimer_ > 0.f) return;
+    spawnTimer_ += kSpawnInterval;
+    --toSpawn_;
+
+    const Cell s = map_.spawns[nextSpawn_++ % map_.spawns.size()];
+    const int goal = fields_.nearestExit(s);
+    if (goal < 0) return;
+
+    // Politique résolue une fois, à l'apparition : l'ennemi garde ces valeurs
+    // (mêmes calculs que EnemyTuning dans stepWave) même après un retune
+    EnemyStore&         store   = world_.enemies;
+    const RuntimePolicy runtime = runtimePolicy(setup_.difficulty);
+    EnemySpawn e;
+    e.x    = s.x + 0.5f;
+    e.y    = s.y + 0.5f;
+    e.hp   = waveHp_;
+    e.goal = static_cast<std::uint8_t>(goal);
+    visitDifficulty(preset_, runtime, [&](const auto& policy) {
+        const EnemyTuning<std::decay_t<decltype(policy)>> t{policy};
+        e.speed  = t.speed(store, 0);
+        e.reward = t.reward(store, 0);
+    });
+
+    if (store.size() == 0) {
+        fieldPreset_  = preset_;
+        fieldRuntime_ = runtime;
+        fieldMixed_   = false;
+    } else if (preset_ != fieldPreset_ || (preset_ == DifficultyPreset::Runtime && runtime != fieldRuntime_)) {
+        fieldMixed_ = true;
+    }
+    store.spawn(e);
+}
+
+void Game::fireTowers() {
+    TowerStore& t = world_.towers;
+    const EnemyStore& e = world_.enemies;
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        if (t.cooldown[i] > 0.f) continue;
+        const std::uint32_t k = e.ids.denseIndex(t.target[i]);
+        if (k == Handle::kInvalid) continue;
+
+        ProjectileSpawn p;
+        p.x      = t.posX[i];
+        p.y      = t.posY[i];
+        p.damage = t.damage[i];
+        p.ttl    = 2.f * t.range[i] / kProjectileSpeed;
+        p.target = t.target[i];
+        world_.projectiles.fire(p); // vitesse fixée par steerProjectiles
+        t.cooldown[i] = 1.f / t.fireRate[i];
+    }
+}
+
+// ============================
+//  Tick
+// ============================
+void Game::step() {
+    if (over_) return;
+    PROFILE_SCOPE("Game::step");
+
+    // Entrées du tick : joueur automatique puis commandes soumises, dans l'ordre
+    if (setup_.autoPlayer && botPending_ && phase_ == Phase::Build) {
+        botPending_ = false;
+        runAutoPlayer();
+    }
+    std::size_t keep = 0;
+    for (const GameCommand& cmd : pending_) {
+        if (cmd.tick > tick_) { pending_[keep++] = cmd; continue; }
+        if (apply(cmd) && sink_) sink_(cmd);
+    }
+    pending_.resize(keep);
+
+    ++tick_;
+    ++result_.ticks;
+    phaseTime_ += kDt;
+
+    if (phase_ == Phase::Build) {
+        if (phaseTime_ >= kBuildTime) startWave();
+        return;
+    }
+
+    spawnEnemies();
+    // Un aiguillage par tick ; terrain homogène : constantes de sa politique
+    if (fieldMixed_) {
+        stepWave(PerEnemyTuning{});
+    } else {
+        visitDifficulty(fieldPreset_, fieldRuntime_, [this](const auto& policy) {
+            stepWave(EnemyTuning<std::decay_t<decltype(policy)>>{policy});
+        });
+    }
+}
+
+template <class Tuning>
+void Game::stepWave(const Tuning& tuning) {
+    EnemyStore& e = world_.enemies;
+    {
+        PROFILE_SCOPE("Game::moveEnemies");
+        arrived_.clear();
+        steerEnemiesByFlowField(e, fields_, kDt, tuning, &arrived_);
+        for (const Handle h : arrived_) {
+            e.destroy(h);
+            --lives_;
+            ++result_.livesLost;
+        }
+    }
+    {
+        PROFILE_SCOPE("Game::towers");
+        grid_.rebuild(e, jobs_);
+        acquireTargets(world_.towers, e, grid_, jobs_);
+        tickTowerCooldowns(world_.towers, kDt);
+        fireTowers();
+    }
+
+    ProjectileStore& p = world_.projectiles;
+    {
+        PROFILE_SCOPE("Game::projectiles");
+        steerProjectiles(p, e, kProjectileSpeed);
+        integrateProjectiles(p, kDt);
+        hits_.clear();
+        resolveProjectileHits(p, e, kHitRadius, hits_);
+        applyHits(e, hits_);
+    }
+    killed_.clear();
+    gold_ += static_cast<std::uint32_t>(removeDeadEnemies(e, tuning, &killed_));
+    result_.kills += killed_.size();
+
+    if (lives_ <= 0) {
+        over_ = true;
+        return;
+    }
+
+    const bool cleared = toSpawn_ == 0 && e.size() == 0;
+    if (cleared || phaseTime_ >= kWaveTimeout) {
+        if (!cleared) { over_ = true; return; } // ennemis coincés : partie invalide
+        result_.wavesCleared = wave_;
+        result_.goldCurve.push_back(gold_);
+        if (wave_ >= setup_.maxWaves) {
+            result_.survived = true;
+            over_ = true;
+            return;
+        }
+        p.clear();
+        phase_      = Phase::Build;
+        phaseTime_  = 0.f;
+        botPending_ = true;
+    }
+}
+
+GameResult Game::run() {
+    while (!over_) step();
+    return result_;
+}
+
+// ============================
+//  Empreinte d'état
+// ============================
+namespace {
+
+struct Fnv1a {
+    std::uint64_t h = 14695981039346656037ull;
+
+    void bytes(const void* p, std::size_t n) {
+        const auto* b = static_cast<const unsigned char*>(p);
+        for (std::size_t i = 0; i < n; ++i) { h ^= b[i]; h *= 1099511628211ull; }
+    }
+    template <class T> void value(const T& v) { bytes(&v, sizeof(T)); }
+    template <class T> void array(const std::vector<T>& v) {
+        value(v.size());
+        if (!v.empty()) bytes(v.data(), v.size() * sizeof(T));
+    }
+};
+
+} // namespace
+
+std::uint64_t Game::stateHash() const {
+    Fnv1a f;
+    f.value(tick_);
+    f.value(static_cast<std::uint8_t>(phase_));
+    f.value(phaseTime_);
+    f.value(wave_);
+    f.value(waveHp_);
+    f.value(toSpawn_);
+    f.value(spawnTimer_);
+    f.value(nextSpawn_);
+    f.value(lives_);
+    f.value(gold_);
+    f.array(map_.blocked);
+
+    const EnemyStore& e = world_.enemies;
+    f.array(e.posX); f.array(e.posY); f.array(e.velX); f.array(e.velY);
+    f.array(e.hp); f.array(e.progress); f.array(e.pathIdx);
+    f.array(e.speed); f.array(e.reward); f.array(e.goal);
+
+    const TowerStore& t = world_.towers;
+    f.array(t.posX); f.array(t.posY); f.array(t.range); f.array(t.damage);
+    f.array(t.cooldown); f.array(t.fireRate); f.array(t.mode);
+    for (const Handle& h : t.target) { f.value(h.index); f.value(h.generation); }
+
+    const ProjectileStore& p = world_.projectiles;
+    f.array(p.posX); f.array(p.posY); f.array(p.velX); f.array(p.velY);
+    f.array(p.damage); f.array(p.ttl);
+    for (const Handle& h : p.target) { f.value(h.index); f.value(h.generation); }
+    return f.h;
+}
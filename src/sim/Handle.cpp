@@ -0,0 +1,64 @@
+#include "sim/Handle.hpp"
+
+Handle HandleTable::create() {
+    const auto dense = static_cast<std::uint32_t>(denseToSlot_.size());
+    std::uint32_t slot;
+    if (freeHead_ != Handle::kInvalid) {
+        // Réutilise un slot libre (sa génération a déjà été incrémentée)
+        slot      = freeHead_;
+        freeHead_ = slots_[slot].dense;
+        slots_[slot].dense = dense;
+    } else {
+        slot = static_cast<std::uint32_t>(slots_.size());
+        slots_.push_back(Slot{dense, 0});
+    }
+    denseToSlot_.push_back(slot);
+    return Handle{slot, slots_[slot].generation};
+}
+
+bool HandleTable::destroy(Handle h, std::uint32_t& dst) {
+    dst = denseIndex(h);
+    if (dst == Handle::kInvalid) return false;
+
+    // Le dernier élément dense prend la place du détruit
+    const std::uint32_t lastSlot = denseToSlot_.back();
+    denseToSlot_[dst]     = lastSlot;
+    slots_[lastSlot].dense = dst;
+    denseToSlot_.pop_back();
+
+    // Slot libéré : nouvelle génération, chaîné en tête de la free list
+    Slot& s = slots_[h.index];
+    ++s.generation;
+    s.dense   = freeHead_;
+    freeHead_ = h.index;
+    return true;
+}
+
+std::uint32_t HandleTable::denseIndex(Handle h) const {
+    if (h.index >= slots_.size()) return Handle::kInvalid;
+    const Slot& s = slots_[h.index];
+    if (s.generation != h.generation) return Handle::kInvalid;
+    // Un slot libre garde la génération "suivante" : jamais égale à un handle vivant
+    return s.dense;
+}
+
+Handle HandleTable::handleAt(std::uint32_t dense) const {
+    const std::uint32_t slot = denseToSlot_[dense];
+    return Handle{slot, slots_[slot].generation};
+}
+
+void HandleTable::reserve(std::size_t n) {
+    slots_.reserve(n);
+    denseToSlot_.reserve(n);
+}
+
+void HandleTable::clear() {
+    // On garde les slots (et leurs générations) : les anciens handles restent périmés
+    for (std::uint32_t slot : denseToSlot_) {
+        Slot& s = slots_[slot];
+        ++s.generation;
+        s.dense   = freeHead_;
+        freeHead_ = slot;
+    }
+    denseToSlot_.clear();
+}
@@ -0,0 +1,200 @@
+#include "sim/JobSystem.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "sim/Profiler.hpp"
+
+class JobSystem::Job {
+public:
+    std::function<void()> fn;
+    std::atomic<int>      unmet{1}; // dépendances pas encore terminées (+1 pendant add)
+    std::atomic<bool>     finished{false};
+    std::mutex            mutex;    // protège dependents et le passage à finished
+    std::vector<JobHandle> dependents;
+};
+
+namespace {
+
+// Participant courant : index dans le JobSystem qui l'a lancé
+thread_local const JobSystem* tSystem = nullptr;
+thread_local unsigned         tIndex  = 0;
+
+} // namespace
+
+JobSystem::JobSystem(unsigned threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < threads; ++i) queues_.push_back(std::make_unique<Queue>());
+    // Files toutes créées avant le premier thread : personne ne les voit grandir
+    for (unsigned i = 1; i < threads; ++i) threads_.emplace_back([this, i] { workerLoop(i); });
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stop_ = true;
+    }
+    sleepCv_.notify_all();
+    for (auto& t : threads_) t.join();
+}
+
+unsigned JobSystem::selfIndex() const {
+    return tSystem == this ? tIndex : 0;
+}
+
+// ============================
+//  Soumission
+// ============================
+template <class Range>
+JobSystem::JobHandle JobSystem::addJob(std::function<void()> fn, const Range& deps) {
+    auto job = std::make_shared<Job>();
+    job->fn = std::move(fn);
+    for (const JobHandle& d : deps) {
+        if (!d) continue;
+        std::lock_guard<std::mutex> lock(d->mutex);
+        if (d->finished.load(std::memory_order_relaxed)) continue;
+        d->dependents.push_back(job);
+        job->unmet.fetch_add(1, std::memory_order_relaxed);
+    }
+    // Retire le +1 initial : prête si tout était déjà fini
+    if (job->unmet.fetch_sub(1, std::memory_order_acq_rel) == 1) push(job);
+    return job;
+}
+
+JobSystem::JobHandle JobSystem::add(std::function<void()> fn, std::initializer_list<JobHandle> deps) {
+    return addJob(std::move(fn), deps);
+}
+
+JobSystem::JobHandle JobSystem::add(std::function<void()> fn, const std::vector<JobHandle>& deps) {
+    return addJob(std::move(fn), deps);
+}
+
+void JobSystem::push(JobHandle job) {
+    Queue& q = *queues_[selfIndex()];
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.jobs.push_back(std::move(job));
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+    if (threads_.empty()) return;
+    // Passage par le verrou : un worker qui s'endort a déjà vu queued_ ou verra la notification
+    { std::lock_guard<std::mutex> lock(sleepMutex_); }
+    sleepCv_.notify_one();
+}
+
+// ============================
+//  Exécution
+// ============================
+JobSystem::JobHandle JobSystem::take(unsigned self, bool& stolen) {
+    {
+        Queue& own = *queues_[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            JobHandle job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            stolen = false;
+            return job;
+        }
+    }
+    const auto n = static_cast<unsigned>(queues_.size());
+    for (unsigned k = 1; k < n; ++k) {
+        Queue& victim = *queues_[(self + k) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.jobs.empty()) continue;
+        JobHandle job = std::move(victim.jobs.front());
+        victim.jobs.pop_front();
+        stolen = true;
+        return job;
+    }
+    return nullptr;
+}
+
+bool JobSystem::runOne() {
+    bool stolen = false;
+    JobHandle job = take(selfIndex(), stolen);
+    if (!job) return false;
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    if (stolen) stolen_.fetch_add(1, std::memory_order_relaxed);
+    execute(job);
+    return true;
+}
+
+void JobSystem::execute(const JobHandle& job) {
+    job->fn();
+    job->fn = nullptr; // libère les captures tout de suite
+
+    std::vector<JobHandle> ready;
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->finished.store(true, std::memory_order_release);
+        ready.swap(job->dependents);
+    }
+    executed_.fetch_add(1, std::memory_order_relaxed);
+    // Les suivantes partent dans la file de celui qui vient de finir
+    for (JobHandle& d : ready) {
+        if (d->unmet.fetch_sub(1, std::memory_order_acq_rel) == 1) push(std::move(d));
+    }
+}
+
+template <class Pred>
+void JobSystem::helpUntil(Pred&& pred) {
+    while (!pred()) {
+        if (!runOne()) std::this_thread::yield(); // le reste tourne ailleurs
+    }
+}
+
+void JobSystem::wait(const JobHandle& job) {
+    if (!job) return;
+    helpUntil([&] { return job->finished.load(std::memory_order_acquire); });
+}
+
+bool JobSystem::done(const JobHandle& job) {
+    return !job || job->finished.load(std::memory_order_acquire);
+}
+
+void JobSystem::workerLoop(unsigned index) {
+    tSystem = this;
+    tIndex  = index;
+    Profiler::setThreadName("jobs " + std::to_string(index));
+    for (;;) {
+        if (runOne()) continue;
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleepCv_.wait(lock, [this] { return stop_ || queued_.load(std::memory_order_acquire) > 0; });
+        if (stop_) return;
+    }
+}
+
+// ============================
+//  Boucles parallèles
+// ============================
+void JobSystem::split(std::size_t begin, std::size_t end, std::size_t grain,
+                      const std::function<void(std::size_t, std::size_t)>& f, std::atomic<std::size_t>& left) {
+    // Moitié haute offerte aux voleurs, moitié basse gardée
+    while (end - begin > grain) {
+        const std::size_t mid = begin + (end - begin) / 2;
+        auto half = std::make_shared<Job>();
+        half->fn  = [this, mid, end, grain, &f, &left] { split(mid, end, grain, f, left); };
+        push(std::move(half));
+        end = mid;
+    }
+    f(begin, end);
+    left.fetch_sub(end - begin, std::memory_order_acq_rel);
+}
+
+void JobSystem::parallelFor(std::size_t n, std::size_t grain,
+                            const std::function<void(std::size_t, std::size_t)>& f) {
+    if (n == 0) return;
+    grain = std::max<std::size_t>(grain, 1);
+    if (queues_.size() == 1 || n <= grain) { f(0, n); return; }
+
+    std::atomic<std::size_t> left{n};
+    split(0, n, grain, f, left);
+    helpUntil([&] { return left.load(std::memory_order_acquire) == 0; });
+}
+
+JobSystem::Stats JobSystem::stats() const {
+    Stats s;
+    s.executed = executed_.load(std::memory_order_relaxed);
+    s.stolen   = stolen_.load(std::memory_order_relaxed);
+    return s;
+}
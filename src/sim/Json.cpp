@@ -0,0 +1,318 @@
+#include "sim/Json.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// ============================
+//  JsonValue
+// ============================
+const JsonValue* JsonValue::find(std::string_view key) const {
+    if (!isObject()) return nullptr;
+    for (const auto& m : members_) {
+        if (m.first == key) return &m.second;
+    }
+    return nullptr;
+}
+
+double JsonValue::number(std::string_view key, double fallback) const {
+    const JsonValue* v = find(key);
+    return v ? v->asNumber(fallback) : fallback;
+}
+
+bool JsonValue::boolean(std::string_view key, bool fallback) const {
+    const JsonValue* v = find(key);
+    return v ? v->asBool(fallback) : fallback;
+}
+
+JsonValue JsonValue::makeBool(bool b)          { JsonValue v; v.type_ = Type::Bool;   v.bool_ = b; return v; }
+JsonValue JsonValue::makeNumber(double d)      { JsonValue v; v.type_ = Type::Number; v.number_ = d; return v; }
+JsonValue JsonValue::makeString(std::string s) { JsonValue v; v.type_ = Type::String; v.string_ = std::move(s); return v; }
+JsonValue JsonValue::makeArray()               { JsonValue v; v.type_ = Type::Array; return v; }
+JsonValue JsonValue::makeObject()              { JsonValue v; v.type_ = Type::Object; return v; }
+
+void JsonValue::push(JsonValue v) { items_.push_back(std::move(v)); }
+
+void JsonValue::set(std::string key, JsonValue v) {
+    for (auto& m : members_) {
+        if (m.first == key) { m.second = std::move(v); return; }
+    }
+    members_.emplace_back(std::move(key), std::move(v));
+}
+
+// ============================
+//  Parseur (descente récursive)
+// ============================
+namespace {
+
+constexpr int kMaxDepth = 64;
+
+struct Parser {
+    std::string_view s;
+    std::size_t      pos = 0;
+    std::string      error;
+
+    bool fail(const char* msg) {
+        if (error.empty()) error = std::string(msg) + " at offset " + std::to_string(pos);
+        return false;
+    }
+
+    void skipWs() {
+        while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t' || s[pos] == '\n' || s[pos] == '\r')) ++pos;
+    }
+
+    bool literal(std::string_view word) {
+        if (s.substr(pos, word.size()) != word) return fail("invalid literal");
+        pos += word.size();
+        return true;
+    }
+
+    static void appendUtf8(std::string& out, std::uint32_t cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    bool hex4(std::uint32_t& cp) {
+        if (pos + 4 > s.size()) return fail("truncated \\u escape");
+        cp = 0;
+        for (int i = 0; i < 4; ++i) {
+            const char c = s[pos++];
+            cp <<= 4;
+            if (c >= '0' && c <= '9')      cp |= static_cast<std::uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') cp |= static_cast<std::uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') cp |= static_cast<std::uint32_t>(c - 'A' + 10);
+            else return fail("invalid \\u escape");
+        }
+        return true;
+    }
+
+    bool string(std::string& out) {
+        ++pos; // '"'
+        while (pos < s.size()) {
+            const char c = s[pos++];
+            if (c == '"') return true;
+            if (static_cast<unsigned char>(c) < 0x20) return fail("control character in string");
+            if (c != '\\') { out += c; continue; }
+            if (pos >= s.size()) break;
+            switch (s[pos++]) {
+                case '"':  out += '"';  break;
+                case '\\': out += '\\'; break;
+                case '/':  out += '/';  break;
+                case 'b':  out += '\b'; break;
+                case 'f':  out += '\f'; break;
+                case 'n':  out += '\n'; break;
+                case 'r':  out += '\r'; break;
+                case 't':  out += '\t'; break;
+                case 'u': {
+                    std::uint32_t cp = 0;
+                    if (!hex4(cp)) return false;
+                    // Paire de substitution UTF-16
+                    if (cp >= 0xD800 && cp < 0xDC00 && s.substr(pos, 2) == "\\u") {
+                        pos += 2;
+                        std::uint32_t lo = 0;
+                        if (!hex4(lo)) return false;
+                        if (lo < 0xDC00 || lo >= 0xE000) return fail("invalid surrogate pair");
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                    }
+                    appendUtf8(out, cp);
+                    break;
+                }
+                default: return fail("invalid escape");
+            }
+        }
+        return fail("unterminated string");
+    }
+
+    bool number(JsonValue& out) {
+        const std::size_t start = pos;
+        if (pos < s.size() && s[pos] == '-') ++pos;
+        while (pos < s.size() && ((s[pos] >= '0' && s[pos] <= '9') || s[pos] == '.' ||
+                                  s[pos] == 'e' || s[pos] == 'E' || s[pos] == '+' || s[pos] == '-')) ++pos;
+        double d = 0.0;
+        const auto r = std::from_chars(s.data() + start, s.data() + pos, d);
+        if (r.ec != std::errc{} || r.ptr != s.data() + pos) { pos = start; return fail("invalid number"); }
+        out = JsonValue::makeNumber(d);
+        return true;
+    }
+
+    bool value(JsonValue& out, int depth) {
+        if (depth > kMaxDepth) return fail("nesting too deep");
+        skipWs();
+        if (pos >= s.size()) return fail("unexpected end of input");
+
+        switch (s[pos]) {
+            case '{': {
+                ++pos;
+                out = JsonValue::makeObject();
+                skipWs();
+                if (pos < s.size() && s[pos] == '}') { ++pos; return true; }
+                for (;;) {
+                    skipWs();
+                    if (pos >= s.size() || s[pos] != '"') return fail("expected key");
+                    std::string key;
+                    if (!string(key)) return false;
+                    skipWs();
+                    if (pos >= s.size() || s[pos] != ':') return fail("expected ':'");
+                    ++pos;
+                    JsonValue v;
+                    if (!value(v, depth + 1)) return false;
+                    out.set(std::move(key), std::move(v));
+                    skipWs();
+                    if (pos < s.size() && s[pos] == ',') { ++pos; continue; }
+                    if (pos < s.size() && s[pos] == '}') { ++pos; return true; }
+                    return fail("expected ',' or '}'");
+                }
+            }
+            case '[': {
+                ++pos;
+                out = JsonValue::makeArray();
+                skipWs();
+                if (pos < s.size() && s[pos] == ']') { ++pos; return true; }
+                for (;;) {
+                    JsonValue v;
+                    if (!value(v, depth + 1)) return false;
+                    out.push(std::move(v));
+                    skipWs();
+                    if (pos < s.size() && s[pos] == ',') { ++pos; continue; }
+                    if (pos < s.size() && s[pos] == ']') { ++pos; return true; }
+                    return fail("expected ',' or ']'");
+                }
+            }
+            case '"': {
+                std::string str;
+                if (!string(str)) return false;
+                out = JsonValue::makeString(std::move(str));
+                return true;
+            }
+            case 't': out = JsonValue::makeBool(true);  return literal("true");
+            case 'f': out = JsonValue::makeBool(false); return literal("false");
+            case 'n': out = JsonValue();                return literal("null");
+            default:  return number(out);
+        }
+    }
+};
+
+} // namespace
+
+bool parseJson(std::string_view text, JsonValue& out, std::string* error) {
+    Parser p{text, 0, {}};
+    JsonValue v;
+    bool ok = p.value(v, 0);
+    if (ok) {
+        p.skipWs();
+        if (p.pos != text.size()) ok = p.fail("trailing characters");
+    }
+    if (!ok) {
+        if (error) *error = p.error;
+        return false;
+    }
+    out = std::move(v);
+    return true;
+}
+
+bool loadJsonFile(const std::string& path, JsonValue& out, std::string* error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        if (error) *error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    return parseJson(ss.str(), out, error);
+}
+
+// ============================
+//  Écriture
+// ============================
+namespace {
+
+void writeString(std::string& out, const std::string& s) {
+    out += '"';
+    for (const char ch : s) {
+        const auto c = static_cast<unsigned char>(ch);
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof buf, "\\u%04x", c);
+                    out += buf;
+                } else {
+                    out += ch; // UTF-8 recopié tel quel
+                }
+        }
+    }
+    out += '"';
+}
+
+void writeValue(std::string& out, const JsonValue& v, int indent, int depth) {
+    auto newline = [&](int d) {
+        if (indent < 0) return;
+        out += '\n';
+        out.append(static_cast<std::size_t>(indent * d), ' ');
+    };
+    switch (v.type()) {
+        case JsonValue::Type::Null:   out += "null"; break;
+        case JsonValue::Type::Bool:   out += v.asBool() ? "true" : "false"; break;
+        case JsonValue::Type::Number: {
+            const double d = v.asNumber();
+            char buf[32];
+            if (!std::isfinite(d)) { out += "null"; break; }
+            // Entiers exacts sans partie décimale, sinon aller-retour exact
+            if (d == std::floor(d) && std::fabs(d) < 1e15) std::snprintf(buf, sizeof buf, "%.0f", d);
+            else                                            std::snprintf(buf, sizeof buf, "%.17g", d);
+            out += buf;
+            break;
+        }
+        case JsonValue::Type::String: writeString(out, v.asString()); break;
+        case JsonValue::Type::Array:
+            out += '[';
+            for (std::size_t i = 0; i < v.items().size(); ++i) {
+                if (i) out += ',';
+                newline(depth + 1);
+                writeValue(out, v.items()[i], indent, depth + 1);
+            }
+            if (!v.items().empty()) newline(depth);
+            out += ']';
+            break;
+        case JsonValue::Type::Object:
+            out += '{';
+            for (std::size_t i = 0; i < v.members().size(); ++i) {
+                if (i) out += ',';
+                newline(depth + 1);
+                writeString(out, v.members()[i].first);
+                out += indent < 0 ? ":" : ": ";
+                writeValue(out, v.members()[i].second, indent, depth + 1);
+            }
+            if (!v.members().empty()) newline(depth);
+            out += '}';
+            break;
+    }
+}
+
+} // namespace
+
+std::string writeJson(const JsonValue& v, int indent) {
+    std::string out;
+    writeValue(out, v, indent, 0);
+    return out;
+}
@@ -0,0 +1,442 @@
+#include "sim/Leaderboard.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+#include "sim/Codec.hpp"
+#include "sim/Json.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define TD_HAS_FSYNC 1
+#else
+#define TD_HAS_FSYNC 0
+#endif
+
+namespace {
+
+constexpr char         kMagic[4]   = {'T', 'D', 'L', 'B'};
+constexpr std::uint8_t kVersion    = 1;
+constexpr std::size_t  kHeaderSize = sizeof(kMagic) + 1;
+constexpr std::size_t  kFrameSize  = 8; // u32 taille + u32 FNV-1a
+// Au-delà, une taille lue dans une zone abîmée n'est pas prise au sérieux
+// (un score du jeu tient en quelques dizaines d'octets)
+constexpr std::uint32_t kMaxSalvagedRecord = 4096;
+
+// Priorité du treap : mélange de l'id, pas d'état aléatoire à garder
+std::uint32_t priorityOf(std::uint32_t id) {
+    std::uint32_t x = id * 0x9E3779B9u;
+    x ^= x >> 16; x *= 0x85EBCA6Bu;
+    x ^= x >> 13; x *= 0xC2B2AE35u;
+    return x ^ (x >> 16);
+}
+
+void putHeader(std::vector<std::uint8_t>& out) {
+    for (char c : kMagic) out.push_back(static_cast<std::uint8_t>(c));
+    out.push_back(kVersion);
+}
+
+// ============================
+//  Disque
+// ============================
+// Contenu (ou entrées, pour un dossier) sur le disque, pas seulement remis
+// au système. Sans fsync (hors Unix) : rien de plus que le flush.
+bool syncPath(const std::filesystem::path& path) {
+#if TD_HAS_FSYNC
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    const bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#else
+    (void)path;
+    return true;
+#endif
+}
+
+// Le dossier du journal : rend durables une création ou un renommage
+bool syncParent(const std::string& path) {
+    const std::filesystem::path dir = std::filesystem::path(path).parent_path();
+    return syncPath(dir.empty() ? std::filesystem::path(".") : dir);
+}
+
+} // namespace
+
+// ============================
+//  Enregistrements
+// ============================
+void encodeScore(const ScoreEntry& e, std::vector<std::uint8_t>& out) {
+    const std::size_t frame = out.size();
+    out.resize(frame + kFrameSize);
+    putVarint(out, e.score);
+    putVarint(out, e.waves);
+    putVarint(out, e.seed);
+    putZigzag(out, e.time);
+    putString(out, e.difficulty);
+    putString(out, e.name);
+    const std::size_t size = out.size() - frame - kFrameSize;
+    putU32(&out[frame], static_cast<std::uint32_t>(size));
+    putU32(&out[frame + 4], fnv1a(&out[frame + kFrameSize], size));
+}
+
+bool decodeScore(const std::uint8_t*& p, const std::uint8_t* end, ScoreEntry& e) {
+    if (static_cast<std::size_t>(end - p) < kFrameSize) return false;
+    const std::uint32_t size = getU32(p);
+    if (size > static_cast<std::size_t>(end - p) - kFrameSize) return false;
+    const std::uint8_t* payload = p + kFrameSize;
+    if (fnv1a(payload, size) != getU32(p + 4)) return false;
+
+    ByteReader r{payload, payload + size};
+    e.score      = r.varint();
+    e.waves      = static_cast<std::uint32_t>(r.varint());
+    e.seed       = r.varint();
+    e.time       = r.zigzag();
+    e.difficulty = r.string();
+    e.name       = r.string();
+    if (!r.ok || r.p != r.end) return false;
+    p = payload + size;
+    return true;
+}
+
+// ============================
+//  ScoreIndex
+// ============================
+void ScoreIndex::clear() {
+    nodes_.clear();
+    roots_.clear();
+}
+
+void ScoreIndex::split(std::uint32_t t, std::uint32_t key, std::uint32_t& l, std::uint32_t& r) {
+    if (t == kNil) { l = r = kNil; return; }
+    if (before(t, key)) {
+        split(nodes_[t].right, key, nodes_[t].right, r);
+        l = t;
+    } else {
+        split(nodes_[t].left, key, l, nodes_[t].left);
+        r = t;
+    }
+    nodes_[t].size = 1 + size(nodes_[t].left) + size(nodes_[t].right);
+}
+
+void ScoreIndex::insert(std::uint32_t id, std::uint16_t difficulty, std::uint64_t score) {
+    if (nodes_.size() <= id) nodes_.resize(static_cast<std::size_t>(id) + 1);
+    if (roots_.size() <= difficulty) roots_.resize(static_cast<std::size_t>(difficulty) + 1, kNil);
+    Node& n = nodes_[id];
+    n = Node{};
+    n.score = score;
+    n.prio  = priorityOf(id);
+
+    // Une seule descente : jusqu'au premier nœud de priorité plus faible,
+    // dont le sous-arbre est coupé en deux sous le nouveau nœud
+    std::uint32_t* link = &roots_[difficulty];
+    while (*link != kNil && nodes_[*link].prio > n.prio) {
+        Node& t = nodes_[*link];
+        ++t.size;
+        link = before(id, *link) ? &t.left : &t.right;
+    }
+    split(*link, id, n.left, n.right);
+    n.size = 1 + size(n.left) + size(n.right);
+    *link  = id;
+}
+
+std::size_t ScoreIndex::rank(std::uint16_t difficulty, std::uint64_t score) const {
+    std::size_t better = 0;
+    std::uint32_t t = difficulty < roots_.size() ? roots_[difficulty] : kNil;
+    while (t != kNil) {
+        if (nodes_[t].score > score) {
+            better += size(nodes_[t].left) + 1;
+            t = nodes_[t].right;
+        } else {
+            t = nodes_[t].left;
+        }
+    }
+    return better + 1;
+}
+
+std::size_t ScoreIndex::count(std::uint16_t difficulty) const {
+    return difficulty < roots_.size() ? size(roots_[difficulty]) : 0;
+}
+
+void ScoreIndex::top(std::uint16_t difficulty, std::size_t n, std::vector<std::uint32_t>& out) const {
+    out.clear();
+    // Parcours infixe, arrêté au n-ième
+    std::vector<std::uint32_t> stack;
+    std::uint32_t t = difficulty < roots_.size() ? roots_[difficulty] : kNil;
+    while (out.size() < n && (t != kNil || !stack.empty())) {
+        while (t != kNil) {
+            stack.push_back(t);
+            t = nodes_[t].left;
+        }
+        t = stack.back();
+        stack.pop_back();
+        out.push_back(t);
+        t = nodes_[t].right;
+    }
+}
+
+// ============================
+//  Leaderboard
+// ============================
+int Leaderboard::difficultyId(const std::string& name) const {
+    const auto it = std::find(difficulties_.begin(), difficulties_.end(), name);
+    return it == difficulties_.end() ? -1 : static_cast<int>(it - difficulties_.begin());
+}
+
+void Leaderboard::add(ScoreEntry e) {
+    int d = difficultyId(e.difficulty);
+    if (d < 0) {
+        d = static_cast<int>(difficulties_.size());
+        difficulties_.push_back(e.difficulty);
+    }
+    index_.insert(static_cast<std::uint32_t>(entries_.size()), static_cast<std::uint16_t>(d), e.score);
+    entries_.push_back(std::move(e));
+}
+
+bool Leaderboard::open(const std::string& path) {
+    out_.close();
+    path_ = path;
+    entries_.clear();
+    difficulties_.clear();
+    index_.clear();
+
+    std::vector<std::uint8_t> bytes;
+    if (std::ifstream in{path, std::ios::binary | std::ios::ate}) {
+        bytes.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::size_t good     = 0;     // octets valides en tête
+    std::size_t salvaged = 0;     // enregistrements relus au-delà d'une zone abîmée
+    if (bytes.size() >= kHeaderSize) {
+        if (std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) != 0 || bytes[sizeof(kMagic)] != kVersion) {
+            // Pas à nous, ou d'une autre version : on n'y touche pas
+            std::cerr << "[Leaderboard] " << path << ": not a score log or unknown version\n";
+            return false;
+        }
+        const std::uint8_t* p   = bytes.data() + kHeaderSize;
+        const std::uint8_t* end = bytes.data() + bytes.size();
+        index_.reserve(bytes.size() / 24);
+        ScoreEntry e;
+        while (decodeScore(p, end, e)) add(std::move(e));
+        good = static_cast<std::size_t>(p - bytes.data());
+
+        // Fin interrompue si plus rien ne se relit derrière ; sinon la zone
+        // abîmée est au milieu et les enregistrements suivants sont gardés
+        for (const std::uint8_t* q = p + 1; q < end;) {
+            if (static_cast<std::size_t>(end - q) >= kFrameSize && getU32(q) <= kMaxSalvagedRecord &&
+                decodeScore(q, end, e)) {
+                add(std::move(e));
+                ++salvaged;
+            } else {
+                ++q;
+            }
+        }
+    }
+
+    std::error_code ec;
+    if (good == 0) {
+        // Nouveau journal (ou en-tête jamais fini d'écrire)
+        {
+            std::ofstream create(path, std::ios::binary | std::ios::trunc);
+            buf_.clear();
+            putHeader(buf_);
+            create.write(reinterpret_cast<const char*>(buf_.data()), static_cast<std::streamsize>(buf_.size()));
+            if (!create) {
+                std::cerr << "[Leaderboard] Failed to create " << path << "\n";
+                return false;
+            }
+        }
+        if (!syncPath(path) || !syncParent(path)) {
+            std::cerr << "[Leaderboard] Failed to sync " << path << "\n";
+            return false;
+        }
+    } else if (salvaged > 0) {
+        // Corruption au milieu : l'original reste à côté, le journal est
+        // réécrit avec tout ce qui s'est relu
+        const std::string bad = path + ".bad";
+        std::cerr << "[Leaderboard] " << path << ": damaged record at byte " << good << ", kept "
+                  << salvaged << " records after it (original saved as " << bad << ")\n";
+        std::filesystem::copy_file(path, bad, std::filesystem::copy_options::overwrite_existing, ec);
+        if (ec) {
+            std::cerr << "[Leaderboard] Failed to save " << bad << ": " << ec.message() << "\n";
+            return false;
+        }
+        if (!writeLog(entries_)) return false;
+    } else if (good < bytes.size()) {
+        // Dernier enregistrement interrompu : coupé, les suivants repartent de là
+        std::cerr << "[Leaderboard] " << path << ": dropped " << bytes.size() - good
+                  << " bytes of incomplete record\n";
+        std::filesystem::resize_file(path, good, ec);
+        if (ec || !syncPath(path)) {
+            std::cerr << "[Leaderboard] Failed to truncate " << path << ": " << ec.message() << "\n";
+            return false;
+        }
+    }
+
+    out_.open(path, std::ios::binary | std::ios::app);
+    if (!out_) {
+        std::cerr << "[Leaderboard] Failed to open " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool Leaderboard::append() {
+    out_.write(reinterpret_cast<const char*>(buf_.data()), static_cast<std::streamsize>(buf_.size()));
+    out_.flush();
+    buf_.clear();
+    if (!out_ || !syncPath(path_)) {
+        std::cerr << "[Leaderboard] Failed to write " << path_ << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool Leaderboard::submit(const ScoreEntry& e) {
+    if (!out_.is_open()) return false;
+    buf_.clear();
+    encodeScore(e, buf_);
+    if (!append()) return false;
+    add(e);
+    compactIfNeeded();
+    return true;
+}
+
+bool Leaderboard::submit(const std::vector<ScoreEntry>& entries) {
+    if (!out_.is_open()) return false;
+    buf_.clear();
+    for (const ScoreEntry& e : entries) encodeScore(e, buf_);
+    if (!append()) return false;
+    for (const ScoreEntry& e : entries) add(e);
+    compactIfNeeded();
+    return true;
+}
+
+void Leaderboard::compactIfNeeded() {
+    const std::size_t k = kept();
+    if (entries_.size() - k >= std::max(kMinCompactRecords, k)) compact();
+}
+
+std::size_t Leaderboard::kept() const {
+    if (keep_ == 0) return entries_.size();
+    std::size_t n = 0;
+    for (std::size_t d = 0; d < difficulties_.size(); ++d) {
+        n += std::min(keep_, index_.count(static_cast<std::uint16_t>(d)));
+    }
+    return n;
+}
+
+bool Leaderboard::writeLog(const std::vector<ScoreEntry>& entries) {
+    const std::string tmp = path_ + ".tmp";
+    buf_.clear();
+    putHeader(buf_);
+    for (const ScoreEntry& e : entries) encodeScore(e, buf_);
+    {
+        std::ofstream os(tmp, std::ios::binary | std::ios::trunc);
+        os.write(reinterpret_cast<const char*>(buf_.data()), static_cast<std::streamsize>(buf_.size()));
+        buf_.clear();
+        if (!os) {
+            std::cerr << "[Leaderboard] Failed to write " << tmp << "\n";
+            return false;
+        }
+    }
+    // Contenu sur le disque avant le renommage, sinon une coupure peut
+    // laisser le nouveau nom sur un fichier vide
+    if (!syncPath(tmp)) {
+        std::cerr << "[Leaderboard] Failed to sync " << tmp << "\n";
+        return false;
+    }
+    out_.close();
+    std::error_code ec;
+    std::filesystem::rename(tmp, path_, ec);
+    if (ec) {
+        std::cerr << "[Leaderboard] Failed to replace " << path_ << ": " << ec.message() << "\n";
+        return false;
+    }
+    if (!syncParent(path_)) {
+        std::cerr << "[Leaderboard] Failed to sync the folder of " << path_ << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool Leaderboard::compact() {
+    if (!out_.is_open()) return false;
+    // Scores gardés, difficulté par difficulté, dans l'ordre du classement :
+    // les ex aequo gardent leur ordre d'arrivée
+    std::vector<ScoreEntry>    kept;
+    std::vector<std::uint32_t> ids;
+    kept.reserve(this->kept());
+    for (std::size_t d = 0; d < difficulties_.size(); ++d) {
+        const auto id = static_cast<std::uint16_t>(d);
+        index_.top(id, keep_ ? keep_ : index_.count(id), ids);
+        for (const std::uint32_t i : ids) kept.push_back(std::move(entries_[i]));
+    }
+    // entries_ vidé en partie : en cas d'échec, relu depuis le journal
+    if (!writeLog(kept)) return open(path_);
+
+    entries_.clear();
+    difficulties_.clear();
+    index_.clear();
+    index_.reserve(kept.size());
+    for (ScoreEntry& e : kept) add(std::move(e));
+    out_.open(path_, std::ios::binary | std::ios::app);
+    return static_cast<bool>(out_);
+}
+
+std::vector<const ScoreEntry*> Leaderboard::top(const std::string& difficulty, std::size_t n) const {
+    std::vector<const ScoreEntry*> out;
+    const int d = difficultyId(difficulty);
+    if (d < 0) return out;
+    std::vector<std::uint32_t> ids;
+    index_.top(static_cast<std::uint16_t>(d), n, ids);
+    for (const std::uint32_t i : ids) out.push_back(&entries_[i]);
+    return out;
+}
+
+std::size_t Leaderboard::rank(const std::string& difficulty, std::uint64_t score) const {
+    const int d = difficultyId(difficulty);
+    return d < 0 ? 1 : index_.rank(static_cast<std::uint16_t>(d), score);
+}
+
+std::size_t Leaderboard::count(const std::string& difficulty) const {
+    const int d = difficultyId(difficulty);
+    return d < 0 ? 0 : index_.count(static_cast<std::uint16_t>(d));
+}
+
+// ============================
+//  Migration
+// ============================
+int migrateScoresJson(const std::string& jsonPath, Leaderboard& board) {
+    JsonValue root;
+    std::string error;
+    if (!loadJsonFile(jsonPath, root, &error)) {
+        std::cerr << "[Leaderboard] " << jsonPath << ": " << error << "\n";
+        return -1;
+    }
+    const JsonValue* list = root.find("scores");
+    if (!list || !list->isArray()) {
+        std::cerr << "[Leaderboard] " << jsonPath << ": no \"scores\" array\n";
+        return -1;
+    }
+    std::vector<ScoreEntry> entries;
+    for (const JsonValue& s : list->items()) {
+        const JsonValue* difficulty = s.find("difficulty");
+        if (!difficulty || !difficulty->isString()) continue;
+        ScoreEntry e;
+        const JsonValue* name = s.find("name");
+        e.name       = name ? name->asString() : std::string();
+        e.difficulty = difficulty->asString();
+        e.score      = static_cast<std::uint64_t>(std::max(0.0, s.number("score", 0.0)));
+        e.waves      = static_cast<std::uint32_t>(std::max(0.0, s.number("waves", 0.0)));
+        e.seed       = static_cast<std::uint64_t>(std::max(0.0, s.number("seed", 0.0)));
+        e.time       = static_cast<std::int64_t>(s.number("time", 0.0));
+        entries.push_back(std::move(e));
+    }
+    if (!entries.empty() && !board.submit(entries)) return -1;
+    return static_cast<int>(entries.size());
+}
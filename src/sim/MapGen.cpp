@@ -0,0 +1,298 @@
+#include "sim/MapGen.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+#include "sim/Profiler.hpp"
+#include "sim/Rng.hpp"
+
+namespace {
+// À incrémenter si le tirage change : les cartes en cache deviennent caduques
+constexpr std::uint32_t kGenVersion   = 1;
+constexpr std::uint64_t kSeedSalt     = 0x6D61707365656421ull; // flux distinct de la simulation
+constexpr char          kMagic[4]     = {'T', 'D', 'M', 'P'};
+constexpr std::uint8_t  kFileVersion  = 1;
+constexpr std::uint32_t kUnvisited    = 0xFFFFFFFFu;
+constexpr std::uint32_t kSpawnPending = 0xFFFFFFFEu; // spawn pas encore atteint
+
+struct Fnv1a {
+    std::uint64_t h = 14695981039346656037ull;
+    void bytes(const std::uint8_t* p, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) { h ^= p[i]; h *= 1099511628211ull; }
+    }
+    void u32(std::uint32_t v) {
+        for (int i = 0; i < 4; ++i) { const auto b = static_cast<std::uint8_t>(v >> (8 * i)); bytes(&b, 1); }
+    }
+};
+
+void put16(std::vector<std::uint8_t>& out, std::uint32_t v) {
+    out.push_back(static_cast<std::uint8_t>(v));
+    out.push_back(static_cast<std::uint8_t>(v >> 8));
+}
+void put32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+    put16(out, v & 0xFFFF);
+    put16(out, v >> 16);
+}
+void put64(std::vector<std::uint8_t>& out, std::uint64_t v) {
+    put32(out, static_cast<std::uint32_t>(v));
+    put32(out, static_cast<std::uint32_t>(v >> 32));
+}
+
+// Lecture bornée : tout dépassement rend le fichier invalide
+struct Reader {
+    const std::uint8_t* p;
+    const std::uint8_t* end;
+    bool ok = true;
+
+    std::uint64_t get(int bytes) {
+        if (end - p < bytes) { ok = false; return 0; }
+        std::uint64_t v = 0;
+        for (int i = 0; i < bytes; ++i) v |= std::uint64_t{p[i]} << (8 * i);
+        p += bytes;
+        return v;
+    }
+};
+
+Cell borderCell(Rng& rng, int w, int h, int side) {
+    switch (side) {
+        case 0:  return Cell{w - 1, rng.range(1, h - 2)}; // droite
+        case 1:  return Cell{rng.range(1, w - 2), 0};     // haut
+        default: return Cell{rng.range(1, w - 2), h - 1}; // bas
+    }
+}
+
+GridMap fallbackMap(const MapGenParams& params, std::uint64_t seed) {
+    Rng rng(seed ^ kSeedSalt, 0xFA11BAC4ull);
+    GridMap m(params.width, params.height);
+    const int h = params.height;
+    for (int i = 0, n = rng.range(params.minSpawns, params.maxSpawns); i < n; ++i) m.spawns.push_back(Cell{0, rng.range(1, h - 2)});
+    for (int i = 0, n = rng.range(params.minExits, params.maxExits); i < n; ++i)   m.exits.push_back(Cell{params.width - 1, rng.range(1, h - 2)});
+    return m;
+}
+} // namespace
+
+std::uint32_t MapGenParams::hash() const {
+    Fnv1a f;
+    for (const int v : {static_cast<int>(kGenVersion), width, height, minSpawns, maxSpawns, minExits, maxExits,
+                        obstaclePercent, pathLength(), maxAttempts}) {
+        f.u32(static_cast<std::uint32_t>(v));
+    }
+    return static_cast<std::uint32_t>(f.h ^ (f.h >> 32));
+}
+
+GridMap generateCandidate(const MapGenParams& params, std::uint64_t seed, std::uint32_t attempt) {
+    const int w = std::max(params.width, 3);
+    const int h = std::max(params.height, 3);
+    Rng rng(seed ^ kSeedSalt, attempt);
+    GridMap m(w, h);
+
+    const int spawns = rng.range(params.minSpawns, params.maxSpawns);
+    const int exits  = rng.range(params.minExits, params.maxExits);
+    for (int i = 0; i < spawns; ++i) m.spawns.push_back(Cell{0, rng.range(1, h - 2)});
+    for (int i = 0; i < exits; ++i)  m.exits.push_back(borderCell(rng, w, h, static_cast<int>(rng.below(3))));
+
+    // Un tirage 32 bits par case comparé à un seuil (pas de modulo)
+    const auto threshold = static_cast<std::uint32_t>(
+        (std::uint64_t{0x100000000ull} * static_cast<std::uint64_t>(std::clamp(params.obstaclePercent, 0, 100))) / 100);
+    for (auto& b : m.blocked) b = rng.next() < threshold ? 1 : 0;
+    for (const Cell& c : m.spawns) m.blocked[m.index(c)] = 0;
+    for (const Cell& c : m.exits)  m.blocked[m.index(c)] = 0;
+    return m;
+}
+
+int validateMap(const GridMap& map, int minPathLength, MapCheckScratch& scratch) {
+    if (map.spawns.empty() || map.exits.empty()) return -1;
+    auto& dist  = scratch.dist;
+    auto& queue = scratch.queue;
+    dist.assign(map.cellCount(), kUnvisited);
+    queue.resize(map.cellCount());
+
+    std::size_t pending = 0;
+    for (const Cell& s : map.spawns) {
+        std::uint32_t& d = dist[map.index(s)];
+        if (d == kUnvisited) { d = kSpawnPending; ++pending; }
+    }
+
+    // Un spawn atteint l'est par son plus court chemin (ordre du BFS) : le
+    // premier atteint donne la longueur la plus courte de la carte
+    int shortest = -1;
+    auto reach = [&](std::uint32_t idx, std::uint32_t d) {
+        if (dist[idx] == kSpawnPending) {
+            if (static_cast<int>(d) < minPathLength) return false;
+            if (shortest < 0) shortest = static_cast<int>(d);
+            --pending;
+        }
+        dist[idx] = d;
+        return true;
+    };
+
+    std::size_t head = 0, tail = 0;
+    for (const Cell& e : map.exits) {
+        const std::uint32_t idx = map.index(e);
+        if (dist[idx] != kUnvisited && dist[idx] != kSpawnPending) continue; // sortie en double
+        if (!reach(idx, 0)) return -1;
+        queue[tail++] = idx;
+    }
+    const int w = map.width;
+    while (pending > 0 && head < tail) {
+        const std::uint32_t idx = queue[head++];
+        const std::uint32_t d   = dist[idx] + 1;
+        const int x = static_cast<int>(idx % static_cast<std::uint32_t>(w));
+        const int y = static_cast<int>(idx / static_cast<std::uint32_t>(w));
+        const int nx[4] = {x + 1, x - 1, x, x};
+        const int ny[4] = {y, y, y + 1, y - 1};
+        for (int k = 0; k < 4; ++k) {
+            if (!map.passable(nx[k], ny[k])) continue;
+            const std::uint32_t n = map.index(nx[k], ny[k]);
+            if (dist[n] != kUnvisited && dist[n] != kSpawnPending) continue;
+            if (!reach(n, d)) return -1;
+            queue[tail++] = n;
+        }
+    }
+    return pending == 0 ? shortest : -1;
+}
+
+bool generateMap(const MapGenParams& params, std::uint64_t seed, GridMap& out, MapGenStats* stats, unsigned threads) {
+    PROFILE_SCOPE("generateMap");
+    const auto attempts = static_cast<std::uint32_t>(std::max(params.maxAttempts, 0));
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::max(1u, std::min(threads, attempts));
+
+    // Chaque worker prend des indices croissants : après son premier candidat
+    // valide il s'arrête, et personne ne tire au-delà du meilleur connu
+    std::atomic<std::uint32_t> next{0}, best{kUnvisited}, candidates{0}, rejected{0};
+    std::vector<GridMap>       found(threads);
+    std::vector<std::uint32_t> foundAt(threads, kUnvisited);
+    auto worker = [&](unsigned t) {
+        MapCheckScratch scratch;
+        for (;;) {
+            const std::uint32_t i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= attempts || i > best.load(std::memory_order_relaxed)) return;
+            GridMap m = generateCandidate(params, seed, i);
+            candidates.fetch_add(1, std::memory_order_relaxed);
+            if (validateMap(m, params.pathLength(), scratch) < 0) {
+                rejected.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            std::uint32_t b = best.load(std::memory_order_relaxed);
+            while (i < b && !best.compare_exchange_weak(b, i, std::memory_order_relaxed)) {}
+            found[t]   = std::move(m);
+            foundAt[t] = i;
+            return;
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto& th : pool) th.join();
+
+    const auto winner = static_cast<std::size_t>(std::min_element(foundAt.begin(), foundAt.end()) - foundAt.begin());
+    const bool ok = foundAt[winner] != kUnvisited;
+    out = ok ? std::move(found[winner]) : fallbackMap(params, seed);
+    if (stats) {
+        stats->candidates = candidates.load();
+        stats->rejected   = rejected.load();
+        stats->attempt    = ok ? foundAt[winner] : attempts;
+    }
+    return ok;
+}
+
+// ---- Encodage
+void encodeMap(const GridMap& map, std::uint64_t seed, std::uint32_t paramsHash, std::vector<std::uint8_t>& out) {
+    out.clear();
+    for (const char c : kMagic) out.push_back(static_cast<std::uint8_t>(c));
+    out.push_back(kFileVersion);
+    put64(out, seed);
+    put32(out, paramsHash);
+    put16(out, static_cast<std::uint32_t>(map.width));
+    put16(out, static_cast<std::uint32_t>(map.height));
+    for (const auto* cells : {&map.spawns, &map.exits}) {
+        out.push_back(static_cast<std::uint8_t>(cells->size()));
+        for (const Cell& c : *cells) {
+            put16(out, static_cast<std::uint32_t>(c.x));
+            put16(out, static_cast<std::uint32_t>(c.y));
+        }
+    }
+    const std::size_t bits = out.size();
+    out.resize(bits + (map.cellCount() + 7) / 8, 0);
+    for (std::size_t i = 0; i < map.cellCount(); ++i) {
+        if (map.blocked[i]) out[bits + i / 8] |= static_cast<std::uint8_t>(1u << (i % 8));
+    }
+    Fnv1a f;
+    f.bytes(out.data(), out.size());
+    put64(out, f.h);
+}
+
+bool decodeMap(const std::uint8_t* data, std::size_t size, std::uint64_t seed, std::uint32_t paramsHash, GridMap& out) {
+    if (size < 8 + sizeof(kMagic) || !std::equal(std::begin(kMagic), std::end(kMagic), data)) return false;
+    Fnv1a f;
+    f.bytes(data, size - 8);
+    Reader tail{data + size - 8, data + size};
+    if (tail.get(8) != f.h) return false;
+
+    Reader r{data + sizeof(kMagic), data + size - 8};
+    if (r.get(1) != kFileVersion || r.get(8) != seed || r.get(4) != paramsHash) return false;
+    const int w = static_cast<int>(r.get(2));
+    const int h = static_cast<int>(r.get(2));
+    if (!r.ok || w <= 0 || h <= 0) return false;
+    GridMap m(w, h);
+    for (auto* cells : {&m.spawns, &m.exits}) {
+        const auto n = r.get(1);
+        for (std::uint64_t i = 0; i < n; ++i) {
+            const Cell c{static_cast<int>(r.get(2)), static_cast<int>(r.get(2))};
+            if (!m.inBounds(c.x, c.y)) return false;
+            cells->push_back(c);
+        }
+    }
+    if (!r.ok || static_cast<std::size_t>(r.end - r.p) != (m.cellCount() + 7) / 8) return false;
+    for (std::size_t i = 0; i < m.cellCount(); ++i) m.blocked[i] = (r.p[i / 8] >> (i % 8)) & 1u;
+    out = std::move(m);
+    return true;
+}
+
+// ---- Cache
+std::string MapCache::pathFor(const MapGenParams& params, std::uint64_t seed) const {
+    char name[48];
+    std::snprintf(name, sizeof(name), "%016llx-%08x.tdmap", static_cast<unsigned long long>(seed),
+                  static_cast<unsigned>(params.hash()));
+    return (std::filesystem::path(dir_) / name).string();
+}
+
+bool MapCache::load(const MapGenParams& params, std::uint64_t seed, GridMap& out) const {
+    std::ifstream is(pathFor(params, seed), std::ios::binary);
+    if (!is) return false;
+    const std::vector<std::uint8_t> data{std::istreambuf_iterator<char>(is), {}};
+    return decodeMap(data.data(), data.size(), seed, params.hash(), out);
+}
+
+bool MapCache::store(const MapGenParams& params, std::uint64_t seed, const GridMap& map) const {
+    std::error_code ec;
+    std::filesystem::create_directories(dir_, ec);
+    std::vector<std::uint8_t> data;
+    encodeMap(map, seed, params.hash(), data);
+
+    const std::string path = pathFor(params, seed);
+    const std::string tmp  = path + ".tmp";
+    {
+        std::ofstream os(tmp, std::ios::binary | std::ios::trunc);
+        os.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!os) return false;
+    }
+    std::filesystem::rename(tmp, path, ec);
+    return !ec;
+}
+
+GridMap MapCache::loadOrGenerate(const MapGenParams& params, std::uint64_t seed, unsigned threads, bool* hit) const {
+    GridMap m;
+    const bool cached = load(params, seed, m);
+    if (hit) *hit = cached;
+    if (cached) return m;
+    // Carte de repli : pas mise en cache (rien ne la distinguerait d'une vraie)
+    if (generateMap(params, seed, m, nullptr, threads)) store(params, seed, m);
+    return m;
+}
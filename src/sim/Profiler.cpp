@@ -0,0 +1,307 @@
+#include "sim/Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+std::atomic<bool> Profiler::enabled_{false};
+
+namespace {
+// Case du tampon : champs atomiques (relaxed = simples mov) pour que la
+// relecture depuis un autre thread reste définie pendant que le thread écrit
+struct Slot {
+    std::atomic<const char*>   name{nullptr};
+    std::atomic<std::int64_t>  start{0};
+    std::atomic<std::int64_t>  dur{0};
+    std::atomic<std::uint32_t> depth{0};
+};
+
+// Tampon d'un thread : un seul écrivain. started avance avant l'écriture
+// d'une case, written après ; un lecteur jette les cases réécrites pendant
+// sa copie (indice < started - kRingSize).
+struct ThreadRing {
+    std::uint32_t              index = 0;
+    std::atomic<std::uint64_t> started{0};
+    std::atomic<std::uint64_t> written{0};
+    std::unique_ptr<Slot[]>    slots{new Slot[Profiler::kRingSize]};
+};
+
+struct Registry {
+    std::mutex                mutex;
+    std::vector<ThreadRing*>  rings;   // threads vivants ayant enregistré
+    std::vector<std::string>  names;   // par index, threads terminés compris
+    std::deque<ProfileEvent>  retired; // derniers événements des threads terminés (kRingSize au plus)
+    std::atomic<std::int64_t> clearedNs{0};
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+// Origine des temps : premier appel (avant toute portée)
+std::chrono::steady_clock::time_point epoch() {
+    static const auto t0 = std::chrono::steady_clock::now();
+    return t0;
+}
+
+// Propriétaire du tampon du thread : créé au premier événement enregistré
+// (un thread nommé mais jamais mesuré ne coûte que son nom), rendu à la
+// sortie du thread après avoir versé ses événements dans retired
+struct ThreadOwner {
+    std::unique_ptr<ThreadRing> ring;
+    std::string                 name;
+    ~ThreadOwner();
+};
+
+thread_local ThreadRing*   tlRing    = nullptr; // chemin rapide, sans garde d'initialisation
+thread_local std::uint32_t tlDepth   = 0;
+thread_local bool          tlExiting = false; // tlOwner détruit : plus rien n'est enregistré
+thread_local ThreadOwner   tlOwner;
+
+ThreadOwner::~ThreadOwner() {
+    // Une portée fermée plus tard par un autre destructeur thread_local
+    // recréerait sinon un tampon rattaché à ce propriétaire détruit
+    tlExiting = true;
+    if (!ring) return;
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    // Seul écrivain : plus personne ne touche au tampon
+    const std::uint64_t end = ring->written.load(std::memory_order_relaxed);
+    for (std::uint64_t i = end > Profiler::kRingSize ? end - Profiler::kRingSize : 0; i < end; ++i) {
+        const Slot& s = ring->slots[i % Profiler::kRingSize];
+        ProfileEvent e;
+        e.name    = s.name.load(std::memory_order_relaxed);
+        e.startNs = s.start.load(std::memory_order_relaxed);
+        e.durNs   = s.dur.load(std::memory_order_relaxed);
+        e.depth   = s.depth.load(std::memory_order_relaxed);
+        e.thread  = ring->index;
+        r.retired.push_back(e);
+    }
+    while (r.retired.size() > Profiler::kRingSize) r.retired.pop_front();
+    r.rings.erase(std::find(r.rings.begin(), r.rings.end(), ring.get()));
+    tlRing = nullptr;
+    ring.reset();
+}
+
+// nullptr une fois le thread en sortie : l'événement est perdu
+ThreadRing* threadRing() {
+    if (!tlRing && !tlExiting) {
+        Registry& r = registry();
+        auto ring = std::make_unique<ThreadRing>();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        ring->index = static_cast<std::uint32_t>(r.names.size());
+        r.names.push_back(tlOwner.name);
+        r.rings.push_back(ring.get());
+        tlRing       = ring.get();
+        tlOwner.ring = std::move(ring);
+    }
+    return tlRing;
+}
+
+void writeJsonString(std::ostream& os, std::string_view s) {
+    os << '"';
+    for (const char c : s) {
+        if (c == '"' || c == '\\') os << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20) os << ' ';
+        else os << c;
+    }
+    os << '"';
+}
+} // namespace
+
+std::int64_t Profiler::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch()).count();
+}
+
+std::int64_t Profiler::enter() {
+    ++tlDepth;
+    return nowNs();
+}
+
+void Profiler::leave(const char* name, std::int64_t startNs) {
+    const std::int64_t end = nowNs();
+    --tlDepth;
+    ThreadRing* const ring = threadRing();
+    if (!ring) return;
+    const std::uint64_t w = ring->written.load(std::memory_order_relaxed);
+    ring->started.store(w + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Slot& s = ring->slots[w % kRingSize];
+    s.name.store(name, std::memory_order_relaxed);
+    s.start.store(startNs, std::memory_order_relaxed);
+    s.dur.store(end - startNs, std::memory_order_relaxed);
+    s.depth.store(tlDepth, std::memory_order_relaxed);
+    ring->written.store(w + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    if (tlExiting) return;
+    tlOwner.name = name;
+    if (!tlRing) return; // repris à la création du tampon
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.names[tlRing->index] = name;
+}
+
+void Profiler::clear() {
+    registry().clearedNs.store(nowNs(), std::memory_order_relaxed);
+}
+
+std::vector<ProfileEvent> Profiler::collect(std::int64_t sinceNs) {
+    Registry& r = registry();
+    sinceNs = std::max(sinceNs, r.clearedNs.load(std::memory_order_relaxed));
+
+    std::vector<ProfileEvent> out;
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const ProfileEvent& e : r.retired) {
+        if (e.startNs >= sinceNs) out.push_back(e);
+    }
+    for (const ThreadRing* ring : r.rings) {
+        const std::uint64_t end   = ring->written.load(std::memory_order_acquire);
+        const std::uint64_t begin = end > kRingSize ? end - kRingSize : 0;
+        const std::size_t   first = out.size();
+        for (std::uint64_t i = begin; i < end; ++i) {
+            const Slot& s = ring->slots[i % kRingSize];
+            ProfileEvent e;
+            e.name    = s.name.load(std::memory_order_relaxed);
+            e.startNs = s.start.load(std::memory_order_relaxed);
+            e.durNs   = s.dur.load(std::memory_order_relaxed);
+            e.depth   = s.depth.load(std::memory_order_relaxed);
+            e.thread  = ring->index;
+            out.push_back(e);
+        }
+        // Cases réécrites par le thread pendant la copie : on les jette
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t started = ring->started.load(std::memory_order_relaxed);
+        const std::uint64_t valid   = started > kRingSize ? started - kRingSize : 0;
+        if (valid > begin) {
+            const auto drop = static_cast<std::ptrdiff_t>(std::min(valid, end) - begin);
+            out.erase(out.begin() + static_cast<std::ptrdiff_t>(first), out.begin() + static_cast<std::ptrdiff_t>(first) + drop);
+        }
+        out.erase(std::remove_if(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(),
+                                 [sinceNs](const ProfileEvent& e) { return e.startNs < sinceNs; }),
+                  out.end());
+    }
+    // Parent avant enfant à début égal
+    std::sort(out.begin(), out.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+        if (a.startNs != b.startNs) return a.startNs < b.startNs;
+        return a.depth < b.depth;
+    });
+    return out;
+}
+
+std::vector<ScopeStat> Profiler::topScopes(const std::vector<ProfileEvent>& events, std::size_t n) {
+    std::vector<ScopeStat>                       stats;
+    std::unordered_map<std::string_view, std::size_t> byName;
+
+    // Pile des portées ouvertes par thread : (stat, fin, profondeur)
+    struct Open {
+        std::size_t   stat;
+        std::int64_t  endNs;
+        std::uint32_t depth;
+    };
+    std::unordered_map<std::uint32_t, std::vector<Open>> open;
+
+    for (const ProfileEvent& e : events) {
+        const auto [it, added] = byName.try_emplace(e.name, stats.size());
+        if (added) stats.push_back(ScopeStat{e.name});
+        ScopeStat& st = stats[it->second];
+        const double ms = static_cast<double>(e.durNs) / 1e6;
+        st.totalMs += ms;
+        st.selfMs  += ms;
+        st.maxMs    = std::max(st.maxMs, ms);
+        ++st.calls;
+
+        // Le parent direct (ouvert, une profondeur au-dessus) perd ce temps
+        auto& stack = open[e.thread];
+        while (!stack.empty() && (stack.back().endNs <= e.startNs || stack.back().depth >= e.depth)) stack.pop_back();
+        if (!stack.empty() && stack.back().depth + 1 == e.depth) stats[stack.back().stat].selfMs -= ms;
+        stack.push_back(Open{it->second, e.startNs + e.durNs, e.depth});
+    }
+
+    std::sort(stats.begin(), stats.end(), [](const ScopeStat& a, const ScopeStat& b) {
+        return a.totalMs > b.totalMs;
+    });
+    if (stats.size() > n) stats.resize(n);
+    return stats;
+}
+
+void Profiler::writeChromeTrace(std::ostream& os, const std::vector<ProfileEvent>& events) {
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (std::uint32_t i = 0; i < r.names.size(); ++i) {
+            const std::string name = r.names[i].empty() ? "thread " + std::to_string(i) : r.names[i];
+            os << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+               << ",\"args\":{\"name\":";
+            writeJsonString(os, name);
+            os << "}}";
+            first = false;
+        }
+    }
+    // ts/dur en µs (précision ns gardée en décimales)
+    os << std::fixed << std::setprecision(3);
+    for (const ProfileEvent& e : events) {
+        os << (first ? "" : ",\n") << "{\"name\":";
+        writeJsonString(os, e.name ? e.name : "?");
+        os << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread
+           << ",\"ts\":" << static_cast<double>(e.startNs) / 1e3
+           << ",\"dur\":" << static_cast<double>(e.durNs) / 1e3 << "}";
+        first = false;
+    }
+    os << "\n]}\n";
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+    std::ofstream os(path);
+    if (!os) {
+        std::cerr << "[Profiler] cannot write " << path << "\n";
+        return false;
+    }
+    const auto events = collect();
+    writeChromeTrace(os, events);
+    if (!os) {
+        std::cerr << "[Profiler] cannot write " << path << "\n";
+        return false;
+    }
+    std::cerr << "[Profiler] " << events.size() << " events written to " << path << "\n";
+    return true;
+}
+
+// ---- Temps de frame
+void FrameTimes::push(float ms) {
+    const std::size_t at = head_;
+    frames_[at] = ms;
+    head_ = (head_ + 1) % kHistory;
+    if (count_ < kHistory) ++count_;
+    p99_[at] = percentile(0.99f, kWindow);
+}
+
+float FrameTimes::average() const {
+    if (count_ == 0) return 0.f;
+    float sum = 0.f;
+    for (std::size_t i = 0; i < count_; ++i) sum += frame(i);
+    return sum / static_cast<float>(count_);
+}
+
+float FrameTimes::percentile(float p, std::size_t n) const {
+    n = std::min(n, count_);
+    if (n == 0) return 0.f;
+    for (std::size_t i = 0; i < n; ++i) scratch_[i] = frame(count_ - n + i);
+    // Rang le plus proche : plus petite valeur couvrant p des frames
+    const auto        k    = static_cast<std::size_t>(std::ceil(p * static_cast<float>(n)));
+    const std::size_t rank = k == 0 ? 0 : std::min(k - 1, n - 1);
+    std::nth_element(scratch_.begin(), scratch_.begin() + static_cast<std::ptrdiff_t>(rank), scratch_.begin() + static_cast<std::ptrdiff_t>(n));
+    return scratch_[rank];
+}
@@ -0,0 +1,217 @@
+#include "sim/Replay.hpp"
+
+#include <bit>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+#include "sim/Codec.hpp"
+
+namespace {
+
+constexpr char          kMagic[4]  = {'T', 'D', 'R', 'P'};
+constexpr std::uint8_t  kVersion   = 3; // 2 : carte tirée par MapGen, 3 : empreinte sans rng_
+constexpr std::uint8_t  kEndMarker = 0xFF;
+
+// ============================
+//  Écriture
+// ============================
+void putU8(std::vector<std::uint8_t>& out, std::uint8_t v) { out.push_back(v); }
+
+// Flottants recopiés bit à bit : la relecture redonne exactement la même config
+void putF32(std::vector<std::uint8_t>& out, float f) { putVarint(out, std::bit_cast<std::uint32_t>(f)); }
+
+void putSetup(std::vector<std::uint8_t>& out, const GameSetup& s) {
+    putU64(out, s.seed);
+    putVarint(out, s.difficulty.name.size());
+    out.insert(out.end(), s.difficulty.name.begin(), s.difficulty.name.end());
+    putF32(out, s.difficulty.hpMultiplier);
+    putF32(out, s.difficulty.speedMultiplier);
+    putF32(out, s.difficulty.rewardMultiplier);
+    putZigzag(out, s.difficulty.livesStart);
+    putU8(out, s.rules.forbidTotalBlock ? 1 : 0);
+    for (std::uint32_t m : s.rules.startMaterials) putVarint(out, m);
+    putZigzag(out, s.maxWaves);
+    putZigzag(out, s.mapWidth);
+    putZigzag(out, s.mapHeight);
+}
+
+void putHeader(std::vector<std::uint8_t>& out, const GameSetup& s) {
+    for (char c : kMagic) putU8(out, static_cast<std::uint8_t>(c));
+    putU8(out, kVersion);
+    putSetup(out, s);
+}
+
+void putCommand(std::vector<std::uint8_t>& out, const GameCommand& c, std::uint32_t& lastTick) {
+    putU8(out, static_cast<std::uint8_t>(c.type));
+    putVarint(out, c.tick - lastTick);
+    lastTick = c.tick;
+    putU8(out, c.arg);
+    putZigzag(out, c.x);
+    putZigzag(out, c.y);
+}
+
+void putFooter(std::vector<std::uint8_t>& out, std::uint32_t finalTick, std::uint64_t finalHash) {
+    putU8(out, kEndMarker);
+    putVarint(out, finalTick);
+    putU64(out, finalHash);
+}
+
+// ============================
+//  Lecture (bornée : un fichier tronqué échoue proprement)
+// ============================
+struct Reader : ByteReader {
+    float f32() { return std::bit_cast<float>(static_cast<std::uint32_t>(varint())); }
+};
+
+} // namespace
+
+void encodeReplay(const ReplayLog& log, std::vector<std::uint8_t>& out) {
+    out.clear();
+    putHeader(out, log.setup);
+    std::uint32_t last = 0;
+    for (const GameCommand& c : log.commands) putCommand(out, c, last);
+    putFooter(out, log.finalTick, log.finalHash);
+}
+
+bool decodeReplay(const std::uint8_t* data, std::size_t size, ReplayLog& out) {
+    if (size < sizeof(kMagic) + 1 || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) return false;
+    Reader r{{data + sizeof(kMagic), data + size}};
+    if (r.u8() != kVersion) return false;
+
+    ReplayLog log;
+    GameSetup& s = log.setup;
+    s.seed = r.u64();
+    const std::uint64_t nameLen = r.varint();
+    if (!r.ok || nameLen > static_cast<std::uint64_t>(r.end - r.p)) return false;
+    s.difficulty.name.assign(reinterpret_cast<const char*>(r.p), nameLen);
+    r.p += nameLen;
+    s.difficulty.hpMultiplier     = r.f32();
+    s.difficulty.speedMultiplier  = r.f32();
+    s.difficulty.rewardMultiplier = r.f32();
+    s.difficulty.livesStart       = static_cast<int>(r.zigzag());
+    s.rules.forbidTotalBlock      = r.u8() != 0;
+    for (std::uint32_t& m : s.rules.startMaterials) m = static_cast<std::uint32_t>(r.varint());
+    s.maxWaves   = static_cast<int>(r.zigzag());
+    s.mapWidth   = static_cast<int>(r.zigzag());
+    s.mapHeight  = static_cast<int>(r.zigzag());
+    s.autoPlayer = false; // les décisions du joueur sont dans le journal
+
+    std::uint32_t tick = 0;
+    for (;;) {
+        const std::uint8_t type = r.u8();
+        if (!r.ok) return false; // pas de pied : partie interrompue
+        if (type == kEndMarker) break;
+        if (type > static_cast<std::uint8_t>(CommandType::StartWave)) return false;
+
+        GameCommand c;
+        c.type = static_cast<CommandType>(type);
+        tick  += static_cast<std::uint32_t>(r.varint());
+        c.tick = tick;
+        c.arg  = r.u8();
+        c.x    = static_cast<std::int16_t>(r.zigzag());
+        c.y    = static_cast<std::int16_t>(r.zigzag());
+        if (!r.ok) return false;
+        log.commands.push_back(c);
+    }
+    log.finalTick = static_cast<std::uint32_t>(r.varint());
+    log.finalHash = r.u64();
+    if (!r.ok) return false;
+
+    out = std::move(log);
+    return true;
+}
+
+bool writeReplay(const std::string& path, const ReplayLog& log) {
+    std::vector<std::uint8_t> bytes;
+    encodeReplay(log, bytes);
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "[Replay] Failed to open " << path << "\n";
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(out);
+}
+
+bool readReplay(const std::string& path, ReplayLog& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "[Replay] Failed to open " << path << "\n";
+        return false;
+    }
+    const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (!decodeReplay(bytes.data(), bytes.size(), out)) {
+        std::cerr << "[Replay] " << path << ": invalid or truncated log\n";
+        return false;
+    }
+    return true;
+}
+
+// ============================
+//  ReplayRecorder
+// ============================
+bool ReplayRecorder::open(const std::string& path, const GameSetup& setup) {
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_) {
+        std::cerr << "[Replay] Failed to open " << path << "\n";
+        return false;
+    }
+    buf_.clear();
+    putHeader(buf_, setup);
+    lastTick_ = 0;
+    flush();
+    return true;
+}
+
+void ReplayRecorder::record(const GameCommand& cmd) {
+    if (!out_.is_open()) return;
+    putCommand(buf_, cmd, lastTick_);
+    if (buf_.size() >= kFlushBytes) flush();
+}
+
+bool ReplayRecorder::finish(std::uint32_t finalTick, std::uint64_t finalHash) {
+    if (!out_.is_open()) return false;
+    putFooter(buf_, finalTick, finalHash);
+    flush();
+    const bool ok = static_cast<bool>(out_);
+    out_.close();
+    return ok;
+}
+
+ReplayRecorder::~ReplayRecorder() {
+    // Sans finish() le journal reste lisible jusqu'à la dernière commande
+    // vidée, mais decodeReplay le refuse (pas d'empreinte à vérifier)
+    if (out_.is_open()) flush();
+}
+
+void ReplayRecorder::flush() {
+    out_.write(reinterpret_cast<const char*>(buf_.data()), static_cast<std::streamsize>(buf_.size()));
+    out_.flush();
+    buf_.clear();
+}
+
+// ============================
+//  Vérification
+// ============================
+ReplayCheck verifyReplay(const ReplayLog& log) {
+    GameSetup setup = log.setup;
+    setup.autoPlayer = false;
+    Game game(setup);
+
+    std::size_t next = 0;
+    while (game.tick() < log.finalTick && !game.over()) {
+        while (next < log.commands.size() && log.commands[next].tick == game.tick()) {
+            game.submit(log.commands[next++]);
+        }
+        game.step();
+    }
+
+    ReplayCheck check;
+    check.ticks        = game.tick();
+    check.expectedHash = log.finalHash;
+    check.actualHash   = game.stateHash();
+    check.ok = check.ticks == log.finalTick && check.actualHash == check.expectedHash
+            && next == log.commands.size();
+    return check;
+}
@@ -0,0 +1,147 @@
+#include "sim/ScoreProtocol.hpp"
+
+#include <algorithm>
+
+#include "sim/Codec.hpp"
+
+namespace {
+
+constexpr std::size_t kFrameHeader = 5; // u32 taille + u8 type
+
+// En-tête posé d'abord, taille complétée par endMessage
+std::size_t beginMessage(std::vector<std::uint8_t>& out, ScoreMessage type) {
+    const std::size_t at = out.size();
+    out.resize(at + 4);
+    out.push_back(static_cast<std::uint8_t>(type));
+    return at;
+}
+
+void endMessage(std::vector<std::uint8_t>& out, std::size_t at) {
+    putU32(&out[at], static_cast<std::uint32_t>(out.size() - at - 4));
+}
+
+struct Reader : ByteReader {
+    explicit Reader(const ScoreMessageView& m) : ByteReader{m.body, m.body + m.size} {}
+
+    // n scores, sans faire confiance à n pour réserver
+    bool scores(std::uint64_t n, std::vector<ScoreEntry>& out) {
+        out.clear();
+        for (std::uint64_t i = 0; ok && i < n; ++i) {
+            ScoreEntry e;
+            if (!decodeScore(p, end, e)) return ok = false;
+            out.push_back(std::move(e));
+        }
+        return ok;
+    }
+    bool done() const { return ok && p == end; }
+};
+
+} // namespace
+
+// ============================
+//  Encodage
+// ============================
+void encodeSubmit(const ScoreEntry* entries, std::size_t count, std::vector<std::uint8_t>& out) {
+    const std::size_t at = beginMessage(out, ScoreMessage::Submit);
+    putVarint(out, count);
+    for (std::size_t i = 0; i < count; ++i) encodeScore(entries[i], out);
+    endMessage(out, at);
+}
+
+void encodeSubmitAck(std::uint32_t accepted, std::vector<std::uint8_t>& out) {
+    const std::size_t at = beginMessage(out, ScoreMessage::SubmitAck);
+    putVarint(out, accepted);
+    endMessage(out, at);
+}
+
+void encodeTopQuery(const std::string& difficulty, std::uint32_t n, std::vector<std::uint8_t>& out) {
+    const std::size_t at = beginMessage(out, ScoreMessage::TopQuery);
+    putVarint(out, n);
+    putString(out, difficulty);
+    endMessage(out, at);
+}
+
+void encodeTopReply(const std::string& difficulty, std::uint64_t total,
+                    const std::vector<const ScoreEntry*>& top, std::vector<std::uint8_t>& out) {
+    const std::size_t at = beginMessage(out, ScoreMessage::TopReply);
+    putVarint(out, total);
+    putString(out, difficulty);
+    putVarint(out, top.size());
+    for (const ScoreEntry* e : top) encodeScore(*e, out);
+    endMessage(out, at);
+}
+
+// ============================
+//  Décodage
+// ============================
+bool decodeSubmit(const ScoreMessageView& m, std::vector<ScoreEntry>& out) {
+    if (m.type != ScoreMessage::Submit) return false;
+    Reader r(m);
+    const std::uint64_t n = r.varint();
+    return r.scores(n, out) && r.done();
+}
+
+bool decodeSubmitAck(const ScoreMessageView& m, std::uint32_t& accepted) {
+    if (m.type != ScoreMessage::SubmitAck) return false;
+    Reader r(m);
+    accepted = static_cast<std::uint32_t>(r.varint());
+    return r.done();
+}
+
+bool decodeTopQuery(const ScoreMessageView& m, std::string& difficulty, std::uint32_t& n) {
+    if (m.type != ScoreMessage::TopQuery) return false;
+    Reader r(m);
+    n          = static_cast<std::uint32_t>(r.varint());
+    difficulty = r.string();
+    return r.done();
+}
+
+bool decodeTopReply(const ScoreMessageView& m, std::string& difficulty, std::uint64_t& total,
+                    std::vector<ScoreEntry>& out) {
+    if (m.type != ScoreMessage::TopReply) return false;
+    Reader r(m);
+    total      = r.varint();
+    difficulty = r.string();
+    const std::uint64_t n = r.varint();
+    return r.scores(n, out) && r.done();
+}
+
+// ============================
+//  MessageBuffer
+// ============================
+void MessageBuffer::append(const void* data, std::size_t size) {
+    // Les messages déjà rendus sont retirés avant d'agrandir
+    if (head_ > 0 && head_ * 2 >= data_.size()) {
+        data_.erase(data_.begin(), data_.begin() + static_cast<std::ptrdiff_t>(head_));
+        head_ = 0;
+    }
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    data_.insert(data_.end(), bytes, bytes + size);
+}
+
+bool MessageBuffer::next(ScoreMessageView& out) {
+    if (error_ || data_.size() - head_ < kFrameHeader) return false;
+    const std::uint8_t* p = data_.data() + head_;
+    const std::uint32_t size = getU32(p);
+    const auto type = static_cast<ScoreMessage>(p[4]);
+    if (size == 0 || size > kMaxScoreMessage || p[4] < 1 || p[4] > 4) {
+        error_ = true;
+        return false;
+    }
+    if (data_.size() - head_ < 4 + static_cast<std::size_t>(size)) return false;
+    out.type = type;
+    out.body = p + kFrameHeader;
+    out.size = size - 1;
+    head_ += 4 + static_cast<std::size_t>(size);
+    return true;
+}
+
+// ============================
+//  Backoff
+// ============================
+std::uint32_t Backoff::delayMs(std::uint32_t attempt, Rng& rng) const {
+    std::uint64_t d = baseMs;
+    for (std::uint32_t i = 1; i < attempt && d < maxMs; ++i) d *= 2;
+    const auto cap = static_cast<std::uint32_t>(std::min<std::uint64_t>(d, maxMs));
+    return cap / 2 + rng.below(cap - cap / 2 + 1);
+}
@@ -0,0 +1,413 @@
+#include "sim/Simd.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TD_SIMD_X86 1
+#define TD_TARGET(isa) __attribute__((target(isa)))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define TD_SIMD_X86 1
+#define TD_TARGET(isa)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#define TD_SIMD_X86 0
+#endif
+
+namespace {
+
+// ============================
+//  Scalaire (référence)
+// ============================
+void integrateRange(float* px, float* py, const float* vx, const float* vy, float* ttl,
+                    std::size_t begin, std::size_t end, float dt) {
+    for (std::size_t i = begin; i < end; ++i) {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        ttl[i] -= dt;
+    }
+}
+
+void moveRange(EnemyStore& e, const Path& path, float dt, std::vector<Handle>* arrived,
+               std::size_t begin, std::size_t end) {
+    const std::uint32_t last = path.size();
+
+    float*         px  = e.posX.data();
+    float*         py  = e.posY.data();
+    float*         vx  = e.velX.data();
+    float*         vy  = e.velY.data();
+    float*         pg  = e.progress.data();
+    std::uint32_t* idx = e.pathIdx.data();
+    const float*   spd = e.speed.data();
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t k = idx[i];
+        if (k >= last) { vx[i] = vy[i] = 0.f; continue; }
+
+        const float dx   = path.x[k] - px[i];
+        const float dy   = path.y[k] - py[i];
+        const float dist = std::sqrt(dx * dx + dy * dy);
+        const float step = spd[i] * dt;
+
+        if (dist <= step) {
+            // Waypoint atteint (on ne reporte pas le reste du pas : suffisant à 120 Hz)
+            pg[i] += dist;
+            px[i] = path.x[k];
+            py[i] = path.y[k];
+            idx[i] = k + 1;
+            if (k + 1 == last && arrived) arrived->push_back(e.ids.handleAt(static_cast<std::uint32_t>(i)));
+            continue;
+        }
+
+        const float inv = spd[i] / dist;
+        vx[i] = dx * inv;
+        vy[i] = dy * inv;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        pg[i] += step;
+    }
+}
+
+// Projectile i : impact ou cible disparue -> détruit
+void resolveHitAt(ProjectileStore& p, const EnemyStore& e, std::size_t i, float r2, std::vector<DamageHit>& hits) {
+    const Handle        self = p.ids.handleAt(static_cast<std::uint32_t>(i));
+    const std::uint32_t t    = e.ids.denseIndex(p.target[i]);
+    if (t == Handle::kInvalid) { p.destroy(self); return; }
+
+    const float dx = e.posX[t] - p.posX[i];
+    const float dy = e.posY[t] - p.posY[i];
+    if (dx * dx + dy * dy <= r2) {
+        hits.push_back(DamageHit{p.target[i], p.damage[i]});
+        p.destroy(self);
+    }
+}
+
+// Bloc [i, i + lanes) déjà testé : destructions dans l'ordre du scalaire
+// (à rebours). Un swap-and-pop n'amène en j qu'un élément déjà traité.
+void applyHitBlock(ProjectileStore& p, std::size_t i, int lanes, int validBits, int hitBits,
+                   std::vector<DamageHit>& hits) {
+    for (int l = lanes - 1; l >= 0; --l) {
+        const std::size_t j = i + static_cast<std::size_t>(l);
+        if (!((validBits >> l) & 1)) {
+            p.destroy(p.ids.handleAt(static_cast<std::uint32_t>(j)));
+        } else if ((hitBits >> l) & 1) {
+            hits.push_back(DamageHit{p.target[j], p.damage[j]});
+            p.destroy(p.ids.handleAt(static_cast<std::uint32_t>(j)));
+        }
+    }
+}
+
+void integrateScalar(float* px, float* py, const float* vx, const float* vy, float* ttl, std::size_t n, float dt) {
+    integrateRange(px, py, vx, vy, ttl, 0, n, dt);
+}
+
+void moveScalar(EnemyStore& e, const Path& path, float dt, std::vector<Handle>* arrived) {
+    moveRange(e, path, dt, arrived, 0, e.size());
+}
+
+void resolveHitsScalar(ProjectileStore& p, const EnemyStore& e, float hitRadius, std::vector<DamageHit>& hits) {
+    const float r2 = hitRadius * hitRadius;
+    for (std::size_t i = p.size(); i-- > 0;) resolveHitAt(p, e, i, r2, hits);
+}
+
+#if TD_SIMD_X86
+// ============================
+//  SSE4.1 (4 voies)
+// ============================
+TD_TARGET("sse4.1")
+void integrateSse41(float* px, float* py, const float* vx, const float* vy, float* ttl, std::size_t n, float dt) {
+    const __m128 vdt = _mm_set1_ps(dt);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), vdt)));
+        _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), vdt)));
+        _mm_storeu_ps(ttl + i, _mm_sub_ps(_mm_loadu_ps(ttl + i), vdt));
+    }
+    integrateRange(px, py, vx, vy, ttl, i, n, dt);
+}
+
+TD_TARGET("sse4.1")
+void moveSse41(EnemyStore& e, const Path& path, float dt, std::vector<Handle>* arrived) {
+    const std::size_t   n    = e.size();
+    const std::uint32_t last = path.size();
+    if (last == 0) { moveRange(e, path, dt, arrived, 0, n); return; }
+
+    float*         px  = e.posX.data();
+    float*         py  = e.posY.data();
+    float*         vx  = e.velX.data();
+    float*         vy  = e.velY.data();
+    float*         pg  = e.progress.data();
+    std::uint32_t* idx = e.pathIdx.data();
+    const float*   spd = e.speed.data();
+
+    const __m128  vdt     = _mm_set1_ps(dt);
+    const __m128  zero    = _mm_setzero_ps();
+    const __m128i lastM1  = _mm_set1_epi32(static_cast<int>(last - 1));
+    const __m128i lastV   = _mm_set1_epi32(static_cast<int>(last));
+    alignas(16) std::uint32_t k4[4];
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128i k      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + i));
+        const __m128i kc     = _mm_min_epu32(k, lastM1);      // indice lisible même fini
+        const __m128  active = _mm_castsi128_ps(_mm_cmpeq_epi32(kc, k)); // k < last
+        _mm_store_si128(reinterpret_cast<__m128i*>(k4), kc);
+        const __m128 wx = _mm_setr_ps(path.x[k4[0]], path.x[k4[1]], path.x[k4[2]], path.x[k4[3]]);
+        const __m128 wy = _mm_setr_ps(path.y[k4[0]], path.y[k4[1]], path.y[k4[2]], path.y[k4[3]]);
+
+        const __m128 x    = _mm_loadu_ps(px + i);
+        const __m128 y    = _mm_loadu_ps(py + i);
+        const __m128 s    = _mm_loadu_ps(spd + i);
+        const __m128 dx   = _mm_sub_ps(wx, x);
+        const __m128 dy   = _mm_sub_ps(wy, y);
+        const __m128 dist = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        const __m128 step = _mm_mul_ps(s, vdt);
+        const __m128 reach  = _mm_and_ps(active, _mm_cmple_ps(dist, step));
+        const __m128 moving = _mm_andnot_ps(reach, active);
+
+        const __m128 inv = _mm_div_ps(s, dist);
+        const __m128 nvx = _mm_mul_ps(dx, inv);
+        const __m128 nvy = _mm_mul_ps(dy, inv);
+        // Vitesse : nouvelle en route, gardée sur un waypoint, nulle au bout
+        _mm_storeu_ps(vx + i, _mm_blendv_ps(_mm_blendv_ps(zero, _mm_loadu_ps(vx + i), reach), nvx, moving));
+        _mm_storeu_ps(vy + i, _mm_blendv_ps(_mm_blendv_ps(zero, _mm_loadu_ps(vy + i), reach), nvy, moving));
+        _mm_storeu_ps(px + i, _mm_blendv_ps(_mm_blendv_ps(x, wx, reach), _mm_add_ps(x, _mm_mul_ps(nvx, vdt)), moving));
+        _mm_storeu_ps(py + i, _mm_blendv_ps(_mm_blendv_ps(y, wy, reach), _mm_add_ps(y, _mm_mul_ps(nvy, vdt)), moving));
+        const __m128 g = _mm_loadu_ps(pg + i);
+        _mm_storeu_ps(pg + i, _mm_blendv_ps(g, _mm_add_ps(g, _mm_blendv_ps(step, dist, reach)), active));
+        const __m128i reachI = _mm_castps_si128(reach);
+        const __m128i next   = _mm_sub_epi32(k, reachI); // k + 1 sur un waypoint
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(idx + i), next);
+
+        if (arrived) {
+            int bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(reachI, _mm_cmpeq_epi32(next, lastV))));
+            for (int l = 0; bits; ++l, bits >>= 1)
+                if (bits & 1) arrived->push_back(e.ids.handleAt(static_cast<std::uint32_t>(i + static_cast<std::size_t>(l))));
+        }
+    }
+    moveRange(e, path, dt, arrived, i, n);
+}
+
+TD_TARGET("sse4.1")
+void resolveHitsSse41(ProjectileStore& p, const EnemyStore& e, float hitRadius, std::vector<DamageHit>& hits) {
+    const float r2 = hitRadius * hitRadius;
+    std::size_t i  = p.size();
+    // Queue du haut en scalaire, puis blocs en descendant : l'ordre du scalaire
+    for (std::size_t tail = i % 4; tail > 0; --tail) resolveHitAt(p, e, --i, r2, hits);
+
+    const __m128 vr2 = _mm_set1_ps(r2);
+    float ex[4], ey[4];
+    while (i >= 4) {
+        i -= 4;
+        int validBits = 0;
+        for (int l = 0; l < 4; ++l) {
+            const std::uint32_t t = e.ids.denseIndex(p.target[i + static_cast<std::size_t>(l)]);
+            const bool valid = t != Handle::kInvalid;
+            validBits |= valid ? 1 << l : 0;
+            ex[l] = valid ? e.posX[t] : 0.f;
+            ey[l] = valid ? e.posY[t] : 0.f;
+        }
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(ex), _mm_loadu_ps(p.posX.data() + i));
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ey), _mm_loadu_ps(p.posY.data() + i));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        applyHitBlock(p, i, 4, validBits, _mm_movemask_ps(_mm_cmple_ps(d2, vr2)) & validBits, hits);
+    }
+}
+
+// ============================
+//  AVX2 (8 voies)
+// ============================
+TD_TARGET("avx2")
+void integrateAvx2(float* px, float* py, const float* vx, const float* vy, float* ttl, std::size_t n, float dt) {
+    const __m256 vdt = _mm256_set1_ps(dt);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(px + i, _mm256_add_ps(_mm256_loadu_ps(px + i), _mm256_mul_ps(_mm256_loadu_ps(vx + i), vdt)));
+        _mm256_storeu_ps(py + i, _mm256_add_ps(_mm256_loadu_ps(py + i), _mm256_mul_ps(_mm256_loadu_ps(vy + i), vdt)));
+        _mm256_storeu_ps(ttl + i, _mm256_sub_ps(_mm256_loadu_ps(ttl + i), vdt));
+    }
+    integrateRange(px, py, vx, vy, ttl, i, n, dt);
+}
+
+TD_TARGET("avx2")
+void moveAvx2(EnemyStore& e, const Path& path, float dt, std::vector<Handle>* arrived) {
+    const std::size_t   n    = e.size();
+    const std::uint32_t last = path.size();
+    if (last == 0) { moveRange(e, path, dt, arrived, 0, n); return; }
+
+    float*         px  = e.posX.data();
+    float*         py  = e.posY.data();
+    float*         vx  = e.velX.data();
+    float*         vy  = e.velY.data();
+    float*         pg  = e.progress.data();
+    std::uint32_t* idx = e.pathIdx.data();
+    const float*   spd = e.speed.data();
+
+    const __m256  vdt    = _mm256_set1_ps(dt);
+    const __m256  zero   = _mm256_setzero_ps();
+    const __m256i lastM1 = _mm256_set1_epi32(static_cast<int>(last - 1));
+    const __m256i lastV  = _mm256_set1_epi32(static_cast<int>(last));
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i k      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + i));
+        const __m256i kc     = _mm256_min_epu32(k, lastM1);
+        const __m256  active = _mm256_castsi256_ps(_mm256_cmpeq_epi32(kc, k));
+        const __m256  wx     = _mm256_i32gather_ps(path.x.data(), kc, 4);
+        const __m256  wy     = _mm256_i32gather_ps(path.y.data(), kc, 4);
+
+        const __m256 x    = _mm256_loadu_ps(px + i);
+        const __m256 y    = _mm256_loadu_ps(py + i);
+        const __m256 s    = _mm256_loadu_ps(spd + i);
+        const __m256 dx   = _mm256_sub_ps(wx, x);
+        const __m256 dy   = _mm256_sub_ps(wy, y);
+        const __m256 dist = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+        const __m256 step = _mm256_mul_ps(s, vdt);
+        const __m256 reach  = _mm256_and_ps(active, _mm256_cmp_ps(dist, step, _CMP_LE_OQ));
+        const __m256 moving = _mm256_andnot_ps(reach, active);
+
+        const __m256 inv = _mm256_div_ps(s, dist);
+        const __m256 nvx = _mm256_mul_ps(dx, inv);
+        const __m256 nvy = _mm256_mul_ps(dy, inv);
+        _mm256_storeu_ps(vx + i, _mm256_blendv_ps(_mm256_blendv_ps(zero, _mm256_loadu_ps(vx + i), reach), nvx, moving));
+        _mm256_storeu_ps(vy + i, _mm256_blendv_ps(_mm256_blendv_ps(zero, _mm256_loadu_ps(vy + i), reach), nvy, moving));
+        _mm256_storeu_ps(px + i, _mm256_blendv_ps(_mm256_blendv_ps(x, wx, reach), _mm256_add_ps(x, _mm256_mul_ps(nvx, vdt)), moving));
+        _mm256_storeu_ps(py + i, _mm256_blendv_ps(_mm256_blendv_ps(y, wy, reach), _mm256_add_ps(y, _mm256_mul_ps(nvy, vdt)), moving));
+        const __m256 g = _mm256_loadu_ps(pg + i);
+        _mm256_storeu_ps(pg + i, _mm256_blendv_ps(g, _mm256_add_ps(g, _mm256_blendv_ps(step, dist, reach)), active));
+        const __m256i reachI = _mm256_castps_si256(reach);
+        const __m256i next   = _mm256_sub_epi32(k, reachI);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(idx + i), next);
+
+        if (arrived) {
+            int bits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(reachI, _mm256_cmpeq_epi32(next, lastV))));
+            for (int l = 0; bits; ++l, bits >>= 1)
+                if (bits & 1) arrived->push_back(e.ids.handleAt(static_cast<std::uint32_t>(i + static_cast<std::size_t>(l))));
+        }
+    }
+    moveRange(e, path, dt, arrived, i, n);
+}
+
+TD_TARGET("avx2")
+void resolveHitsAvx2(ProjectileStore& p, const EnemyStore& e, float hitRadius, std::vector<DamageHit>& hits) {
+    const float r2 = hitRadius * hitRadius;
+    std::size_t i  = p.size();
+    for (std::size_t tail = i % 8; tail > 0; --tail) resolveHitAt(p, e, --i, r2, hits);
+
+    const __m256  vr2  = _mm256_set1_ps(r2);
+    const __m256  zero = _mm256_setzero_ps();
+    const __m256i none = _mm256_set1_epi32(-1); // Handle::kInvalid
+    alignas(32) std::uint32_t t8[8];
+    while (i >= 8) {
+        i -= 8;
+        for (int l = 0; l < 8; ++l) t8[l] = e.ids.denseIndex(p.target[i + static_cast<std::size_t>(l)]);
+        const __m256i t     = _mm256_load_si256(reinterpret_cast<const __m256i*>(t8));
+        const __m256  valid = _mm256_castsi256_ps(_mm256_andnot_si256(_mm256_cmpeq_epi32(t, none), none));
+        // Voies sans cible : rien n'est lu
+        const __m256 ex = _mm256_mask_i32gather_ps(zero, e.posX.data(), t, valid, 4);
+        const __m256 ey = _mm256_mask_i32gather_ps(zero, e.posY.data(), t, valid, 4);
+        const __m256 dx = _mm256_sub_ps(ex, _mm256_loadu_ps(p.posX.data() + i));
+        const __m256 dy = _mm256_sub_ps(ey, _mm256_loadu_ps(p.posY.data() + i));
+        const __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        const int validBits = _mm256_movemask_ps(valid);
+        applyHitBlock(p, i, 8, validBits, _mm256_movemask_ps(_mm256_cmp_ps(d2, vr2, _CMP_LE_OQ)) & validBits, hits);
+    }
+}
+#endif
+
+constexpr SimdKernels kScalar{SimdLevel::Scalar, integrateScalar, moveScalar, resolveHitsScalar};
+#if TD_SIMD_X86
+constexpr SimdKernels kSse41{SimdLevel::Sse41, integrateSse41, moveSse41, resolveHitsSse41};
+constexpr SimdKernels kAvx2{SimdLevel::Avx2, integrateAvx2, moveAvx2, resolveHitsAvx2};
+#endif
+
+// ============================
+//  Choix du niveau
+// ============================
+SimdLevel detectCpu() {
+#if TD_SIMD_X86 && !defined(_MSC_VER)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+    if (__builtin_cpu_supports("sse4.1")) return SimdLevel::Sse41;
+#elif TD_SIMD_X86
+    int info[4];
+    __cpuid(info, 1);
+    const bool sse41   = (info[2] >> 19) & 1;
+    const bool osxsave = (info[2] >> 27) & 1;
+    const bool avx     = (info[2] >> 28) & 1;
+    __cpuidex(info, 7, 0);
+    const bool avx2 = (info[1] >> 5) & 1;
+    // Registres YMM sauvegardés par l'OS
+    if (avx2 && avx && osxsave && (_xgetbv(0) & 6) == 6) return SimdLevel::Avx2;
+    if (sse41) return SimdLevel::Sse41;
+#endif
+    return SimdLevel::Scalar;
+}
+
+SimdLevel initialLevel() {
+    const SimdLevel cpu = detectCpu();
+    SimdLevel level = cpu;
+    if (const char* env = std::getenv("TD_SIMD")) {
+        if      (std::strcmp(env, "scalar") == 0) level = SimdLevel::Scalar;
+        else if (std::strcmp(env, "sse4.1") == 0) level = SimdLevel::Sse41;
+        else if (std::strcmp(env, "avx2") == 0)   level = SimdLevel::Avx2;
+        else std::cerr << "[Simd] Unknown TD_SIMD=" << env << " (scalar, sse4.1, avx2)\n";
+        if (level > cpu) level = cpu;
+    }
+    return level;
+}
+
+std::atomic<int> gLevel{-1};
+
+} // namespace
+
+const char* simdName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::Sse41: return "sse4.1";
+    case SimdLevel::Avx2:  return "avx2";
+    default:               return "scalar";
+    }
+}
+
+int simdLanes(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::Sse41: return 4;
+    case SimdLevel::Avx2:  return 8;
+    default:               return 1;
+    }
+}
+
+SimdLevel detectSimd() {
+    static const SimdLevel cpu = detectCpu();
+    return cpu;
+}
+
+SimdLevel simdLevel() {
+    int l = gLevel.load(std::memory_order_relaxed);
+    if (l < 0) {
+        l = static_cast<int>(initialLevel());
+        gLevel.store(l, std::memory_order_relaxed);
+    }
+    return static_cast<SimdLevel>(l);
+}
+
+SimdLevel setSimdLevel(SimdLevel level) {
+    if (level > detectSimd()) level = detectSimd();
+    gLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+    return level;
+}
+
+const SimdKernels& simdKernels(SimdLevel level) {
+#if TD_SIMD_X86
+    if (level == SimdLevel::Avx2)  return kAvx2;
+    if (level == SimdLevel::Sse41) return kSse41;
+#else
+    (void)level;
+#endif
+    return kScalar;
+}
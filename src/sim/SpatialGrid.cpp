@@ -0,0 +1,161 @@
+#include "sim/SpatialGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sim/JobSystem.hpp"
+
+void SpatialGrid::configure(float worldW, float worldH, float cellSize) {
+    cellSize_ = cellSize > 0.f ? cellSize : 1.f;
+    invCell_  = 1.f / cellSize_;
+    cols_ = std::max(1, static_cast<int>(std::ceil(worldW * invCell_)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(worldH * invCell_)));
+    cellStart_.assign(static_cast<std::size_t>(cols_) * rows_ + 1, 0);
+    items_.clear();
+    sx_.clear();
+    sy_.clear();
+}
+
+int SpatialGrid::cellX(float x) const {
+    return std::clamp(static_cast<int>(std::floor(x * invCell_)), 0, cols_ - 1);
+}
+
+int SpatialGrid::cellY(float y) const {
+    return std::clamp(static_cast<int>(std::floor(y * invCell_)), 0, rows_ - 1);
+}
+
+void SpatialGrid::rebuild(const float* x, const float* y, std::size_t n, JobSystem* jobs) {
+    const std::size_t cells = static_cast<std::size_t>(cols_) * rows_;
+    std::fill(cellStart_.begin(), cellStart_.end(), 0u);
+    cellOf_.resize(n);
+    items_.resize(n);
+    sx_.resize(n);
+    sy_.resize(n);
+
+    if (jobs && jobs->threads() > 1 && n > kRebuildChunk) {
+        // Compte par (tranche, seau), puis préfixes seau par seau et tranche
+        // par tranche : la tranche k écrit ses entités après celles des
+        // tranches précédentes dans chaque seau, comme le parcours en série
+        const std::size_t chunks = (n + kRebuildChunk - 1) / kRebuildChunk;
+        chunkCursor_.assign(cells * chunks, 0u);
+        jobs->parallelFor(chunks, 1, [&](std::size_t k0, std::size_t k1) {
+            for (std::size_t k = k0; k < k1; ++k) {
+                const std::size_t end = std::min(n, (k + 1) * kRebuildChunk);
+                for (std::size_t i = k * kRebuildChunk; i < end; ++i) {
+                    const auto c = static_cast<std::uint32_t>(cellY(y[i]) * cols_ + cellX(x[i]));
+                    cellOf_[i] = c;
+                    ++chunkCursor_[k * cells + c];
+                }
+            }
+        });
+        std::uint32_t run = 0;
+        for (std::size_t c = 0; c < cells; ++c) {
+            cellStart_[c] = run;
+            for (std::size_t k = 0; k < chunks; ++k) {
+                const std::uint32_t count = chunkCursor_[k * cells + c];
+                chunkCursor_[k * cells + c] = run;
+                run += count;
+            }
+        }
+        cellStart_[cells] = run;
+        jobs->parallelFor(chunks, 1, [&](std::size_t k0, std::size_t k1) {
+            for (std::size_t k = k0; k < k1; ++k) {
+                const std::size_t end = std::min(n, (k + 1) * kRebuildChunk);
+                for (std::size_t i = k * kRebuildChunk; i < end; ++i) {
+                    const std::uint32_t slot = chunkCursor_[k * cells + cellOf_[i]]++;
+                    items_[slot] = static_cast<std::uint32_t>(i);
+                    sx_[slot] = x[i];
+                    sy_[slot] = y[i];
+                }
+            }
+        });
+        return;
+    }
+
+    // 1) Comptage par seau
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto c = static_cast<std::uint32_t>(cellY(y[i]) * cols_ + cellX(x[i]));
+        cellOf_[i] = c;
+        ++cellStart_[c + 1];
+    }
+    // 2) Préfixes : cellStart_[c] = début du seau c
+    for (std::size_t c = 0; c < cells; ++c) cellStart_[c + 1] += cellStart_[c];
+
+    // 3) Dispersion (stable : ordre dense conservé dans chaque seau)
+    cursor_.assign(cellStart_.begin(), cellStart_.end() - 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::uint32_t k = cursor_[cellOf_[i]]++;
+        items_[k] = static_cast<std::uint32_t>(i);
+        sx_[k] = x[i];
+        sy_[k] = y[i];
+    }
+}
+
+void SpatialGrid::queryRange(float x, float y, float r, std::vector<std::uint32_t>& out) const {
+    out.clear();
+    forEachInRange(x, y, r, [&](std::uint32_t i, float) { out.push_back(i); });
+}
+
+// ============================
+//  Acquisition de cibles
+// ============================
+namespace {
+
+// Meilleur candidat selon le mode ; à égalité, le plus petit index dense
+// (ordre déterministe, indépendant de l'ordre de parcours des seaux)
+struct Best {
+    std::uint32_t idx = Handle::kInvalid;
+    float         key = 0.f;
+
+    void offer(std::uint32_t i, float k) {
+        if (idx == Handle::kInvalid || k > key || (k == key && i < idx)) { idx = i; key = k; }
+    }
+};
+
+float targetKey(TargetMode mode, const EnemyStore& e, std::uint32_t i, float d2) {
+    switch (mode) {
+        case TargetMode::First:     return e.progress[i];
+        case TargetMode::Nearest:   return -d2;
+        case TargetMode::Strongest: return e.hp[i];
+    }
+    return 0.f;
+}
+
+void writeTarget(TowerStore& t, std::size_t ti, const EnemyStore& e, const Best& b) {
+    t.target[ti] = b.idx == Handle::kInvalid ? Handle{} : e.ids.handleAt(b.idx);
+}
+
+} // namespace
+
+void acquireTargets(TowerStore& towers, const EnemyStore& enemies, const SpatialGrid& grid, JobSystem* jobs) {
+    const auto acquireRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            const TargetMode mode = towers.mode[t];
+            Best best;
+            grid.forEachInRange(towers.posX[t], towers.posY[t], towers.range[t],
+                                [&](std::uint32_t i, float d2) {
+                                    best.offer(i, targetKey(mode, enemies, i, d2));
+                                });
+            writeTarget(towers, t, enemies, best);
+        }
+    };
+    // Tranches de 64 tours : assez de travail par tâche même à faible densité
+    if (jobs) jobs->parallelFor(towers.size(), 64, acquireRange);
+    else      acquireRange(0, towers.size());
+}
+
+void acquireTargetsBruteForce(TowerStore& towers, const EnemyStore& enemies) {
+    const std::size_t n = towers.size();
+    const std::size_t m = enemies.size();
+    for (std::size_t t = 0; t < n; ++t) {
+        const float r2 = towers.range[t] * towers.range[t];
+        Best best;
+        for (std::size_t i = 0; i < m; ++i) {
+            const float dx = enemies.posX[i] - towers.posX[t];
+            const float dy = enemies.posY[i] - towers.posY[t];
+            const float d2 = dx * dx + dy * dy;
+            if (d2 <= r2) best.offer(static_cast<std::uint32_t>(i), targetKey(towers.mode[t], enemies, static_cast<std::uint32_t>(i), d2));
+        }
+        writeTarget(towers, t, enemies, best);
+    }
+}
@@ -0,0 +1,75 @@
+#include "sim/Systems.hpp"
+
+#include <cmath>
+
+#include "sim/Simd.hpp"
+
+// Noyau choisi au lancement (Simd.cpp) ; la version scalaire y sert de référence
+void moveEnemiesAlongPath(EnemyStore& e, const Path& path, float dt,
+                          std::vector<Handle>* arrived) {
+    simdKernels().moveAlongPath(e, path, dt, arrived);
+}
+
+void steerEnemiesByFlowField(EnemyStore& e, const FlowFieldSet& fields, float dt,
+                             std::vector<Handle>* arrived) {
+    steerEnemiesByFlowField(e, fields, dt, PerEnemyTuning{}, arrived);
+}
+
+void applyHits(EnemyStore& e, const std::vector<DamageHit>& hits) {
+    for (const auto& h : hits) {
+        const std::uint32_t i = e.ids.denseIndex(h.target);
+        if (i != Handle::kInvalid) e.hp[i] -= h.amount;
+    }
+}
+
+void applySplashDamage(EnemyStore& e, float x, float y, float radius, float amount) {
+    const std::size_t n  = e.size();
+    const float       r2 = radius * radius;
+    const float*      px = e.posX.data();
+    const float*      py = e.posY.data();
+    float*            hp = e.hp.data();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const float dx = px[i] - x;
+        const float dy = py[i] - y;
+        // Sans branche : le compilateur peut vectoriser
+        hp[i] -= (dx * dx + dy * dy <= r2) ? amount : 0.f;
+    }
+}
+
+std::uint64_t removeDeadEnemies(EnemyStore& e, std::vector<Handle>* killed) {
+    return removeDeadEnemies(e, PerEnemyTuning{}, killed);
+}
+
+void tickTowerCooldowns(TowerStore& t, float dt) {
+    for (float& c : t.cooldown) {
+        c -= dt;
+        if (c < 0.f) c = 0.f;
+    }
+}
+
+void steerProjectiles(ProjectileStore& p, const EnemyStore& e, float speed) {
+    const std::size_t n = p.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::uint32_t t = e.ids.denseIndex(p.target[i]);
+        if (t == Handle::kInvalid) continue;
+        const float dx   = e.posX[t] - p.posX[i];
+        const float dy   = e.posY[t] - p.posY[i];
+        const float dist = std::sqrt(dx * dx + dy * dy);
+        if (dist <= 0.f) continue;
+        p.velX[i] = dx * (speed / dist);
+        p.velY[i] = dy * (speed / dist);
+    }
+}
+
+void integrateProjectiles(ProjectileStore& p, float dt) {
+    simdKernels().integrate(p.posX.data(), p.posY.data(), p.velX.data(), p.velY.data(), p.ttl.data(), p.size(), dt);
+    for (std::size_t i = p.size(); i-- > 0;) {
+        if (p.ttl[i] <= 0.f) p.destroy(p.ids.handleAt(static_cast<std::uint32_t>(i)));
+    }
+}
+
+void resolveProjectileHits(ProjectileStore& p, const EnemyStore& e, float hitRadius,
+                           std::vector<DamageHit>& hits) {
+    simdKernels().resolveHits(p, e, hitRadius, hits);
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "AssetTable.hpp"
+
+TEST_CASE("Asset table: hits, misses and content dedup", "[assets]") {
+    AssetTable<int> t;
+    std::uint64_t now = 0;
+
+    REQUIRE(t.acquire("a.png", ++now) == nullptr);
+    auto a = t.insert("a.png", 0xAA, std::make_shared<int>(1), 100, ++now);
+    REQUIRE(*a == 1);
+    REQUIRE(t.acquire("a.png", ++now) == a);
+
+    // Même contenu sous un autre chemin : même objet, octets comptés une fois
+    REQUIRE(t.acquire("copy_of_a.png", ++now) == nullptr);
+    auto b = t.insert("copy_of_a.png", 0xAA, std::make_shared<int>(2), 100, ++now);
+    REQUIRE(b == a);
+    REQUIRE(t.acquire("copy_of_a.png", ++now) == a);
+
+    t.countPendingHit();
+    const auto& st = t.stats();
+    REQUIRE(st.misses == 2);
+    REQUIRE(st.hits == 3);
+    REQUIRE(st.dedups == 1);
+    REQUIRE(st.resident == 1);
+    REQUIRE(st.bytes == 100);
+}
+
+TEST_CASE("Asset table: only unused assets are evicted, oldest first", "[assets]") {
+    AssetTable<int> t;
+    std::uint64_t now = 0;
+
+    auto held = t.insert("held", 1, std::make_shared<int>(1), 10, ++now);
+    t.insert("old", 2, std::make_shared<int>(2), 20, ++now);
+    t.insert("new", 3, std::make_shared<int>(3), 30, ++now);
+    t.acquire("old", ++now); // "old" redevient le plus récent (handle relâché aussitôt)
+
+    REQUIRE(t.oldestUnused() == 3);
+    AssetTable<int>::Handle evicted;
+    REQUIRE(t.evictOldestUnused(&evicted));
+    REQUIRE(*evicted == 3); // encore vivant : de quoi prévenir ceux qui l'indexent
+    evicted.reset();
+    REQUIRE(t.acquire("new", ++now) == nullptr);
+    REQUIRE(t.evictOldestUnused());
+    REQUIRE(t.acquire("old", ++now) == nullptr);
+
+    // Le handle tenu protège l'asset
+    REQUIRE_FALSE(t.evictOldestUnused());
+    REQUIRE(t.oldestUnused() == UINT64_MAX);
+    REQUIRE(t.stats().resident == 1);
+    REQUIRE(t.stats().bytes == 10);
+    REQUIRE(t.stats().evictions == 2);
+
+    held.reset();
+    REQUIRE(t.evictOldestUnused());
+    REQUIRE(t.stats().bytes == 0);
+}
+
+TEST_CASE("Asset table: eviction drops every path of a deduplicated asset", "[assets]") {
+    AssetTable<int> t;
+    std::uint64_t now = 0;
+    t.insert("x", 7, std::make_shared<int>(7), 5, ++now);
+    t.insert("y", 7, std::make_shared<int>(8), 5, ++now);
+    REQUIRE(t.evictOldestUnused());
+    REQUIRE(t.acquire("x", ++now) == nullptr);
+    REQUIRE(t.acquire("y", ++now) == nullptr);
+    REQUIRE(t.stats().resident == 0);
+}
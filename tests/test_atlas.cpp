@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sim/Atlas.hpp"
+
+namespace {
+
+bool overlaps(const AtlasEntry& a, const AtlasEntry& b, int pad) {
+    if (a.page != b.page) return false;
+    return a.x - pad < b.x + b.w + pad && b.x - pad < a.x + a.w + pad &&
+           a.y - pad < b.y + b.h + pad && b.y - pad < a.y + a.h + pad;
+}
+
+// Tailles réelles de assets/images
+const std::vector<AtlasPackInput> kMenuImages = {
+    {"background", 1536, 1024}, {"other-background", 1536, 1024}, {"first-bg", 1024, 1024},
+    {"start", 800, 800}, {"gear", 800, 800}, {"exit", 800, 800},
+};
+
+} // namespace
+
+TEST_CASE("Atlas packing: no overlap, inside pages, padding kept", "[atlas]") {
+    AtlasIndex idx;
+    std::string err;
+    REQUIRE(packAtlas(kMenuImages, 4096, 2, "atlas", idx, &err));
+    REQUIRE(idx.pages.size() == 1);
+    REQUIRE(idx.pages[0].file == "atlas_0.png");
+    REQUIRE(idx.entries.size() == kMenuImages.size());
+
+    for (std::size_t i = 0; i < idx.entries.size(); ++i) {
+        const AtlasEntry& e = idx.entries[i];
+        const AtlasPage&  p = idx.pages[static_cast<std::size_t>(e.page)];
+        REQUIRE(e.x >= 2);
+        REQUIRE(e.y >= 2);
+        REQUIRE(e.x + e.w + 2 <= p.width);
+        REQUIRE(e.y + e.h + 2 <= p.height);
+        for (std::size_t j = i + 1; j < idx.entries.size(); ++j) {
+            REQUIRE_FALSE(overlaps(e, idx.entries[j], 2));
+        }
+    }
+
+    const AtlasEntry* gear = idx.find("gear");
+    REQUIRE(gear);
+    REQUIRE(gear->w == 800);
+    REQUIRE(idx.find("missing") == nullptr);
+}
+
+TEST_CASE("Atlas packing: spills to new pages and rejects oversized images", "[atlas]") {
+    AtlasIndex idx;
+    REQUIRE(packAtlas(kMenuImages, 2048, 1, "atlas", idx));
+    REQUIRE(idx.pages.size() > 1);
+    for (const auto& p : idx.pages) {
+        REQUIRE(p.width  <= 2048);
+        REQUIRE(p.height <= 2048);
+    }
+
+    std::string err;
+    REQUIRE_FALSE(packAtlas({{"huge", 3000, 10}}, 2048, 1, "atlas", idx, &err));
+    REQUIRE_FALSE(err.empty());
+    REQUIRE_FALSE(packAtlas({{"a", 8, 8}, {"a", 4, 4}}, 64, 0, "atlas", idx, &err));
+}
+
+TEST_CASE("Atlas index round-trips through JSON", "[atlas]") {
+    AtlasIndex idx;
+    REQUIRE(packAtlas(kMenuImages, 4096, 2, "atlas", idx));
+
+    JsonValue parsed;
+    REQUIRE(parseJson(writeJson(atlasToJson(idx)), parsed));
+    AtlasIndex back;
+    REQUIRE(parseAtlas(parsed, back));
+    REQUIRE(back.pages.size() == idx.pages.size());
+    REQUIRE(back.pages[0].width == idx.pages[0].width);
+    REQUIRE(back.entries.size() == idx.entries.size());
+    for (std::size_t i = 0; i < idx.entries.size(); ++i) {
+        REQUIRE(back.entries[i].name == idx.entries[i].name);
+        REQUIRE(back.entries[i].x == idx.entries[i].x);
+        REQUIRE(back.entries[i].y == idx.entries[i].y);
+    }
+
+    JsonValue bad;
+    REQUIRE(parseJson(R"({"pages": [], "sprites": {"x": {"page": 0}}})", bad));
+    REQUIRE_FALSE(parseAtlas(bad, back));
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sim/Config.hpp"
+#include "sim/Json.hpp"
+
+TEST_CASE("JSON parser: values, nesting and errors", "[config]") {
+    JsonValue v;
+    REQUIRE(parseJson(R"({ "a": [1, -2.5e1, true, null], "s": "\u00e9\n\"x\"", "o": {} })", v));
+    REQUIRE(v.isObject());
+    REQUIRE(v.members().size() == 3);
+    REQUIRE(v.members()[0].first == "a");
+
+    const JsonValue* a = v.find("a");
+    REQUIRE(a);
+    REQUIRE(a->items().size() == 4);
+    REQUIRE(a->items()[1].asNumber() == -25.0);
+    REQUIRE(a->items()[2].asBool());
+    REQUIRE(a->items()[3].isNull());
+    REQUIRE(v.find("s")->asString() == "\xC3\xA9\n\"x\"");
+    REQUIRE(v.find("o")->isObject());
+    REQUIRE(v.find("missing") == nullptr);
+
+    std::string err;
+    REQUIRE_FALSE(parseJson(R"({"a": 1,})", v, &err));
+    REQUIRE_FALSE(err.empty());
+    REQUIRE_FALSE(parseJson("[1 2]", v));
+    REQUIRE_FALSE(parseJson("\"abc", v));
+    REQUIRE_FALSE(parseJson("{} x", v));
+}
+
+TEST_CASE("Difficulty and rules files load in file order", "[config]") {
+    std::vector<DifficultyParams> all;
+    REQUIRE(loadDifficulties(TD_CONFIG_DIR "/diffilculty.json", all));
+    REQUIRE(all.size() == 4);
+    REQUIRE(all[0].name == "Easy");
+    REQUIRE(all[3].name == "Custom");
+
+    const DifficultyParams* hard = findDifficulty(all, "Hard");
+    REQUIRE(hard);
+    REQUIRE(hard->hpMultiplier == 1.3f);
+    REQUIRE(hard->livesStart == 15);
+
+    GameRules rules;
+    REQUIRE(loadGameRules(TD_CONFIG_DIR "/game_rules.json", rules));
+    REQUIRE(rules.forbidTotalBlock);
+    REQUIRE(rules.startMaterials[0] == 100);
+}
+
+TEST_CASE("JSON writer output parses back to the same values", "[config]") {
+    JsonValue root = JsonValue::makeObject();
+    root.set("int",   JsonValue::makeNumber(42));
+    root.set("frac",  JsonValue::makeNumber(0.1));
+    root.set("text",  JsonValue::makeString("a\"b\\c\n\x01\xC3\xA9"));
+    JsonValue arr = JsonValue::makeArray();
+    arr.push(JsonValue::makeBool(true));
+    arr.push(JsonValue{});
+    root.set("arr",   std::move(arr));
+    root.set("empty", JsonValue::makeObject());
+
+    for (int indent : {-1, 2}) {
+        const std::string text = writeJson(root, indent);
+        JsonValue back;
+        REQUIRE(parseJson(text, back));
+        REQUIRE(back.number("int", 0) == 42.0);
+        REQUIRE(back.number("frac", 0) == 0.1);
+        REQUIRE(back.find("text")->asString() == root.find("text")->asString());
+        REQUIRE(back.find("arr")->items().size() == 2);
+        REQUIRE(back.find("arr")->items()[1].isNull());
+        REQUIRE(back.find("empty")->isObject());
+    }
+    REQUIRE(writeJson(root, -1).find('\n') == std::string::npos);
+}
@@ -0,0 +1,182 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include "sim/ConfigBlob.hpp"
+#include "sim/Game.hpp"
+#include "sim/Json.hpp"
+
+namespace {
+
+struct TempFile {
+    std::filesystem::path path;
+    explicit TempFile(const char* name) : path(std::filesystem::temp_directory_path() / name) {
+        std::filesystem::remove(path);
+    }
+    ~TempFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        std::filesystem::remove(path.string() + ".tmp", ec);
+    }
+};
+
+void writeBytes(const std::filesystem::path& path, const std::vector<std::uint8_t>& data) {
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    os.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+}
+
+std::vector<std::uint8_t> compileText(const char* difficulties, const char* rules) {
+    JsonValue d, r;
+    REQUIRE(parseJson(difficulties, d));
+    REQUIRE(parseJson(rules, r));
+    std::vector<std::uint8_t> out;
+    std::vector<std::string>  errors;
+    REQUIRE(compileConfig(d, r, out, errors));
+    REQUIRE(errors.empty());
+    return out;
+}
+
+constexpr const char* kRules = R"({ "forbidTotalBlock": false, "startMaterials": { "A": 120, "B": 0, "C": 7 } })";
+
+} // namespace
+
+TEST_CASE("Compiled config matches the JSON loaders", "[config]") {
+    TempFile blobFile("td_config_test.tdcb");
+    REQUIRE(compileConfigFiles(TD_CONFIG_DIR "/diffilculty.json", TD_CONFIG_DIR "/game_rules.json",
+                               blobFile.path.string()));
+
+    std::vector<DifficultyParams> json;
+    GameRules                     jsonRules;
+    REQUIRE(loadDifficulties(TD_CONFIG_DIR "/diffilculty.json", json));
+    REQUIRE(loadGameRules(TD_CONFIG_DIR "/game_rules.json", jsonRules));
+
+    ConfigBlob blob;
+    REQUIRE(blob.open(blobFile.path.string()));
+    REQUIRE(blob.difficultyCount() == json.size());
+    for (std::size_t i = 0; i < json.size(); ++i) {
+        const DifficultyParams d = blob.difficulty(i);
+        REQUIRE(d.name == json[i].name);
+        REQUIRE(d.hpMultiplier == json[i].hpMultiplier);
+        REQUIRE(d.speedMultiplier == json[i].speedMultiplier);
+        REQUIRE(d.rewardMultiplier == json[i].rewardMultiplier);
+        REQUIRE(d.livesStart == json[i].livesStart);
+    }
+    REQUIRE(blob.findDifficulty("Hard") == 2);
+    REQUIRE(blob.findDifficulty("Nightmare") == -1);
+    REQUIRE(blob.rules().forbidTotalBlock == jsonRules.forbidTotalBlock);
+    REQUIRE(blob.rules().startMaterials[2] == jsonRules.startMaterials[2]);
+
+    // Même partie, même empreinte, que la config vienne du JSON ou du bloc
+    GameSetup a, b;
+    a.seed = b.seed = 11;
+    a.maxWaves = b.maxWaves = 5;
+    a.difficulty = *findDifficulty(json, "Hard");
+    a.rules      = jsonRules;
+    b.difficulty = blob.difficulty(2);
+    b.rules      = blob.rules();
+    Game ga(a), gb(b);
+    ga.run();
+    gb.run();
+    REQUIRE(ga.stateHash() == gb.stateHash());
+}
+
+TEST_CASE("Config schema and blob checks reject bad input", "[config]") {
+    JsonValue d, r;
+    REQUIRE(parseJson(kRules, r));
+    std::vector<std::string> errors;
+
+    REQUIRE(parseJson(R"({ "Easy": { "hpMultiplier": 1, "speedMultiplier": 1, "rewardMultiplier": 1, "livesStart": 20,
+                                      "hpMultipler": 2 } })", d));
+    REQUIRE_FALSE(validateDifficulties(d, errors));
+    REQUIRE(errors.size() == 1);
+    REQUIRE(errors[0] == "Easy.hpMultipler: unknown key");
+
+    errors.clear();
+    REQUIRE(parseJson(R"({ "Easy": { "hpMultiplier": -1, "speedMultiplier": "fast", "rewardMultiplier": 1,
+                                      "livesStart": 2.5 },
+                           "AVeryLongDifficultyName": { "hpMultiplier": 1, "speedMultiplier": 1,
+                                                         "rewardMultiplier": 1 } })", d));
+    std::vector<std::uint8_t> out;
+    REQUIRE_FALSE(compileConfig(d, r, out, errors));
+    REQUIRE(errors.size() == 5); // hp, speed, lives, nom trop long, livesStart manquant
+
+    errors.clear();
+    REQUIRE(parseJson(R"({ "startMaterials": { "A": 1, "B": 2 }, "forbidTotalBlock": 1 })", r));
+    REQUIRE_FALSE(validateGameRules(r, errors));
+    REQUIRE(errors.size() == 2);
+
+    // Bloc abîmé : refusé à l'ouverture
+    const std::vector<std::uint8_t> good = compileText(
+        R"({ "Normal": { "hpMultiplier": 1, "speedMultiplier": 1, "rewardMultiplier": 1, "livesStart": 20 } })", kRules);
+    ConfigBlob blob;
+    REQUIRE(blob.openBytes(good.data(), good.size()));
+    REQUIRE(blob.rules().startMaterials[0] == 120);
+    REQUIRE_FALSE(blob.rules().forbidTotalBlock);
+
+    std::vector<std::uint8_t> bad = good;
+    bad.back() ^= 1;
+    REQUIRE_FALSE(blob.openBytes(bad.data(), bad.size()));
+    REQUIRE_FALSE(blob.isOpen());
+    REQUIRE_FALSE(blob.openBytes(good.data(), good.size() - 4));
+    bad = good;
+    bad[4] = 99; // version
+    REQUIRE_FALSE(blob.openBytes(bad.data(), bad.size()));
+}
+
+TEST_CASE("Config watcher publishes changed blobs only", "[config]") {
+    TempFile file("td_config_watch.tdcb");
+    const char* easy = R"({ "Easy": { "hpMultiplier": 0.5, "speedMultiplier": 1, "rewardMultiplier": 1, "livesStart": 20 } })";
+    const char* hard = R"({ "Easy": { "hpMultiplier": 2.0, "speedMultiplier": 1, "rewardMultiplier": 1, "livesStart": 20 } })";
+    writeBytes(file.path, compileText(easy, kRules));
+
+    // Sans thread : les tours sont appelés à la main
+    ConfigWatcher watcher(file.path.string(), std::chrono::milliseconds(250), false);
+    REQUIRE_FALSE(watcher.poll());
+    REQUIRE(watcher.take() == nullptr);
+
+    // Date avancée à la main : la résolution du système de fichiers ne compte pas
+    const auto bump = [&] {
+        std::filesystem::last_write_time(file.path, std::filesystem::last_write_time(file.path) + std::chrono::seconds(1));
+    };
+    writeBytes(file.path, compileText(hard, kRules));
+    bump();
+    REQUIRE(watcher.poll());
+    const auto blob = watcher.take();
+    REQUIRE(blob);
+    REQUIRE(blob->difficulty(0).hpMultiplier == 2.0f);
+    REQUIRE(watcher.take() == nullptr);
+
+    // Touché sans changement : rien ; bloc invalide : refusé, rien de publié
+    bump();
+    REQUIRE_FALSE(watcher.poll());
+    writeBytes(file.path, {'T', 'D', 'C', 'B', 1});
+    bump();
+    REQUIRE_FALSE(watcher.poll());
+    REQUIRE(watcher.rejected() == 1);
+    REQUIRE(watcher.reloads() == 1);
+    REQUIRE(watcher.take() == nullptr);
+}
+
+TEST_CASE("Retuning a game between ticks", "[config]") {
+    GameSetup setup;
+    setup.seed     = 5;
+    setup.maxWaves = 6;
+    Game plain(setup), same(setup), harder(setup);
+    for (int i = 0; i < 2000; ++i) {
+        plain.step();
+        same.step();
+        harder.step();
+    }
+    same.retune(setup.difficulty, setup.rules);
+    DifficultyParams tougher = setup.difficulty;
+    tougher.hpMultiplier *= 3.f;
+    harder.retune(tougher, setup.rules);
+    REQUIRE(harder.setup().difficulty.hpMultiplier == tougher.hpMultiplier);
+
+    plain.run();
+    same.run();
+    harder.run();
+    REQUIRE(same.stateHash() == plain.stateHash());
+    REQUIRE(harder.stateHash() != plain.stateHash());
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sim/EntityStore.hpp"
+#include "sim/Systems.hpp"
+
+TEST_CASE("HandleTable: generation invalidates stale handles", "[entities]") {
+    HandleTable t;
+    std::uint32_t dst;
+
+    const Handle a = t.create();
+    const Handle b = t.create();
+    REQUIRE(t.alive(a));
+    REQUIRE(t.destroy(a, dst));
+    REQUIRE_FALSE(t.alive(a));
+    REQUIRE_FALSE(t.destroy(a, dst));
+
+    // Le slot de a est réutilisé avec une nouvelle génération
+    const Handle c = t.create();
+    REQUIRE(c.index == a.index);
+    REQUIRE(c.generation != a.generation);
+    REQUIRE_FALSE(t.alive(a));
+    REQUIRE(t.alive(b));
+    REQUIRE(t.alive(c));
+
+    t.clear();
+    REQUIRE(t.size() == 0);
+    REQUIRE_FALSE(t.alive(b));
+    REQUIRE_FALSE(t.alive(c));
+}
+
+TEST_CASE("EnemyStore: swap-and-pop keeps arrays dense and handles stable", "[entities]") {
+    EnemyStore e;
+    std::vector<Handle> hs;
+    for (int i = 0; i < 5; ++i) {
+        hs.push_back(e.spawn(EnemySpawn{static_cast<float>(i), 0.f, 10.f, 1.f, 1}));
+    }
+
+    REQUIRE(e.destroy(hs[1]));
+    REQUIRE(e.size() == 4);
+    REQUIRE(e.ids.size() == 4);
+
+    // Le dernier (x = 4) a pris la place du détruit, et son handle suit
+    const std::uint32_t i4 = e.ids.denseIndex(hs[4]);
+    REQUIRE(i4 == 1);
+    REQUIRE(e.posX[i4] == 4.f);
+    for (int k : {0, 2, 3}) {
+        REQUIRE(e.posX[e.ids.denseIndex(hs[k])] == static_cast<float>(k));
+    }
+}
+
+TEST_CASE("Systems: damage, death and rewards", "[entities]") {
+    EnemyStore e;
+    const Handle a = e.spawn(EnemySpawn{0.f, 0.f, 10.f, 1.f, 5});
+    const Handle b = e.spawn(EnemySpawn{5.f, 0.f, 10.f, 1.f, 7});
+    const Handle c = e.spawn(EnemySpawn{0.5f, 0.f, 30.f, 1.f, 9});
+
+    applySplashDamage(e, 0.f, 0.f, 1.f, 15.f);  // a et c
+    applyHits(e, {DamageHit{b, 20.f}});
+
+    std::vector<Handle> killed;
+    REQUIRE(removeDeadEnemies(e, &killed) == 5 + 7);
+    REQUIRE(killed.size() == 2);
+    REQUIRE(e.size() == 1);
+    REQUIRE(e.ids.alive(c));
+    REQUIRE_FALSE(e.ids.alive(a));
+    REQUIRE(e.hp[e.ids.denseIndex(c)] == 15.f);
+}
+
+TEST_CASE("Systems: enemies follow the path to its end", "[entities]") {
+    EnemyStore e;
+    Path path;
+    path.x = {2.f, 2.f};
+    path.y = {0.f, 2.f};
+    const Handle h = e.spawn(EnemySpawn{0.f, 0.f, 10.f, 2.f, 0});
+
+    std::vector<Handle> arrived;
+    for (int i = 0; i < 360 && arrived.empty(); ++i) {
+        moveEnemiesAlongPath(e, path, 1.f / 120.f, &arrived);
+    }
+    REQUIRE(arrived.size() == 1);
+    REQUIRE(arrived[0] == h);
+    REQUIRE(e.posX[0] == 2.f);
+    REQUIRE(e.posY[0] == 2.f);
+}
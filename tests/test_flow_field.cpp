@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sim/AStar.hpp"
+#include "sim/FlowField.hpp"
+#include "sim/Systems.hpp"
+
+namespace {
+
+// 7x5, un mur vertical en x = 3 avec un passage en bas
+//   .......
+//   ...#...
+//   ...#...
+//   ...#...
+//   .......
+GridMap wallMap() {
+    GridMap m(7, 5);
+    for (int y = 1; y <= 3; ++y) m.blocked[m.index(3, y)] = 1;
+    m.spawns.push_back(Cell{0, 2});
+    m.exits.push_back(Cell{6, 2});
+    return m;
+}
+
+} // namespace
+
+TEST_CASE("FlowField: BFS distances go around obstacles", "[pathfinding]") {
+    const GridMap m = wallMap();
+    FlowFieldSet set;
+    set.build(m);
+    const FlowField& f = set.fields[0];
+
+    REQUIRE(f.distance(6, 2) == 0);
+    REQUIRE(f.distance(5, 2) == 1);
+    REQUIRE(f.distance(3, 2) == FlowField::kUnreachable); // mur
+    // (0,2) -> contourne par le haut ou le bas : 2 + 6 + 2 = 10
+    REQUIRE(f.distance(0, 2) == 10);
+    REQUIRE(set.nearestExit(Cell{0, 2}) == 0);
+}
+
+TEST_CASE("FlowField: following directions reaches the exit", "[pathfinding]") {
+    const GridMap m = wallMap();
+    FlowFieldSet set;
+    set.build(m);
+    const FlowField& f = set.fields[0];
+
+    Cell c = m.spawns[0];
+    int steps = 0;
+    while (f.distance(c) != 0 && steps < 50) {
+        const std::uint8_t d = f.direction(c);
+        REQUIRE(d != FlowField::kNoDir);
+        c = Cell{c.x + FlowField::kDirX[d], c.y + FlowField::kDirY[d]};
+        REQUIRE(m.passable(c));
+        ++steps;
+    }
+    REQUIRE(c == m.exits[0]);
+    REQUIRE(steps < 10); // les diagonales raccourcissent le trajet
+}
+
+TEST_CASE("FlowField: enemies steer to their exit", "[pathfinding]") {
+    const GridMap m = wallMap();
+    FlowFieldSet set;
+    set.build(m);
+
+    EnemyStore e;
+    const Handle h = e.spawn(EnemySpawn{0.5f, 2.5f, 10.f, 3.f, 0, 0});
+    std::vector<Handle> arrived;
+    for (int i = 0; i < 120 * 10 && arrived.empty(); ++i) {
+        steerEnemiesByFlowField(e, set, 1.f / 120.f, &arrived);
+    }
+    REQUIRE(arrived.size() == 1);
+    REQUIRE(arrived[0] == h);
+}
+
+TEST_CASE("A*: shortest path and unreachable target", "[pathfinding]") {
+    GridMap m = wallMap();
+    std::vector<Cell> path;
+    REQUIRE(findPathAStar(m, Cell{0, 2}, Cell{6, 2}, path));
+    REQUIRE(path.front() == Cell{0, 2});
+    REQUIRE(path.back() == Cell{6, 2});
+    for (const Cell& c : path) REQUIRE(m.passable(c));
+
+    // Mur complet : plus de chemin
+    m.blocked[m.index(3, 0)] = 1;
+    m.blocked[m.index(3, 4)] = 1;
+    REQUIRE_FALSE(findPathAStar(m, Cell{0, 2}, Cell{6, 2}, path));
+}
@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+#include "sim/FlowField.hpp"
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+
+GridMap randomMap(int w, int h, std::uint32_t seed) {
+    GridMap m(w, h);
+    for (auto& b : m.blocked) b = (lcg(seed) % 100u) < 25u ? 1 : 0;
+    m.exits  = {Cell{w - 1, h / 2}, Cell{w / 2, 0}};
+    m.spawns = {Cell{0, h / 2}, Cell{0, 0}};
+    for (const Cell& c : m.exits)  m.blocked[m.index(c)] = 0;
+    for (const Cell& c : m.spawns) m.blocked[m.index(c)] = 0;
+    return m;
+}
+
+bool sameField(const FlowField& a, const FlowField& b) {
+    for (int y = 0; y < a.height(); ++y) {
+        for (int x = 0; x < a.width(); ++x) {
+            if (a.distance(x, y) != b.distance(x, y))   return false;
+            if (a.direction(x, y) != b.direction(x, y)) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("FlowField repair matches a full rebuild", "[pathfinding][repair]") {
+    GridMap m = randomMap(40, 30, 1234u);
+    FlowFieldSet inc;
+    inc.build(m);
+
+    std::uint32_t s = 99u;
+    for (int step = 0; step < 400; ++step) {
+        const Cell c{static_cast<int>(lcg(s) % 40u), static_cast<int>(lcg(s) % 30u)};
+        const bool block = !m.blocked[m.index(c)];
+        inc.setBlocked(m, c, block);
+
+        FlowFieldSet full;
+        full.build(m);
+        for (std::size_t f = 0; f < full.fields.size(); ++f) {
+            INFO("step " << step << " field " << f);
+            REQUIRE(sameField(inc.fields[f], full.fields[f]));
+        }
+    }
+}
+
+TEST_CASE("wouldFullyBlock matches a brute-force rebuild", "[pathfinding][repair]") {
+    for (std::uint32_t seed : {77u, 78u, 79u}) {
+        GridMap m = randomMap(24, 20, seed);
+        // Plus d'obstacles : beaucoup de couloirs et de points d'articulation
+        std::uint32_t s = seed;
+        for (auto& b : m.blocked) if (lcg(s) % 100u < 15u) b = 1;
+        for (const Cell& c : m.exits)  m.blocked[m.index(c)] = 0;
+        for (const Cell& c : m.spawns) m.blocked[m.index(c)] = 0;
+
+        FlowFieldSet set;
+        set.build(m);
+        const FlowFieldSet ref = set;
+
+        for (int y = 0; y < m.height; ++y) {
+            for (int x = 0; x < m.width; ++x) {
+                const Cell c{x, y};
+                bool expected = false;
+                if (m.passable(c)) {
+                    GridMap blocked = m;
+                    blocked.blocked[blocked.index(c)] = 1;
+                    FlowFieldSet after;
+                    after.build(blocked);
+                    for (const Cell& sp : m.spawns) {
+                        const bool before = set.nearestExit(sp) >= 0;
+                        const bool now    = sp != c && after.nearestExit(sp) >= 0;
+                        expected = expected || (before && !now);
+                    }
+                }
+                INFO("seed " << seed << " cell " << x << "," << y);
+                REQUIRE(set.wouldFullyBlock(m, c) == expected);
+            }
+        }
+        // La requête ne modifie pas les champs
+        for (std::size_t f = 0; f < set.fields.size(); ++f) {
+            REQUIRE(sameField(set.fields[f], ref.fields[f]));
+        }
+    }
+}
+
+TEST_CASE("forbidTotalBlock: last corridor cell cannot be built on", "[pathfinding][repair]") {
+    // Couloir horizontal d'une case de haut
+    GridMap m(8, 3);
+    for (int x = 0; x < 8; ++x) { m.blocked[m.index(x, 0)] = 1; m.blocked[m.index(x, 2)] = 1; }
+    m.spawns = {Cell{0, 1}};
+    m.exits  = {Cell{7, 1}};
+    FlowFieldSet set;
+    set.build(m);
+
+    REQUIRE(set.wouldFullyBlock(m, Cell{4, 1}));
+    REQUIRE_FALSE(set.canPlace(m, Cell{4, 1}, true));
+    REQUIRE(set.canPlace(m, Cell{4, 1}, false));
+    REQUIRE_FALSE(set.canPlace(m, Cell{0, 1}, false)); // spawn
+    REQUIRE_FALSE(set.canPlace(m, Cell{7, 1}, false)); // sortie
+
+    // Ouvre un détour au-dessus : la case redevient constructible
+    set.setBlocked(m, Cell{3, 0}, false);
+    set.setBlocked(m, Cell{4, 0}, false);
+    set.setBlocked(m, Cell{5, 0}, false);
+    REQUIRE_FALSE(set.wouldFullyBlock(m, Cell{4, 1}));
+    REQUIRE(set.canPlace(m, Cell{4, 1}, true));
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "sim/FontSubset.hpp"
+
+#ifndef TD_ASSETS_DIR
+#define TD_ASSETS_DIR "assets"
+#endif
+
+namespace {
+
+std::vector<std::uint8_t> readFile(const std::string& path) {
+    std::ifstream is(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(is), {}};
+}
+
+// Police du menu (TrueType variable)
+const std::string kMenuFont = TD_ASSETS_DIR "/fonts/Roboto-Regular_2.ttf";
+
+} // namespace
+
+TEST_CASE("Codepoint ranges parse hex lists", "[fonts]") {
+    std::vector<CodepointRange> r;
+    REQUIRE(parseCodepointRanges("20-7E, A0-FF,20AC", r));
+    REQUIRE(r.size() == 3);
+    REQUIRE(r[0].first == 0x20);
+    REQUIRE(r[0].last == 0x7E);
+    REQUIRE(r[2].first == 0x20AC);
+    REQUIRE(r[2].last == 0x20AC);
+
+    REQUIRE_FALSE(parseCodepointRanges("7E-20", r));
+    REQUIRE_FALSE(parseCodepointRanges("zz", r));
+    REQUIRE_FALSE(parseCodepointRanges("", r));
+}
+
+TEST_CASE("Font subset keeps requested glyphs and drops the rest", "[fonts]") {
+    const auto font = readFile(kMenuFont);
+    REQUIRE(!font.empty());
+
+    std::vector<CodepointRange> ranges;
+    REQUIRE(parseCodepointRanges("20-7E,A0-FF", ranges));
+    std::vector<std::uint8_t> out;
+    FontSubsetStats st;
+    std::string err;
+    REQUIRE(subsetTrueType(font, ranges, out, &st, &err));
+
+    REQUIRE(st.bytesOut < st.bytesIn / 4);
+    REQUIRE(st.glyphsKept < st.glyphsTotal);
+    REQUIRE(fontChecksumValid(out));
+
+    // Même glyphe, mêmes contours pour les caractères gardés (accents composés inclus)
+    for (char32_t cp : {U'A', U'g', U'%', U'é', U'Ü'}) {
+        const std::uint32_t g = fontGlyphIndex(font, cp);
+        REQUIRE(g != 0);
+        REQUIRE(fontGlyphIndex(out, cp) == g);
+        REQUIRE(fontGlyphDataSize(out, g) >= fontGlyphDataSize(font, g));
+    }
+    // Hors plage : plus dans cmap, contours vidés
+    const std::uint32_t euro = fontGlyphIndex(font, U'€');
+    REQUIRE(euro != 0);
+    REQUIRE(fontGlyphIndex(out, U'€') == 0);
+    REQUIRE(fontGlyphDataSize(out, euro) == 0);
+}
+
+TEST_CASE("Font subset rejects non-TrueType data", "[fonts]") {
+    const std::vector<std::uint8_t> junk(64, 0x42);
+    std::vector<std::uint8_t> out;
+    std::string err;
+    REQUIRE_FALSE(subsetTrueType(junk, {{0x20, 0x7E}}, out, nullptr, &err));
+    REQUIRE(!err.empty());
+}
+
+TEST_CASE("Font bundle round-trips entries", "[fonts]") {
+    const std::string path = (std::filesystem::temp_directory_path() / "td_test_fonts.tdfb").string();
+    const std::vector<std::uint8_t> a = {1, 2, 3}, b(1000, 7);
+    REQUIRE(writeFontBundle(path, {{"fonts/a.ttf", a}, {"fonts/b.ttf", b}}));
+
+    std::vector<FontBundleEntry> idx;
+    REQUIRE(readFontBundleIndex(path, idx));
+    REQUIRE(idx.size() == 2);
+    REQUIRE(idx[1].name == "fonts/b.ttf");
+    REQUIRE(idx[1].size == 1000);
+
+    std::vector<char> data;
+    REQUIRE(readFontBundleEntry(path, idx[0], data));
+    REQUIRE(data == std::vector<char>{1, 2, 3});
+
+    // Fichier tronqué : index refusé
+    std::filesystem::resize_file(path, idx[1].offset + 10);
+    REQUIRE_FALSE(readFontBundleIndex(path, idx));
+    std::filesystem::remove(path);
+}
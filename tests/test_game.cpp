@@ -0,0 +1,114 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "sim/Game.hpp"
+
+namespace {
+
+GameSetup setupFor(std::uint64_t seed, float hpMul, int waves) {
+    GameSetup s;
+    s.seed = seed;
+    s.difficulty.name         = "Test";
+    s.difficulty.hpMultiplier = hpMul;
+    s.difficulty.livesStart   = 10;
+    s.maxWaves = waves;
+    return s;
+}
+
+} // namespace
+
+TEST_CASE("Headless game is deterministic for a seed", "[game]") {
+    const GameResult a = Game(setupFor(42, 1.f, 12)).run();
+    const GameResult b = Game(setupFor(42, 1.f, 12)).run();
+    REQUIRE(a.ticks == b.ticks);
+    REQUIRE(a.wavesCleared == b.wavesCleared);
+    REQUIRE(a.livesLost == b.livesLost);
+    REQUIRE(a.kills == b.kills);
+    REQUIRE(a.goldCurve == b.goldCurve);
+    REQUIRE(a.goldCurve.size() == static_cast<std::size_t>(a.wavesCleared));
+}
+
+TEST_CASE("Headless game ends on lives or on the last wave", "[game]") {
+    // Ennemis quasi invincibles : la partie se perd
+    const GameResult lost = Game(setupFor(7, 100.f, 12)).run();
+    REQUIRE_FALSE(lost.survived);
+    REQUIRE(lost.livesLost == 10);
+
+    // Ennemis très faibles : toutes les vagues passent
+    const GameResult won = Game(setupFor(7, 0.05f, 5)).run();
+    REQUIRE(won.survived);
+    REQUIRE(won.wavesCleared == 5);
+    REQUIRE(won.towersBuilt > 0);
+}
+
+TEST_CASE("Preset policies match the shipped config and the runtime path", "[game]") {
+    std::vector<DifficultyParams> all;
+    REQUIRE(loadDifficulties(TD_CONFIG_DIR "/diffilculty.json", all));
+    // Une retouche du JSON fait retomber le preset sur RuntimePolicy : à
+    // reporter dans DifficultyPolicy.hpp pour garder la boucle spécialisée
+    REQUIRE(matchPreset(*findDifficulty(all, "Easy")) == DifficultyPreset::Easy);
+    REQUIRE(matchPreset(*findDifficulty(all, "Normal")) == DifficultyPreset::Normal);
+    REQUIRE(matchPreset(*findDifficulty(all, "Hard")) == DifficultyPreset::Hard);
+    REQUIRE(matchPreset(*findDifficulty(all, "Custom")) == DifficultyPreset::Runtime);
+
+    // Même partie par la boucle spécialisée et par le chemin générique
+    for (const char* name : {"Easy", "Hard"}) {
+        GameSetup fixed;
+        fixed.seed       = 9;
+        fixed.maxWaves   = 8;
+        fixed.difficulty = *findDifficulty(all, name);
+        GameSetup runtime = fixed;
+        runtime.difficulty.name = std::string(name) + "Copy";
+        REQUIRE(matchPreset(runtime.difficulty) == DifficultyPreset::Runtime);
+
+        Game a(fixed), b(runtime);
+        const GameResult ra = a.run();
+        const GameResult rb = b.run();
+        REQUIRE(ra.ticks == rb.ticks);
+        REQUIRE(ra.kills == rb.kills);
+        REQUIRE(ra.goldCurve == rb.goldCurve);
+        REQUIRE(a.stateHash() == b.stateHash());
+    }
+}
+
+TEST_CASE("A mid-wave retune only changes the enemies spawned after it", "[game]") {
+    GameSetup setup = setupFor(5, 1.f, 3);
+    setup.autoPlayer = false; // personne ne tire : les ennemis restent en vie
+    setup.difficulty.name             = "Hard";
+    setup.difficulty.hpMultiplier     = HardPolicy::hp;
+    setup.difficulty.speedMultiplier  = HardPolicy::speed;
+    setup.difficulty.rewardMultiplier = HardPolicy::reward;
+    REQUIRE(matchPreset(setup.difficulty) == DifficultyPreset::Hard);
+    Game g(setup);
+    const EnemyStore& e = g.world().enemies;
+    while (e.size() < 2) g.step();
+
+    std::vector<Handle> before;
+    for (std::uint32_t i = 0; i < e.size(); ++i) before.push_back(e.ids.handleAt(i));
+    DifficultyParams faster = setup.difficulty;
+    faster.speedMultiplier  = 2.f;
+    faster.rewardMultiplier = 3.f;
+    g.retune(faster, setup.rules);
+    const std::size_t count = e.size();
+    while (e.size() == count) g.step();
+    g.step(); // le nouveau venu se déplace aussi
+
+    const EnemyTuning<HardPolicy> hard{};
+    for (const Handle h : before) {
+        const std::uint32_t i = e.ids.denseIndex(h);
+        REQUIRE(i != Handle::kInvalid);
+        REQUIRE(e.speed[i] == hard.speed(e, i));
+        REQUIRE(e.reward[i] == hard.reward(e, i));
+        // La boucle du tick suit la vitesse de l'ennemi, pas celle du retune
+        const float v = std::sqrt(e.velX[i] * e.velX[i] + e.velY[i] * e.velY[i]);
+        REQUIRE(std::fabs(v - e.speed[i]) < 1e-4f);
+    }
+    const std::size_t last = e.size() - 1;
+    REQUIRE(e.speed[last] == 2.f * Game::kEnemySpeed);
+    REQUIRE(e.reward[last] == 3u * Game::kEnemyReward);
+    const float v = std::sqrt(e.velX[last] * e.velX[last] + e.velY[last] * e.velY[last]);
+    REQUIRE(std::fabs(v - e.speed[last]) < 1e-4f);
+}
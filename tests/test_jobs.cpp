@@ -0,0 +1,167 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "sim/FlowField.hpp"
+#include "sim/Game.hpp"
+#include "sim/JobSystem.hpp"
+#include "sim/SpatialGrid.hpp"
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+
+} // namespace
+
+TEST_CASE("JobSystem runs every job once, after its dependencies", "[jobs]") {
+    for (unsigned threads : {1u, 4u}) {
+        JobSystem jobs(threads);
+        REQUIRE(jobs.threads() == threads);
+
+        // Chaîne de 200 tâches, chacune dépendant aussi d'une plus ancienne
+        constexpr int kJobs = 200;
+        std::vector<int>                   order(kJobs, -1);
+        std::atomic<int>                   clock{0};
+        std::vector<JobSystem::JobHandle>  handles;
+        std::vector<std::vector<int>>      deps(kJobs);
+        std::uint32_t s = 9u;
+        for (int i = 0; i < kJobs; ++i) {
+            std::vector<JobSystem::JobHandle> d;
+            if (i > 0) { deps[i].push_back(i - 1); d.push_back(handles[static_cast<std::size_t>(i - 1)]); }
+            if (i > 2) {
+                const int j = static_cast<int>(lcg(s) % static_cast<std::uint32_t>(i - 1));
+                deps[i].push_back(j);
+                d.push_back(handles[static_cast<std::size_t>(j)]);
+            }
+            handles.push_back(jobs.add([&order, &clock, i] { order[static_cast<std::size_t>(i)] = clock++; }, d));
+        }
+        jobs.wait(handles.back());
+        for (int i = 0; i < kJobs; ++i) {
+            REQUIRE(JobSystem::done(handles[static_cast<std::size_t>(i)]));
+            for (int j : deps[i]) REQUIRE(order[static_cast<std::size_t>(j)] < order[static_cast<std::size_t>(i)]);
+        }
+
+        // Losange : D après B et C, eux-mêmes après A ; dépendance déjà finie ignorée
+        int a = -1, b = -1, c = -1, d = -1;
+        std::atomic<int> step{0};
+        auto A = jobs.add([&] { a = step++; }, {handles.back()});
+        auto B = jobs.add([&] { b = step++; }, {A});
+        auto C = jobs.add([&] { c = step++; }, {A, nullptr});
+        auto D = jobs.add([&] { d = step++; }, {B, C});
+        jobs.wait(D);
+        REQUIRE(a == 0);
+        REQUIRE(d == 3);
+        REQUIRE(b > a);
+        REQUIRE(c > a);
+        REQUIRE(jobs.stats().executed == kJobs + 4);
+    }
+}
+
+TEST_CASE("JobSystem parallelFor covers each index exactly once", "[jobs]") {
+    for (unsigned threads : {1u, 3u, 8u}) {
+        JobSystem jobs(threads);
+        for (std::size_t n : {0u, 1u, 7u, 1000u, 100'003u}) {
+            for (std::size_t grain : {1u, 64u, 4096u}) {
+                if (grain == 1 && n > 1000) continue;
+                std::vector<int>  hits(n, 0);
+                std::atomic<bool> oversized{false}; // pas de REQUIRE hors du thread du test
+                jobs.parallelFor(n, grain, [&](std::size_t begin, std::size_t end) {
+                    if (end - begin > grain) oversized = true;
+                    for (std::size_t i = begin; i < end; ++i) ++hits[i];
+                });
+                REQUIRE(oversized == (threads == 1 && n > grain)); // un seul bloc sans autre thread
+                REQUIRE(std::count(hits.begin(), hits.end(), 1) == static_cast<std::ptrdiff_t>(n));
+            }
+        }
+
+        // Imbriqué : une boucle par ligne, lancée depuis une tâche
+        std::vector<int> grid(64 * 64, 0);
+        jobs.parallelFor(64, 1, [&](std::size_t r0, std::size_t r1) {
+            for (std::size_t r = r0; r < r1; ++r) {
+                jobs.parallelFor(64, 8, [&, r](std::size_t c0, std::size_t c1) {
+                    for (std::size_t c = c0; c < c1; ++c) grid[r * 64 + c] += static_cast<int>(r + c);
+                });
+            }
+        });
+        for (std::size_t i = 0; i < grid.size(); ++i) REQUIRE(grid[i] == static_cast<int>(i / 64 + i % 64));
+    }
+}
+
+TEST_CASE("Parallel grid, targeting and flow fields match the serial results", "[jobs]") {
+    JobSystem jobs(4);
+
+    // 100k ennemis, 2000 tours sur une zone 256x256
+    EnemyStore e;
+    std::uint32_t s = 3u;
+    for (int i = 0; i < 100'000; ++i) {
+        EnemySpawn sp;
+        sp.x  = static_cast<float>(lcg(s) % 25600u) / 100.f;
+        sp.y  = static_cast<float>(lcg(s) % 25600u) / 100.f;
+        sp.hp = static_cast<float>(1 + lcg(s) % 100u);
+        e.spawn(sp);
+        e.progress.back() = static_cast<float>(lcg(s) % 1000u);
+    }
+    TowerStore towers;
+    for (int i = 0; i < 2000; ++i) {
+        TowerSpec t;
+        t.x    = static_cast<float>(lcg(s) % 256u) + 0.5f;
+        t.y    = static_cast<float>(lcg(s) % 256u) + 0.5f;
+        t.mode = static_cast<TargetMode>(i % 3);
+        towers.build(t);
+    }
+    TowerStore parallelTowers = towers;
+
+    SpatialGrid serial, parallel;
+    serial.configure(256.f, 256.f, 3.f);
+    parallel.configure(256.f, 256.f, 3.f);
+    serial.rebuild(e);
+    parallel.rebuild(e, &jobs);
+    std::vector<std::uint32_t> a, b;
+    for (int q = 0; q < 200; ++q) {
+        const float x = static_cast<float>(lcg(s) % 256u), y = static_cast<float>(lcg(s) % 256u);
+        serial.queryRange(x, y, 4.f, a);
+        parallel.queryRange(x, y, 4.f, b);
+        REQUIRE(a == b); // même ordre, pas seulement même ensemble
+    }
+    acquireTargets(towers, e, serial);
+    acquireTargets(parallelTowers, e, parallel, &jobs);
+    REQUIRE(towers.target == parallelTowers.target);
+
+    // Carte à 6 sorties : construction puis réparation, un champ par tâche
+    GridMap map(96, 64);
+    for (int k = 0; k < 6; ++k) map.exits.push_back(Cell{95, 5 + k * 10});
+    map.spawns = {Cell{0, 32}};
+    for (int y = 10; y < 54; ++y) map.blocked[map.index(40, y)] = 1;
+    GridMap mapSerial = map;
+    FlowFieldSet fs, fp;
+    fs.build(mapSerial);
+    fp.build(map, &jobs);
+    fs.setBlocked(mapSerial, Cell{40, 9}, true);
+    fp.setBlocked(map, Cell{40, 9}, true, &jobs);
+    REQUIRE(fp.fields.size() == 6);
+    for (std::size_t k = 0; k < fs.fields.size(); ++k) {
+        for (int y = 0; y < map.height; ++y) {
+            for (int x = 0; x < map.width; ++x) {
+                REQUIRE(fs.fields[k].distance(x, y) == fp.fields[k].distance(x, y));
+                REQUIRE(fs.fields[k].direction(x, y) == fp.fields[k].direction(x, y));
+            }
+        }
+    }
+}
+
+TEST_CASE("A game hashes the same with any number of job threads", "[jobs]") {
+    GameSetup setup;
+    setup.seed     = 8;
+    setup.maxWaves = 8;
+    Game serial(setup);
+    serial.run();
+    for (unsigned threads : {1u, 2u, 8u}) {
+        JobSystem jobs(threads);
+        Game g(setup, nullptr, &jobs);
+        g.run();
+        REQUIRE(g.stateHash() == serial.stateHash());
+        REQUIRE(g.result().kills == serial.result().kills);
+    }
+}
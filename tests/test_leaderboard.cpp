@@ -0,0 +1,243 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "sim/Leaderboard.hpp"
+#include "sim/Rng.hpp"
+
+namespace {
+
+// Fichier temporaire effacé à la destruction
+struct TempFile {
+    std::filesystem::path path;
+    explicit TempFile(const char* name) : path(std::filesystem::temp_directory_path() / name) {
+        std::filesystem::remove(path);
+    }
+    ~TempFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        std::filesystem::remove(path.string() + ".tmp", ec);
+        std::filesystem::remove(path.string() + ".bad", ec);
+    }
+};
+
+ScoreEntry entry(const char* difficulty, std::uint64_t score, int i) {
+    ScoreEntry e;
+    e.name       = "player" + std::to_string(i);
+    e.difficulty = difficulty;
+    e.score      = score;
+    e.waves      = static_cast<std::uint32_t>(i % 40);
+    e.seed       = static_cast<std::uint64_t>(i) * 31u;
+    e.time       = 1'700'000'000 + i;
+    return e;
+}
+
+} // namespace
+
+TEST_CASE("ScoreIndex: rank and top match a sorted list", "[leaderboard]") {
+    ScoreIndex index;
+    Rng rng(3);
+    std::vector<std::vector<std::pair<std::uint64_t, std::uint32_t>>> ref(3);
+    for (std::uint32_t id = 0; id < 2000; ++id) {
+        const auto d     = static_cast<std::uint16_t>(rng.below(3));
+        const auto score = static_cast<std::uint64_t>(rng.below(500)); // beaucoup d'ex aequo
+        index.insert(id, d, score);
+        ref[d].push_back({score, id});
+    }
+    for (std::uint16_t d = 0; d < 3; ++d) {
+        auto& r = ref[d];
+        std::sort(r.begin(), r.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first || (a.first == b.first && a.second < b.second);
+        });
+        REQUIRE(index.count(d) == r.size());
+
+        std::vector<std::uint32_t> top;
+        index.top(d, 25, top);
+        REQUIRE(top.size() == 25);
+        for (std::size_t i = 0; i < top.size(); ++i) REQUIRE(top[i] == r[i].second);
+
+        for (const std::uint64_t s : {0ull, 1ull, 250ull, 499ull, 1000ull}) {
+            const auto better = std::count_if(r.begin(), r.end(), [s](const auto& e) { return e.first > s; });
+            REQUIRE(index.rank(d, s) == static_cast<std::size_t>(better) + 1);
+        }
+    }
+    std::vector<std::uint32_t> none;
+    index.top(7, 10, none);
+    REQUIRE(none.empty());
+    REQUIRE(index.rank(7, 10) == 1);
+}
+
+TEST_CASE("Leaderboard: scores survive a reopen", "[leaderboard]") {
+    TempFile file("td_leaderboard_reopen.tdlb");
+    {
+        Leaderboard board;
+        REQUIRE(board.open(file.path.string()));
+        REQUIRE(board.submit(entry("Normal", 300, 0)));
+        REQUIRE(board.submit(entry("Normal", 900, 1)));
+        REQUIRE(board.submit(entry("Hard", 500, 2)));
+        REQUIRE(board.submit(entry("Normal", 300, 3)));
+    }
+    Leaderboard board;
+    REQUIRE(board.open(file.path.string()));
+    REQUIRE(board.size() == 4);
+    REQUIRE(board.count("Normal") == 3);
+    const auto top = board.top("Normal", 10);
+    REQUIRE(top.size() == 3);
+    REQUIRE(top[0]->name == "player1");
+    REQUIRE(top[1]->name == "player0"); // ex aequo : le premier arrivé devant
+    REQUIRE(top[2]->name == "player3");
+    REQUIRE(top[0]->seed == 31u);
+    REQUIRE(top[0]->time == 1'700'000'001);
+    REQUIRE(board.rank("Normal", 500) == 2);
+    REQUIRE(board.rank("Easy", 500) == 1);
+}
+
+TEST_CASE("Leaderboard: an interrupted write only loses the last record", "[leaderboard]") {
+    TempFile file("td_leaderboard_torn.tdlb");
+    {
+        Leaderboard board;
+        REQUIRE(board.open(file.path.string()));
+        for (int i = 0; i < 10; ++i) REQUIRE(board.submit(entry("Easy", 100u + i, i)));
+    }
+    // Arrêt au milieu du dernier enregistrement
+    const auto full = std::filesystem::file_size(file.path);
+    std::filesystem::resize_file(file.path, full - 5);
+    {
+        Leaderboard board;
+        REQUIRE(board.open(file.path.string()));
+        REQUIRE(board.size() == 9);
+        REQUIRE(board.submit(entry("Easy", 5000, 42)));
+    }
+    // Octets quelconques en fin de fichier : ignorés eux aussi
+    {
+        std::ofstream os(file.path, std::ios::binary | std::ios::app);
+        os.write("\x10\x00\x00\x00garbage", 11);
+    }
+    Leaderboard board;
+    REQUIRE(board.open(file.path.string()));
+    REQUIRE(board.size() == 10);
+    REQUIRE(board.top("Easy", 1)[0]->name == "player42");
+}
+
+TEST_CASE("Leaderboard: a damaged record in the middle only loses itself", "[leaderboard]") {
+    TempFile file("td_leaderboard_damaged.tdlb");
+    {
+        Leaderboard board;
+        REQUIRE(board.open(file.path.string()));
+        for (int i = 0; i < 20; ++i) REQUIRE(board.submit(entry("Easy", 100u + i, i)));
+    }
+    // Un octet du 6e enregistrement retourné
+    const auto full = std::filesystem::file_size(file.path);
+    {
+        std::fstream fs(file.path, std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(static_cast<std::streamoff>(full * 6 / 20));
+        const char c = static_cast<char>(fs.peek());
+        fs.put(static_cast<char>(c ^ 0x5A));
+    }
+    {
+        Leaderboard board;
+        REQUIRE(board.open(file.path.string()));
+        REQUIRE(board.size() == 19);
+        REQUIRE(board.top("Easy", 1)[0]->name == "player19");
+        REQUIRE(std::filesystem::file_size(file.path.string() + ".bad") == full);
+        REQUIRE(board.submit(entry("Easy", 5000, 42)));
+    }
+    // Journal réécrit propre : plus rien à récupérer
+    std::filesystem::remove(file.path.string() + ".bad");
+    Leaderboard board;
+    REQUIRE(board.open(file.path.string()));
+    REQUIRE(board.size() == 20);
+    REQUIRE_FALSE(std::filesystem::exists(file.path.string() + ".bad"));
+}
+
+TEST_CASE("Leaderboard: refuses a file that is not a score log", "[leaderboard]") {
+    TempFile file("td_leaderboard_foreign.tdlb");
+    {
+        std::ofstream os(file.path);
+        os << "{ \"scores\": [] }";
+    }
+    Leaderboard board;
+    REQUIRE_FALSE(board.open(file.path.string()));
+    REQUIRE(std::filesystem::file_size(file.path) == 16); // intact
+}
+
+TEST_CASE("Leaderboard: compaction keeps the best scores per difficulty", "[leaderboard]") {
+    TempFile file("td_leaderboard_compact.tdlb");
+    Leaderboard board(100);
+    REQUIRE(board.open(file.path.string()));
+    Rng rng(8);
+    std::vector<std::uint64_t> normal;
+    for (int i = 0; i < 5000; ++i) {
+        const bool hard = i % 5 == 0;
+        const std::uint64_t s = rng.below(1'000'000);
+        if (!hard) normal.push_back(s);
+        REQUIRE(board.submit(entry(hard ? "Hard" : "Normal", s, i)));
+    }
+    // Compactée automatiquement une fois 4096 scores à écarter
+    REQUIRE(board.size() < 5000);
+    REQUIRE(board.compact());
+    REQUIRE(board.size() == 200);
+
+    std::sort(normal.begin(), normal.end(), std::greater<>());
+    const auto top = board.top("Normal", 100);
+    REQUIRE(top.size() == 100);
+    for (std::size_t i = 0; i < top.size(); ++i) REQUIRE(top[i]->score == normal[i]);
+
+    Leaderboard reopened(100);
+    REQUIRE(reopened.open(file.path.string()));
+    REQUIRE(reopened.size() == 200);
+    REQUIRE(reopened.top("Normal", 1)[0]->score == normal[0]);
+}
+
+TEST_CASE("Leaderboard: a batch submit past the threshold compacts too", "[leaderboard]") {
+    TempFile file("td_leaderboard_batch.tdlb");
+    std::vector<ScoreEntry> batch;
+    for (int i = 0; i < 3000; ++i) batch.push_back(entry("Normal", static_cast<std::uint64_t>(i), i));
+    std::uintmax_t uncompacted = 0;
+    {
+        Leaderboard board(50);
+        REQUIRE(board.open(file.path.string()));
+        REQUIRE(board.submit(batch)); // 3000 : sous le seuil
+        REQUIRE(board.size() == 3000);
+        uncompacted = std::filesystem::file_size(file.path);
+    }
+
+    // Le chemin du serveur : des lots, jamais submit(ScoreEntry)
+    Leaderboard board(50);
+    REQUIRE(board.open(file.path.string()));
+    REQUIRE(board.submit(batch));
+    REQUIRE(board.size() == 50);
+    REQUIRE(board.top("Normal", 1)[0]->score == 2999);
+    REQUIRE(std::filesystem::file_size(file.path) < uncompacted / 10);
+
+    Leaderboard reopened(50);
+    REQUIRE(reopened.open(file.path.string()));
+    REQUIRE(reopened.size() == 50);
+}
+
+TEST_CASE("Leaderboard: migration from scores.json", "[leaderboard]") {
+    TempFile json("td_leaderboard_scores.json");
+    TempFile file("td_leaderboard_migrated.tdlb");
+    {
+        std::ofstream os(json.path);
+        os << R"({ "scores": [
+            { "name": "ana", "difficulty": "Hard", "score": 1200, "waves": 14, "seed": 7 },
+            { "name": "bob", "difficulty": "Hard", "score": 2400, "waves": 20 },
+            { "name": "no difficulty", "score": 5 },
+            { "name": "cyd", "difficulty": "Easy", "score": 10, "time": 1700000000 }
+        ] })";
+    }
+    Leaderboard board;
+    REQUIRE(board.open(file.path.string()));
+    REQUIRE(migrateScoresJson(json.path.string(), board) == 3);
+    REQUIRE(board.top("Hard", 1)[0]->name == "bob");
+    REQUIRE(board.top("Hard", 2)[1]->seed == 7);
+    REQUIRE(board.top("Easy", 1)[0]->time == 1'700'000'000);
+
+    Leaderboard reopened;
+    REQUIRE(reopened.open(file.path.string()));
+    REQUIRE(reopened.size() == 3);
+    REQUIRE(migrateScoresJson(TD_CONFIG_DIR "/scores.json", reopened) == 0);
+}
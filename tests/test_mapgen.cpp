@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include "sim/FlowField.hpp"
+#include "sim/Game.hpp"
+#include "sim/MapGen.hpp"
+
+namespace {
+
+bool sameMap(const GridMap& a, const GridMap& b) {
+    return a.width == b.width && a.height == b.height && a.blocked == b.blocked &&
+           a.spawns == b.spawns && a.exits == b.exits;
+}
+
+// Dossier temporaire vidé à la destruction
+struct TempDir {
+    std::filesystem::path path;
+    TempDir() : path(std::filesystem::temp_directory_path() / "td_mapgen_test") {
+        std::filesystem::remove_all(path);
+    }
+    ~TempDir() { std::error_code ec; std::filesystem::remove_all(path, ec); }
+};
+
+} // namespace
+
+TEST_CASE("MapGen: same seed gives the same map whatever the thread count", "[mapgen]") {
+    MapGenParams params;
+    params.width  = 64;
+    params.height = 48;
+    params.obstaclePercent = 25; // des rejets à coup sûr
+    for (std::uint64_t seed = 1; seed <= 20; ++seed) {
+        GridMap serial, parallel;
+        MapGenStats s1, s4;
+        REQUIRE(generateMap(params, seed, serial, &s1, 1));
+        REQUIRE(generateMap(params, seed, parallel, &s4, 4));
+        REQUIRE(sameMap(serial, parallel));
+        REQUIRE(s1.attempt == s4.attempt);
+        REQUIRE(s1.candidates == s1.attempt + 1);
+    }
+}
+
+TEST_CASE("MapGen: accepted maps connect every spawn with a long enough path", "[mapgen]") {
+    MapGenParams params;
+    params.width  = 40;
+    params.height = 30;
+    for (std::uint64_t seed = 100; seed < 130; ++seed) {
+        GridMap m;
+        REQUIRE(generateMap(params, seed, m));
+        FlowFieldSet fields;
+        fields.build(m);
+        for (const Cell& s : m.spawns) {
+            REQUIRE(m.passable(s));
+            const int goal = fields.nearestExit(s);
+            REQUIRE(goal >= 0);
+            REQUIRE(fields.fields[static_cast<std::size_t>(goal)].distance(s) >= static_cast<std::uint32_t>(params.pathLength()));
+        }
+    }
+}
+
+TEST_CASE("MapGen: validation rejects cut-off and too short maps", "[mapgen]") {
+    // 7x5, spawn (0,2), sortie (6,2) : 6 cases en ligne droite
+    GridMap m(7, 5);
+    m.spawns.push_back(Cell{0, 2});
+    m.exits.push_back(Cell{6, 2});
+    MapCheckScratch scratch;
+    REQUIRE(validateMap(m, 6, scratch) == 6);
+    REQUIRE(validateMap(m, 7, scratch) == -1);
+
+    // Mur complet en x = 3
+    for (int y = 0; y < 5; ++y) m.blocked[m.index(3, y)] = 1;
+    REQUIRE(validateMap(m, 0, scratch) == -1);
+
+    // Passage en bas : 2 + 6 + 2 = 10 ; un second spawn coupé rejette tout
+    m.blocked[m.index(3, 4)] = 0;
+    REQUIRE(validateMap(m, 10, scratch) == 10);
+    m.spawns.push_back(Cell{1, 0});
+    m.blocked[m.index(0, 0)] = 1;
+    m.blocked[m.index(1, 1)] = 1;
+    m.blocked[m.index(2, 0)] = 1;
+    REQUIRE(validateMap(m, 0, scratch) == -1);
+}
+
+TEST_CASE("MapGen: impossible parameters fall back to an open map", "[mapgen]") {
+    MapGenParams params;
+    params.minPathLength = 10'000;
+    params.maxAttempts   = 8;
+    GridMap m;
+    MapGenStats stats;
+    REQUIRE_FALSE(generateMap(params, 3, m, &stats, 2));
+    REQUIRE(stats.rejected == 8);
+    REQUIRE(m.width == params.width);
+    REQUIRE_FALSE(m.spawns.empty());
+    REQUIRE_FALSE(m.exits.empty());
+    for (const auto b : m.blocked) REQUIRE(b == 0);
+}
+
+TEST_CASE("MapCache: round trip, key mismatch and corrupt files", "[mapgen]") {
+    TempDir dir;
+    const MapCache cache(dir.path.string());
+    MapGenParams params;
+    GridMap map;
+    REQUIRE(generateMap(params, 77, map));
+
+    GridMap loaded;
+    REQUIRE_FALSE(cache.load(params, 77, loaded));
+    REQUIRE(cache.store(params, 77, map));
+    REQUIRE(cache.load(params, 77, loaded));
+    REQUIRE(sameMap(map, loaded));
+
+    // Autres paramètres : autre fichier
+    MapGenParams other = params;
+    other.obstaclePercent = 20;
+    REQUIRE(cache.pathFor(other, 77) != cache.pathFor(params, 77));
+    REQUIRE_FALSE(cache.load(other, 77, loaded));
+
+    // Un octet modifié : rejeté, puis régénéré par loadOrGenerate
+    const std::string path = cache.pathFor(params, 77);
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekg(30);
+        const char c = static_cast<char>(f.get());
+        f.seekp(30);
+        f.put(static_cast<char>(c ^ 0x5A));
+    }
+    REQUIRE_FALSE(cache.load(params, 77, loaded));
+    bool hit = true;
+    REQUIRE(sameMap(cache.loadOrGenerate(params, 77, 2, &hit), map));
+    REQUIRE_FALSE(hit);
+    REQUIRE(sameMap(cache.loadOrGenerate(params, 77, 2, &hit), map));
+    REQUIRE(hit);
+}
+
+TEST_CASE("MapCache: a fallback map is not cached", "[mapgen]") {
+    TempDir dir;
+    const MapCache cache(dir.path.string());
+    MapGenParams params;
+    params.minPathLength = 10'000;
+    params.maxAttempts   = 4;
+    bool hit = true;
+    const GridMap m = cache.loadOrGenerate(params, 5, 1, &hit);
+    REQUIRE_FALSE(hit);
+    REQUIRE_FALSE(m.spawns.empty());
+    REQUIRE_FALSE(std::filesystem::exists(cache.pathFor(params, 5)));
+    cache.loadOrGenerate(params, 5, 1, &hit);
+    REQUIRE_FALSE(hit); // retentée, pas relue
+}
+
+TEST_CASE("MapGen: a game on a cached map plays out like a fresh one", "[mapgen]") {
+    GameSetup setup;
+    setup.seed     = 11;
+    setup.maxWaves = 3;
+    GridMap map;
+    generateMap(Game::mapParams(setup), setup.seed, map, nullptr, 4);
+
+    Game fresh(setup);
+    Game premade(setup, &map);
+    REQUIRE(sameMap(fresh.map(), map));
+    const GameResult a = fresh.run();
+    const GameResult b = premade.run();
+    REQUIRE(a.ticks == b.ticks);
+    REQUIRE(fresh.stateHash() == premade.stateHash());
+}
@@ -0,0 +1,194 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "sim/Json.hpp"
+#include "sim/Profiler.hpp"
+
+namespace {
+
+// Temps mesurable sans dormir (un sleep rend le test lent et instable)
+void spin(std::int64_t ns) {
+    const std::int64_t end = Profiler::nowNs() + ns;
+    while (Profiler::nowNs() < end) {}
+}
+
+std::size_t countNamed(const std::vector<ProfileEvent>& events, const std::string& name) {
+    std::size_t n = 0;
+    for (const auto& e : events) n += name == e.name;
+    return n;
+}
+
+// Ferme une portée dans son destructeur ; construit avant le premier
+// événement du thread, il est détruit après le propriétaire du tampon
+struct LateScope {
+    bool armed = false;
+    ~LateScope() {
+        if (!armed) return;
+        PROFILE_SCOPE("test::late");
+    }
+};
+thread_local LateScope tlLate;
+
+} // namespace
+
+TEST_CASE("Disabled profiler records nothing", "[profiler]") {
+    Profiler::setEnabled(false);
+    Profiler::clear();
+    {
+        PROFILE_SCOPE("test::disabled");
+    }
+    REQUIRE(countNamed(Profiler::collect(), "test::disabled") == 0);
+}
+
+TEST_CASE("Nested scopes keep depth and self time", "[profiler]") {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    for (int i = 0; i < 3; ++i) {
+        PROFILE_SCOPE("test::outer");
+        spin(200'000);
+        {
+            PROFILE_SCOPE("test::inner");
+            spin(400'000);
+        }
+    }
+    Profiler::setEnabled(false);
+
+    const auto events = Profiler::collect();
+    REQUIRE(countNamed(events, "test::outer") == 3);
+    REQUIRE(countNamed(events, "test::inner") == 3);
+    for (const auto& e : events) {
+        if (std::string(e.name) == "test::outer") REQUIRE(e.depth == 0);
+        if (std::string(e.name) == "test::inner") REQUIRE(e.depth == 1);
+    }
+
+    const auto top = Profiler::topScopes(events, 10);
+    REQUIRE(top.size() == 2);
+    REQUIRE(std::string(top[0].name) == "test::outer");
+    REQUIRE(top[0].calls == 3);
+    REQUIRE(top[0].totalMs >= top[1].totalMs);
+    // L'externe ne garde que son propre temps : ~0.2 ms sur ~0.6 ms par appel
+    REQUIRE(top[0].selfMs < top[0].totalMs - top[1].totalMs * 0.99);
+    REQUIRE(top[1].selfMs == top[1].totalMs);
+}
+
+TEST_CASE("Each thread records into its own ring", "[profiler]") {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    {
+        PROFILE_SCOPE("test::main");
+        std::thread t([] {
+            Profiler::setThreadName("test worker");
+            PROFILE_SCOPE("test::worker");
+            spin(50'000);
+        });
+        t.join();
+    }
+    Profiler::setEnabled(false);
+
+    const auto events = Profiler::collect();
+    std::uint32_t mainThread = 0, workerThread = 0;
+    for (const auto& e : events) {
+        if (std::string(e.name) == "test::main")   mainThread   = e.thread;
+        if (std::string(e.name) == "test::worker") workerThread = e.thread;
+    }
+    REQUIRE(countNamed(events, "test::worker") == 1);
+    REQUIRE(mainThread != workerThread);
+}
+
+TEST_CASE("Exited threads keep their events and name, idle ones leave no trace", "[profiler]") {
+    Profiler::setEnabled(false);
+    std::thread([] { Profiler::setThreadName("test idle"); }).join();
+
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    std::thread([] {
+        Profiler::setThreadName("test exited");
+        for (int i = 0; i < 3; ++i) {
+            PROFILE_SCOPE("test::exited");
+        }
+    }).join();
+    Profiler::setEnabled(false);
+
+    const auto events = Profiler::collect();
+    REQUIRE(countNamed(events, "test::exited") == 3);
+    std::ostringstream os;
+    Profiler::writeChromeTrace(os, events);
+    REQUIRE(os.str().find("\"test exited\"") != std::string::npos);
+    REQUIRE(os.str().find("\"test idle\"") == std::string::npos); // jamais mesuré : pas de tampon
+}
+
+TEST_CASE("A scope closed after the thread's ring is released is dropped", "[profiler]") {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    std::thread([] {
+        tlLate.armed = true;
+        PROFILE_SCOPE("test::early");
+    }).join();
+    Profiler::setEnabled(false);
+
+    const auto events = Profiler::collect();
+    REQUIRE(countNamed(events, "test::early") == 1);
+    REQUIRE(countNamed(events, "test::late") == 0); // ni tampon recréé, ni événement
+}
+
+TEST_CASE("Ring keeps only the newest events", "[profiler]") {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    const std::size_t total = Profiler::kRingSize + 100;
+    for (std::size_t i = 0; i < total; ++i) {
+        PROFILE_SCOPE("test::ring");
+    }
+    Profiler::setEnabled(false);
+
+    const auto events = Profiler::collect();
+    REQUIRE(countNamed(events, "test::ring") == Profiler::kRingSize);
+    REQUIRE(Profiler::collect(Profiler::nowNs()).empty());
+}
+
+TEST_CASE("Chrome trace is valid JSON with complete events", "[profiler]") {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    {
+        PROFILE_SCOPE("test::\"quoted\"");
+        spin(10'000);
+    }
+    Profiler::setEnabled(false);
+
+    std::ostringstream os;
+    Profiler::writeChromeTrace(os, Profiler::collect());
+
+    JsonValue trace;
+    std::string err;
+    REQUIRE(parseJson(os.str(), trace, &err));
+    const JsonValue* list = trace.find("traceEvents");
+    REQUIRE(list);
+    bool found = false;
+    for (const JsonValue& e : list->items()) {
+        if (e.find("ph")->asString() != "X") continue;
+        REQUIRE(e.find("name")->asString() == "test::\"quoted\"");
+        REQUIRE(e.number("dur", 0.0) >= 10.0); // µs
+        found = true;
+    }
+    REQUIRE(found);
+}
+
+TEST_CASE("Frame times track the rolling 99th percentile", "[profiler]") {
+    FrameTimes ft;
+    REQUIRE(ft.percentile(0.99f, 10) == 0.f);
+    for (int i = 0; i < 99; ++i) ft.push(16.f);
+    ft.push(50.f);
+    REQUIRE(ft.last() == 50.f);
+    REQUIRE(ft.percentile(0.99f, 100) == 16.f);
+    REQUIRE(ft.percentile(1.f, 100) == 50.f);
+    REQUIRE(ft.lastP99() == 16.f); // 1 pic sur 100 frames : c'est le 1 % écarté
+    ft.push(50.f);
+    REQUIRE(ft.lastP99() == 50.f);
+
+    for (std::size_t i = 0; i < FrameTimes::kHistory; ++i) ft.push(8.f);
+    REQUIRE(ft.size() == FrameTimes::kHistory);
+    REQUIRE(ft.lastP99() == 8.f);
+    REQUIRE(ft.average() == 8.f);
+}
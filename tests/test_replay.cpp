@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sim/Replay.hpp"
+
+namespace {
+
+GameSetup smallGame(std::uint64_t seed) {
+    GameSetup s;
+    s.seed = seed;
+    s.difficulty.name       = "Normal";
+    s.difficulty.livesStart = 10;
+    s.maxWaves = 8;
+    return s;
+}
+
+// Joue une partie en enregistrant les commandes appliquées
+ReplayLog record(const GameSetup& setup, const std::vector<GameCommand>& extra = {}) {
+    ReplayLog log;
+    log.setup = setup;
+    Game game(setup);
+    game.setCommandSink([&log](const GameCommand& c) { log.commands.push_back(c); });
+    std::size_t next = 0;
+    while (!game.over()) {
+        while (next < extra.size() && extra[next].tick == game.tick()) game.submit(extra[next++]);
+        game.step();
+    }
+    log.finalTick = game.tick();
+    log.finalHash = game.stateHash();
+    return log;
+}
+
+} // namespace
+
+TEST_CASE("Replay of an auto-played game reproduces the final state", "[replay]") {
+    const ReplayLog log = record(smallGame(5));
+    REQUIRE_FALSE(log.commands.empty());
+
+    std::vector<std::uint8_t> bytes;
+    encodeReplay(log, bytes);
+    REQUIRE(bytes.size() < 64 + log.commands.size() * 8); // compact
+
+    ReplayLog decoded;
+    REQUIRE(decodeReplay(bytes.data(), bytes.size(), decoded));
+    REQUIRE(decoded.commands == log.commands);
+    REQUIRE(decoded.finalHash == log.finalHash);
+    REQUIRE_FALSE(decoded.setup.autoPlayer);
+
+    const ReplayCheck c = verifyReplay(decoded);
+    REQUIRE(c.ok);
+    REQUIRE(c.ticks == log.finalTick);
+
+    // Tronqué (pas de pied) : refusé
+    REQUIRE_FALSE(decodeReplay(bytes.data(), bytes.size() - 9, decoded));
+}
+
+TEST_CASE("Manual commands replay and tampering is detected", "[replay]") {
+    GameSetup setup = smallGame(9);
+    setup.autoPlayer = false;
+    const Game probe(setup);
+    const GridMap& m = probe.map();
+
+    // Quelques poses sur des cases libres (certaines peuvent être refusées),
+    // une vente, un changement de mode puis un départ anticipé de vague
+    std::vector<GameCommand> cmds;
+    Cell placed{-1, -1};
+    for (int y = 0; y < m.height && cmds.size() < 2; ++y) {
+        for (int x = 2; x < m.width - 2 && cmds.size() < 2; x += 3) {
+            if (!m.passable(x, y)) continue;
+            cmds.push_back(GameCommand{0, CommandType::PlaceTower, 0, static_cast<std::int16_t>(x), static_cast<std::int16_t>(y)});
+            placed = Cell{x, y};
+        }
+    }
+    cmds.push_back(GameCommand{10, CommandType::SetTargetMode, 2, static_cast<std::int16_t>(placed.x), static_cast<std::int16_t>(placed.y)});
+    cmds.push_back(GameCommand{20, CommandType::StartWave, 0, 0, 0});
+    cmds.push_back(GameCommand{900, CommandType::SellTower, 0, static_cast<std::int16_t>(placed.x), static_cast<std::int16_t>(placed.y)});
+
+    ReplayLog log = record(setup, cmds);
+    REQUIRE(log.commands.size() >= 3);
+    REQUIRE(verifyReplay(log).ok);
+
+    // Journal altéré (une pose retirée) : l'empreinte finale diffère
+    log.commands.erase(log.commands.begin());
+    REQUIRE_FALSE(verifyReplay(log).ok);
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sim/ScoreProtocol.hpp"
+
+namespace {
+
+ScoreEntry entry(const char* name, const char* difficulty, std::uint64_t score) {
+    ScoreEntry e;
+    e.name       = name;
+    e.difficulty = difficulty;
+    e.score      = score;
+    e.waves      = 12;
+    e.seed       = 99;
+    e.time       = -5;
+    return e;
+}
+
+} // namespace
+
+TEST_CASE("ScoreProtocol: messages survive byte-by-byte delivery", "[leaderboard]") {
+    const std::vector<ScoreEntry> batch = {entry("ana", "Hard", 1200), entry("bob", "Easy", 7)};
+    const ScoreEntry top1 = entry("cyd", "Normal", 5000);
+
+    std::vector<std::uint8_t> wire;
+    encodeSubmit(batch.data(), batch.size(), wire);
+    encodeTopQuery("Normal", 10, wire);
+    encodeSubmitAck(2, wire);
+    encodeTopReply("Normal", 42, {&top1}, wire);
+
+    MessageBuffer in;
+    std::vector<ScoreMessageView> got;
+    std::vector<std::vector<std::uint8_t>> bodies; // copies : une vue ne survit pas à append
+    for (const std::uint8_t b : wire) {
+        in.append(&b, 1);
+        ScoreMessageView m;
+        while (in.next(m)) {
+            got.push_back(m);
+            bodies.emplace_back(m.body, m.body + m.size);
+        }
+    }
+    REQUIRE_FALSE(in.error());
+    REQUIRE(got.size() == 4);
+    for (std::size_t i = 0; i < got.size(); ++i) got[i].body = bodies[i].data();
+
+    std::vector<ScoreEntry> scores;
+    REQUIRE(decodeSubmit(got[0], scores));
+    REQUIRE(scores.size() == 2);
+    REQUIRE(scores[0].name == "ana");
+    REQUIRE(scores[0].time == -5);
+    REQUIRE(scores[1].difficulty == "Easy");
+
+    std::string   difficulty;
+    std::uint32_t n = 0;
+    REQUIRE(decodeTopQuery(got[1], difficulty, n));
+    REQUIRE(difficulty == "Normal");
+    REQUIRE(n == 10);
+
+    std::uint32_t accepted = 0;
+    REQUIRE(decodeSubmitAck(got[2], accepted));
+    REQUIRE(accepted == 2);
+    REQUIRE_FALSE(decodeTopQuery(got[2], difficulty, n)); // mauvais type
+
+    std::uint64_t total = 0;
+    REQUIRE(decodeTopReply(got[3], difficulty, total, scores));
+    REQUIRE(total == 42);
+    REQUIRE(scores.size() == 1);
+    REQUIRE(scores[0].score == 5000);
+}
+
+TEST_CASE("ScoreProtocol: bad frames are reported, truncated bodies rejected", "[leaderboard]") {
+    MessageBuffer in;
+    const std::uint8_t unknownType[] = {1, 0, 0, 0, 9};
+    in.append(unknownType, sizeof(unknownType));
+    ScoreMessageView m;
+    REQUIRE_FALSE(in.next(m));
+    REQUIRE(in.error());
+
+    in.clear();
+    const std::uint8_t huge[] = {0xFF, 0xFF, 0xFF, 0x7F, 1};
+    in.append(huge, sizeof(huge));
+    REQUIRE_FALSE(in.next(m));
+    REQUIRE(in.error());
+
+    // Corps annonçant 3 scores pour un seul présent
+    const ScoreEntry e = entry("ana", "Hard", 1);
+    std::vector<std::uint8_t> wire;
+    encodeSubmit(&e, 1, wire);
+    wire[5] = 3;
+    in.clear();
+    in.append(wire.data(), wire.size());
+    REQUIRE(in.next(m));
+    std::vector<ScoreEntry> scores;
+    REQUIRE_FALSE(decodeSubmit(m, scores));
+}
+
+TEST_CASE("Backoff: doubles up to the cap, with jitter in [d/2, d]", "[leaderboard]") {
+    const Backoff b{100, 1000};
+    Rng rng(1);
+    for (int i = 0; i < 200; ++i) {
+        const std::uint32_t first = b.delayMs(1, rng);
+        REQUIRE(first >= 50);
+        REQUIRE(first <= 100);
+        const std::uint32_t third = b.delayMs(3, rng);
+        REQUIRE(third >= 200);
+        REQUIRE(third <= 400);
+        const std::uint32_t late = b.delayMs(40, rng);
+        REQUIRE(late >= 500);
+        REQUIRE(late <= 1000);
+    }
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <vector>
+
+#include "sim/Game.hpp"
+#include "sim/Simd.hpp"
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+float         unit(std::uint32_t& s) { return static_cast<float>(lcg(s) % 10000u) / 10000.f; }
+
+template <class T>
+bool sameBits(const std::vector<T>& a, const std::vector<T>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+bool sameEnemies(const EnemyStore& a, const EnemyStore& b) {
+    return sameBits(a.posX, b.posX) && sameBits(a.posY, b.posY) && sameBits(a.velX, b.velX) &&
+           sameBits(a.velY, b.velY) && sameBits(a.progress, b.progress) && sameBits(a.pathIdx, b.pathIdx);
+}
+
+bool sameProjectiles(const ProjectileStore& a, const ProjectileStore& b) {
+    if (!(sameBits(a.posX, b.posX) && sameBits(a.posY, b.posY) && sameBits(a.ttl, b.ttl) &&
+          sameBits(a.damage, b.damage) && a.target == b.target && a.size() == b.size()))
+        return false;
+    for (std::uint32_t i = 0; i < a.size(); ++i)
+        if (!(a.ids.handleAt(i) == b.ids.handleAt(i))) return false;
+    return true;
+}
+
+bool sameHits(const std::vector<DamageHit>& a, const std::vector<DamageHit>& b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i)
+        if (!(a[i].target == b[i].target) || std::memcmp(&a[i].amount, &b[i].amount, sizeof(float)) != 0) return false;
+    return true;
+}
+
+// n ennemis autour d'un chemin court : certains pile sur un waypoint, d'autres
+// déjà au bout (ou au-delà), pour passer par toutes les branches
+EnemyStore makeEnemies(std::size_t n, const Path& path, std::uint32_t seed) {
+    EnemyStore e;
+    std::uint32_t s = seed;
+    for (std::size_t i = 0; i < n; ++i) {
+        EnemySpawn sp;
+        sp.x     = unit(s) * 20.f;
+        sp.y     = unit(s) * 20.f;
+        sp.speed = 0.5f + unit(s) * 400.f;
+        e.spawn(sp);
+        e.pathIdx.back() = lcg(s) % (path.size() + 3);
+        if (i % 7 == 0 && e.pathIdx.back() < path.size()) {
+            e.posX.back() = path.x[e.pathIdx.back()];
+            e.posY.back() = path.y[e.pathIdx.back()];
+        }
+        e.velX.back() = unit(s);
+        e.velY.back() = unit(s);
+    }
+    return e;
+}
+
+Path makePath() {
+    Path p;
+    for (int k = 0; k < 6; ++k) {
+        p.x.push_back(static_cast<float>(k) * 3.5f);
+        p.y.push_back(static_cast<float>(k % 2) * 7.25f);
+    }
+    return p;
+}
+
+} // namespace
+
+TEST_CASE("SIMD kernels match the scalar reference bit for bit", "[simd]") {
+    const Path       path = makePath();
+    const SimdLevel  best = detectSimd();
+    const SimdKernels& ref = simdKernels(SimdLevel::Scalar);
+
+    // Tailles autour des multiples de 4 et 8 : les queues comptent
+    for (std::size_t n : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 31u, 1000u, 1027u}) {
+        for (int lv = 1; lv <= static_cast<int>(best); ++lv) {
+            const SimdKernels& k = simdKernels(static_cast<SimdLevel>(lv));
+            REQUIRE(k.level == static_cast<SimdLevel>(lv));
+            INFO(simdName(k.level) << " n=" << n);
+
+            // Déplacement le long du chemin, plusieurs pas enchaînés
+            EnemyStore a = makeEnemies(n, path, 3u + static_cast<std::uint32_t>(n));
+            EnemyStore b = a;
+            std::vector<Handle> arrivedA, arrivedB;
+            for (int step = 0; step < 20; ++step) {
+                ref.moveAlongPath(a, path, Game::kDt, &arrivedA);
+                k.moveAlongPath(b, path, Game::kDt, &arrivedB);
+            }
+            REQUIRE(sameEnemies(a, b));
+            REQUIRE(arrivedA == arrivedB);
+
+            // Chemin vide : tout le monde est au bout
+            ref.moveAlongPath(a, Path{}, Game::kDt, nullptr);
+            k.moveAlongPath(b, Path{}, Game::kDt, nullptr);
+            REQUIRE(sameEnemies(a, b));
+
+            // Projectiles : une partie vise des ennemis détruits ensuite
+            ProjectileStore pa;
+            std::uint32_t   s = 17u;
+            std::vector<Handle> targets;
+            for (std::uint32_t i = 0; i < a.size(); ++i) targets.push_back(a.ids.handleAt(i));
+            for (std::size_t i = 0; i < n; ++i) {
+                ProjectileSpawn sp;
+                sp.target = targets.empty() ? Handle{} : targets[lcg(s) % targets.size()];
+                const std::uint32_t t = a.ids.denseIndex(sp.target);
+                const bool near = t != Handle::kInvalid && i % 3 != 0;
+                sp.x      = near ? a.posX[t] + (unit(s) - 0.5f) : unit(s) * 20.f;
+                sp.y      = near ? a.posY[t] + (unit(s) - 0.5f) : unit(s) * 20.f;
+                sp.vx     = unit(s) * 10.f - 5.f;
+                sp.vy     = unit(s) * 10.f - 5.f;
+                sp.damage = unit(s) * 50.f;
+                sp.ttl    = unit(s) * 0.05f;
+                pa.fire(sp);
+            }
+            for (std::size_t i = 0; i < targets.size(); i += 5) {
+                a.destroy(targets[i]);
+                b.destroy(targets[i]);
+            }
+            ProjectileStore pb = pa;
+
+            for (int step = 0; step < 3; ++step) {
+                ref.integrate(pa.posX.data(), pa.posY.data(), pa.velX.data(), pa.velY.data(), pa.ttl.data(), pa.size(), Game::kDt);
+                k.integrate(pb.posX.data(), pb.posY.data(), pb.velX.data(), pb.velY.data(), pb.ttl.data(), pb.size(), Game::kDt);
+            }
+            REQUIRE(sameProjectiles(pa, pb));
+
+            std::vector<DamageHit> hitsA, hitsB;
+            ref.resolveHits(pa, a, 0.35f, hitsA);
+            k.resolveHits(pb, b, 0.35f, hitsB);
+            REQUIRE(sameHits(hitsA, hitsB));
+            REQUIRE(sameProjectiles(pa, pb));
+        }
+    }
+}
+
+TEST_CASE("SIMD level selection and whole-game determinism", "[simd]") {
+    const SimdLevel initial = simdLevel();
+    REQUIRE(initial <= detectSimd());
+    REQUIRE(simdLanes(SimdLevel::Scalar) == 1);
+    REQUIRE(setSimdLevel(SimdLevel::Avx2) == detectSimd());
+
+    // Même partie, même empreinte quel que soit le niveau
+    GameSetup setup;
+    setup.seed     = 21;
+    setup.maxWaves = 6;
+    std::uint64_t hash = 0;
+    for (int lv = 0; lv <= static_cast<int>(detectSimd()); ++lv) {
+        REQUIRE(setSimdLevel(static_cast<SimdLevel>(lv)) == static_cast<SimdLevel>(lv));
+        REQUIRE(simdKernels().level == static_cast<SimdLevel>(lv));
+        Game g(setup);
+        g.run();
+        if (lv == 0) hash = g.stateHash();
+        REQUIRE(g.stateHash() == hash);
+    }
+    setSimdLevel(initial);
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "sim/SpatialGrid.hpp"
+
+namespace {
+
+std::uint32_t lcg(std::uint32_t& s) { s = s * 1664525u + 1013904223u; return s >> 8; }
+float frand(std::uint32_t& s, float max) { return static_cast<float>(lcg(s) % 100000u) / 100000.f * max; }
+
+} // namespace
+
+TEST_CASE("SpatialGrid range query matches brute force", "[targeting]") {
+    std::uint32_t s = 11u;
+    std::vector<float> x(3000), y(3000);
+    for (std::size_t i = 0; i < x.size(); ++i) { x[i] = frand(s, 64.f); y[i] = frand(s, 48.f); }
+    x[0] = -5.f; y[0] = 70.f; // hors zone : rangé au bord, toujours trouvé
+
+    SpatialGrid grid;
+    grid.configure(64.f, 48.f, 4.f);
+    grid.rebuild(x.data(), y.data(), x.size());
+
+    std::vector<std::uint32_t> got;
+    for (int q = 0; q < 200; ++q) {
+        const float qx = frand(s, 70.f) - 3.f, qy = frand(s, 54.f) - 3.f, r = 0.5f + frand(s, 9.f);
+        grid.queryRange(qx, qy, r, got);
+        std::sort(got.begin(), got.end());
+
+        std::vector<std::uint32_t> expected;
+        for (std::uint32_t i = 0; i < x.size(); ++i) {
+            const float dx = x[i] - qx, dy = y[i] - qy;
+            if (dx * dx + dy * dy <= r * r) expected.push_back(i);
+        }
+        REQUIRE(got == expected);
+    }
+}
+
+TEST_CASE("Target modes pick first, nearest and strongest", "[targeting]") {
+    EnemyStore e;
+    const Handle nearWeak  = e.spawn(EnemySpawn{5.5f, 5.f, 10.f, 1.f, 0, 0});
+    const Handle farStrong = e.spawn(EnemySpawn{7.5f, 5.f, 90.f, 1.f, 0, 0});
+    const Handle leader    = e.spawn(EnemySpawn{5.f, 7.f, 50.f, 1.f, 0, 0});
+    e.spawn(EnemySpawn{20.f, 20.f, 500.f, 1.f, 0, 0}); // hors de portée
+    e.progress[e.ids.denseIndex(leader)] = 12.f;
+
+    TowerStore t;
+    t.build(TowerSpec{5.f, 5.f, 3.f, 1.f, 1.f, TargetMode::First});
+    t.build(TowerSpec{5.f, 5.f, 3.f, 1.f, 1.f, TargetMode::Nearest});
+    t.build(TowerSpec{5.f, 5.f, 3.f, 1.f, 1.f, TargetMode::Strongest});
+    t.build(TowerSpec{40.f, 40.f, 3.f, 1.f, 1.f, TargetMode::Nearest});
+
+    SpatialGrid grid;
+    grid.configure(32.f, 32.f, 4.f);
+    grid.rebuild(e);
+    acquireTargets(t, e, grid);
+
+    REQUIRE(t.target[0] == leader);
+    REQUIRE(t.target[1] == nearWeak);
+    REQUIRE(t.target[2] == farStrong);
+    REQUIRE_FALSE(t.target[3].valid());
+
+    // Même résultat que la référence O(n*m)
+    TowerStore ref = t;
+    acquireTargetsBruteForce(ref, e);
+    REQUIRE(ref.target == t.target);
+}
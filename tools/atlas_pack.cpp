@@ -0,0 +1,109 @@
+// Empaquette les PNG d'un dossier (récursif) en pages d'atlas + index JSON
+// nom -> rectangle. Lancé par la cible CMake `atlas` à la compilation.
+//   td_atlas_pack assets/images build/atlas [--max 4096] [--padding 2]
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include "sim/Atlas.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Recopie les pixels du bord dans la marge : le filtrage linéaire ne
+// mélange pas l'image avec sa voisine
+void extrude(sf::Image& page, const AtlasEntry& e, int padding) {
+    auto px = [&](int x, int y) {
+        x = std::clamp(x, e.x, e.x + e.w - 1);
+        y = std::clamp(y, e.y, e.y + e.h - 1);
+        return page.getPixel({static_cast<unsigned>(x), static_cast<unsigned>(y)});
+    };
+    for (int y = e.y - padding; y < e.y + e.h + padding; ++y) {
+        for (int x = e.x - padding; x < e.x + e.w + padding; ++x) {
+            if (x >= e.x && x < e.x + e.w && y >= e.y && y < e.y + e.h) continue;
+            page.setPixel({static_cast<unsigned>(x), static_cast<unsigned>(y)}, px(x, y));
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: td_atlas_pack <images_dir> <out_dir> [--max N] [--padding N]\n";
+        return 2;
+    }
+    const fs::path inDir  = argv[1];
+    const fs::path outDir = argv[2];
+    int maxSize = 4096;
+    int padding = 2;
+    for (int i = 3; i + 1 < argc; i += 2) {
+        const std::string a = argv[i];
+        if      (a == "--max")     maxSize = std::stoi(argv[i + 1]);
+        else if (a == "--padding") padding = std::stoi(argv[i + 1]);
+        else { std::cerr << "unknown option " << a << "\n"; return 2; }
+    }
+
+    // Images sources, triées pour un résultat reproductible
+    std::vector<fs::path> files;
+    for (const auto& de : fs::recursive_directory_iterator(inDir)) {
+        if (de.is_regular_file() && de.path().extension() == ".png") files.push_back(de.path());
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<sf::Image>      images;
+    std::vector<AtlasPackInput> inputs;
+    for (const auto& f : files) {
+        sf::Image img;
+        if (!img.loadFromFile(f)) {
+            std::cerr << "[Atlas] cannot load " << f << "\n";
+            return 1;
+        }
+        fs::path rel = fs::relative(f, inDir);
+        rel.replace_extension();
+        inputs.push_back(AtlasPackInput{rel.generic_string(),
+                                        static_cast<int>(img.getSize().x),
+                                        static_cast<int>(img.getSize().y)});
+        images.push_back(std::move(img));
+    }
+
+    AtlasIndex idx;
+    std::string err;
+    if (!packAtlas(inputs, maxSize, padding, "atlas", idx, &err)) {
+        std::cerr << "[Atlas] " << err << "\n";
+        return 1;
+    }
+
+    std::vector<sf::Image> pages;
+    for (const auto& p : idx.pages) {
+        pages.emplace_back(sf::Vector2u{static_cast<unsigned>(p.width), static_cast<unsigned>(p.height)},
+                           sf::Color::Transparent);
+    }
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        const AtlasEntry* e = idx.find(inputs[i].name);
+        sf::Image& page = pages[static_cast<std::size_t>(e->page)];
+        if (!page.copy(images[i], {static_cast<unsigned>(e->x), static_cast<unsigned>(e->y)})) {
+            std::cerr << "[Atlas] copy failed for " << e->name << "\n";
+            return 1;
+        }
+        extrude(page, *e, padding);
+    }
+
+    fs::create_directories(outDir);
+    for (std::size_t i = 0; i < pages.size(); ++i) {
+        if (!pages[i].saveToFile(outDir / idx.pages[i].file)) {
+            std::cerr << "[Atlas] cannot write " << (outDir / idx.pages[i].file) << "\n";
+            return 1;
+        }
+    }
+    std::ofstream(outDir / "atlas.json") << writeJson(atlasToJson(idx)) << "\n";
+
+    std::cout << "[Atlas] " << inputs.size() << " images -> " << pages.size() << " page(s) in " << outDir << "\n";
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Balayage d'équilibrage : des milliers de parties headless réparties sur
+// tous les cœurs, statistiques agrégées par combinaison dans un CSV.
+//   td_sweep [--games 1000] [--seed 1] [--threads 0] [--waves 40]
+//            [--difficulty Easy,Normal,Hard,Custom]
+//            [--hp 0.8,1.0,1.2] [--speed ...] [--reward ...] [--lives ...]
+//            [--config ...] [--rules ...] [--blob config.tdcb]
+//            [--out sweep.csv] [--games-csv games.csv]
+// --hp/--speed/--reward/--lives remplacent la valeur du preset (produit cartésien).
+// Les graines sont les mêmes pour chaque combinaison : comparaisons appariées.
+// --blob : config compilée par td_config, à la place de --config/--rules.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sim/ConfigBlob.hpp"
+#include "sim/Game.hpp"
+
+#ifndef TD_CONFIG_DIR
+#define TD_CONFIG_DIR "config"
+#endif
+
+namespace {
+
+std::vector<std::string> splitList(const std::string& s) {
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) out.push_back(item);
+    }
+    return out;
+}
+
+std::vector<float> parseFloats(const std::string& s) {
+    std::vector<float> out;
+    for (const auto& item : splitList(s)) out.push_back(std::strtof(item.c_str(), nullptr));
+    return out;
+}
+
+// Quantile sur un tableau trié
+int quantile(const std::vector<int>& sorted, double q) {
+    if (sorted.empty()) return 0;
+    const std::size_t i = static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[i];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string difficultyPath = TD_CONFIG_DIR "/diffilculty.json";
+    std::string rulesPath      = TD_CONFIG_DIR "/game_rules.json";
+    std::string outPath        = "sweep.csv";
+    std::string gamesPath;
+    std::string blobPath;
+    std::vector<std::string> names;
+    std::vector<float> hpList, speedList, rewardList, livesList;
+    int           games    = 1000;
+    int           maxWaves = 40;
+    unsigned      threads  = 0;
+    std::uint64_t baseSeed = 1;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string key = argv[i];
+        const std::string val = argv[i + 1];
+        if      (key == "--games")      games = std::atoi(val.c_str());
+        else if (key == "--seed")       baseSeed = std::strtoull(val.c_str(), nullptr, 10);
+        else if (key == "--threads")    threads = static_cast<unsigned>(std::atoi(val.c_str()));
+        else if (key == "--waves")      maxWaves = std::atoi(val.c_str());
+        else if (key == "--difficulty") names = splitList(val);
+        else if (key == "--hp")         hpList = parseFloats(val);
+        else if (key == "--speed")      speedList = parseFloats(val);
+        else if (key == "--reward")     rewardList = parseFloats(val);
+        else if (key == "--lives")      livesList = parseFloats(val);
+        else if (key == "--config")     difficultyPath = val;
+        else if (key == "--rules")      rulesPath = val;
+        else if (key == "--blob")       blobPath = val;
+        else if (key == "--out")        outPath = val;
+        else if (key == "--games-csv")  gamesPath = val;
+        else { std::cerr << "[Sweep] Unknown option " << key << "\n"; return 2; }
+    }
+    if (games <= 0) return 2;
+
+    std::vector<DifficultyParams> all;
+    GameRules rules;
+    if (!blobPath.empty()) {
+        if (!loadConfigBlob(blobPath, all, rules)) return 1;
+    } else {
+        if (!loadDifficulties(difficultyPath, all)) return 1;
+        if (!loadGameRules(rulesPath, rules)) return 1;
+    }
+
+    // --- Combinaisons : presets x surcharges
+    std::vector<DifficultyParams> presets;
+    if (names.empty()) {
+        presets = all;
+    } else {
+        for (const auto& n : names) {
+            const DifficultyParams* d = findDifficulty(all, n);
+            if (!d) { std::cerr << "[Sweep] Unknown difficulty " << n << "\n"; return 1; }
+            presets.push_back(*d);
+        }
+    }
+
+    std::vector<DifficultyParams> combos;
+    for (const auto& base : presets) {
+        const std::vector<float> hp     = hpList.empty()     ? std::vector<float>{base.hpMultiplier}     : hpList;
+        const std::vector<float> speed  = speedList.empty()  ? std::vector<float>{base.speedMultiplier}  : speedList;
+        const std::vector<float> reward = rewardList.empty() ? std::vector<float>{base.rewardMultiplier} : rewardList;
+        const std::vector<float> lives  = livesList.empty()  ? std::vector<float>{static_cast<float>(base.livesStart)} : livesList;
+        for (float h : hp) for (float s : speed) for (float r : reward) for (float l : lives) {
+            DifficultyParams d = base;
+            d.hpMultiplier     = h;
+            d.speedMultiplier  = s;
+            d.rewardMultiplier = r;
+            d.livesStart       = static_cast<int>(l);
+            combos.push_back(d);
+        }
+    }
+
+    // --- Parties : une tâche = (combinaison, graine), résultats rangés par index
+    const std::size_t jobCount = combos.size() * static_cast<std::size_t>(games);
+    std::vector<GameResult> results(jobCount);
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    std::cerr << "[Sweep] " << combos.size() << " combos x " << games << " games on "
+              << threads << " threads\n";
+
+    const auto t0 = std::chrono::steady_clock::now();
+    auto worker = [&] {
+        for (;;) {
+            const std::size_t j = next.fetch_add(1, std::memory_order_relaxed);
+            if (j >= jobCount) return;
+            GameSetup setup;
+            setup.seed       = baseSeed + j % static_cast<std::size_t>(games);
+            setup.difficulty = combos[j / static_cast<std::size_t>(games)];
+            setup.rules      = rules;
+            setup.maxWaves   = maxWaves;
+            results[j] = Game(setup).run();
+
+            const std::size_t d = done.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (d % std::max<std::size_t>(1, jobCount / 20) == 0) {
+                std::cerr << "[Sweep] " << d << "/" << jobCount << "\n";
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) pool.emplace_back(worker);
+    for (auto& t : pool) t.join();
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    // --- Agrégats par combinaison
+    std::ofstream out(outPath);
+    if (!out) { std::cerr << "[Sweep] Failed to open " << outPath << "\n"; return 1; }
+    out << "difficulty,hpMultiplier,speedMultiplier,rewardMultiplier,livesStart,games,"
+           "survivalRate,meanWave,p10Wave,p50Wave,p90Wave,meanLivesLost,meanKills,meanTowers";
+    for (int w = 1; w <= maxWaves; ++w) out << ",gold_w" << w;
+    out << "\n";
+
+    std::uint64_t totalTicks = 0;
+    for (std::size_t c = 0; c < combos.size(); ++c) {
+        const DifficultyParams& d = combos[c];
+        const GameResult* r = &results[c * static_cast<std::size_t>(games)];
+
+        std::vector<int> waves;
+        double survived = 0, livesLost = 0, kills = 0, towers = 0;
+        std::vector<double> goldSum(static_cast<std::size_t>(maxWaves), 0.0);
+        std::vector<int>    goldN(static_cast<std::size_t>(maxWaves), 0);
+        for (int g = 0; g < games; ++g) {
+            waves.push_back(r[g].wavesCleared);
+            survived  += r[g].survived ? 1 : 0;
+            livesLost += r[g].livesLost;
+            kills     += static_cast<double>(r[g].kills);
+            towers    += r[g].towersBuilt;
+            totalTicks += r[g].ticks;
+            for (std::size_t w = 0; w < r[g].goldCurve.size() && w < goldSum.size(); ++w) {
+                goldSum[w] += r[g].goldCurve[w];
+                ++goldN[w];
+            }
+        }
+        std::sort(waves.begin(), waves.end());
+        double waveSum = 0;
+        for (int w : waves) waveSum += w;
+
+        out << d.name << ',' << d.hpMultiplier << ',' << d.speedMultiplier << ','
+            << d.rewardMultiplier << ',' << d.livesStart << ',' << games << ','
+            << survived / games << ',' << waveSum / games << ','
+            << quantile(waves, 0.1) << ',' << quantile(waves, 0.5) << ',' << quantile(waves, 0.9) << ','
+            << livesLost / games << ',' << kills / games << ',' << towers / games;
+        // Courbe d'or moyenne sur les parties ayant atteint la vague (vide sinon)
+        for (std::size_t w = 0; w < goldSum.size(); ++w) {
+            out << ',';
+            if (goldN[w]) out << goldSum[w] / goldN[w];
+        }
+        out << "\n";
+    }
+
+    if (!gamesPath.empty()) {
+        std::ofstream raw(gamesPath);
+        raw << "difficulty,hpMultiplier,speedMultiplier,rewardMultiplier,livesStart,seed,"
+               "waves,survived,livesLost,kills,towers,ticks\n";
+        for (std::size_t j = 0; j < jobCount; ++j) {
+            const DifficultyParams& d = combos[j / static_cast<std::size_t>(games)];
+            const GameResult& r = results[j];
+            raw << d.name << ',' << d.hpMultiplier << ',' << d.speedMultiplier << ','
+                << d.rewardMultiplier << ',' << d.livesStart << ',' << r.seed << ','
+                << r.wavesCleared << ',' << (r.survived ? 1 : 0) << ',' << r.livesLost << ','
+                << r.kills << ',' << r.towersBuilt << ',' << r.ticks << "\n";
+        }
+    }
+
+    std::cerr << "[Sweep] " << jobCount << " games in " << wall << "s ("
+              << static_cast<double>(totalTicks) / Game::kTickHz / 3600.0 << "h simulated) -> "
+              << outPath << "\n";
+    return 0;
+}
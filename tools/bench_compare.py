@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# Résultats de la cible `benchmarks` en JSON et comparaison à une référence.
+#   bench_compare.py run --exe build/benchmarks --out bench.json ["[config]" ...]
+#   bench_compare.py compare benchmarks/baseline.json bench.json [--threshold 0.10]
+#   bench_compare.py run --exe build/benchmarks --out bench.json --baseline benchmarks/baseline.json
+# Une régression = moyenne plus lente de plus de threshold ET intervalles de
+# confiance disjoints (le bruit d'une machine chargée ne suffit pas).
+# Code de sortie 1 si au moins une régression.
+# Par défaut, les cas [scaling] (temps liés au nombre de cœurs) sont exclus :
+# une référence prise sur une autre machine ne dit rien sur eux.
+import argparse
+import datetime
+import json
+import os
+import platform
+import subprocess
+import sys
+import xml.etree.ElementTree as ET
+
+
+DEFAULT_SPEC = "[!benchmark]~[scaling]"
+
+
+def parse_catch_xml(text):
+    """BenchmarkResults du reporter XML de Catch2 (temps en ns)."""
+    root = ET.fromstring(text)
+    results = []
+    for case in root.iter("TestCase"):
+        for b in case.iter("BenchmarkResults"):
+            mean = b.find("mean")
+            std = b.find("standardDeviation")
+            results.append({
+                "case": case.get("name"),
+                "name": b.get("name"),
+                "mean_ns": float(mean.get("value")),
+                "low_ns": float(mean.get("lowerBound")),
+                "high_ns": float(mean.get("upperBound")),
+                "stddev_ns": float(std.get("value")) if std is not None else 0.0,
+                "samples": int(b.get("samples", "0")),
+                "iterations": int(b.get("iterations", "0")),
+            })
+    return results
+
+
+def run(args):
+    filters = args.filters or [DEFAULT_SPEC]
+    cmd = [args.exe, *filters, "-r", "xml"]
+    proc = subprocess.run(cmd, capture_output=True, text=True)
+    if proc.returncode != 0:
+        sys.stderr.write(proc.stderr)
+        print(f"[Bench] {' '.join(cmd)} failed ({proc.returncode})", file=sys.stderr)
+        return 2
+    doc = {
+        "version": 1,
+        "date": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "machine": {"system": platform.system(), "machine": platform.machine(),
+                    "processor": platform.processor(), "cpus": os.cpu_count()},
+        "benchmarks": parse_catch_xml(proc.stdout),
+    }
+    with open(args.out, "w") as f:
+        json.dump(doc, f, indent=2)
+        f.write("\n")
+    print(f"[Bench] {len(doc['benchmarks'])} results written to {args.out}")
+    if args.baseline:
+        return compare_files(args.baseline, args.out, args.threshold)
+    return 0
+
+
+def fmt_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.2f} {unit}"
+    return f"{ns:.0f} ns"
+
+
+def compare_files(base_path, cur_path, threshold):
+    with open(base_path) as f:
+        base = {(b["case"], b["name"]): b for b in json.load(f)["benchmarks"]}
+    with open(cur_path) as f:
+        cur = {(b["case"], b["name"]): b for b in json.load(f)["benchmarks"]}
+
+    regressions = 0
+    width = max((len(n) for _, n in cur), default=10)
+    for key, c in cur.items():
+        b = base.get(key)
+        if b is None:
+            print(f"  {key[1]:<{width}}  {fmt_ns(c['mean_ns']):>10}  (new)")
+            continue
+        ratio = c["mean_ns"] / b["mean_ns"] if b["mean_ns"] > 0 else 1.0
+        slower = ratio > 1.0 + threshold and c["low_ns"] > b["high_ns"]
+        faster = ratio < 1.0 - threshold and c["high_ns"] < b["low_ns"]
+        mark = "REGRESSION" if slower else ("faster" if faster else "")
+        regressions += slower
+        print(f"  {key[1]:<{width}}  {fmt_ns(b['mean_ns']):>10} -> {fmt_ns(c['mean_ns']):>10}  x{ratio:.2f}  {mark}")
+    for key in base.keys() - cur.keys():
+        print(f"  {key[1]:<{width}}  (missing)")
+
+    if regressions:
+        print(f"[Bench] {regressions} regression(s) over {threshold:.0%}")
+        return 1
+    print(f"[Bench] no regression over {threshold:.0%}")
+    return 0
+
+
+def main():
+    p = argparse.ArgumentParser(description="Benchmark JSON results and regression check")
+    sub = p.add_subparsers(dest="cmd", required=True)
+
+    r = sub.add_parser("run", help="run the benchmarks and write JSON results")
+    r.add_argument("--exe", required=True)
+    r.add_argument("--out", default="bench.json")
+    r.add_argument("--baseline", help="compare against this file afterwards")
+    r.add_argument("--threshold", type=float, default=0.10)
+    r.add_argument("filters", nargs="*", help=f"Catch2 test specs (default: {DEFAULT_SPEC})")
+
+    c = sub.add_parser("compare", help="compare two JSON result files")
+    c.add_argument("baseline")
+    c.add_argument("current")
+    c.add_argument("--threshold", type=float, default=0.10)
+
+    args = p.parse_args()
+    if args.cmd == "run":
+        return run(args)
+    return compare_files(args.baseline, args.current, args.threshold)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,54 @@
+// Compilateur de config : valide diffilculty.json et game_rules.json contre
+// leur schéma et écrit le bloc binaire que le jeu projette en mémoire.
+//   td_config [--config config/diffilculty.json] [--rules config/game_rules.json]
+//             [--out config.tdcb] [--check]
+// --check : valide seulement (code de sortie 1 et erreurs si invalide).
+// Le jeu recharge le bloc à chaud quand il change.
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "sim/ConfigBlob.hpp"
+#include "sim/Json.hpp"
+
+#ifndef TD_CONFIG_DIR
+#define TD_CONFIG_DIR "config"
+#endif
+
+int main(int argc, char** argv) {
+    std::string difficultyPath = TD_CONFIG_DIR "/diffilculty.json";
+    std::string rulesPath      = TD_CONFIG_DIR "/game_rules.json";
+    std::string outPath        = "config.tdcb";
+    bool        checkOnly      = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string key = argv[i];
+        if (key == "--check") { checkOnly = true; continue; }
+        if (i + 1 >= argc) { std::cerr << "[Config] Missing value for " << key << "\n"; return 2; }
+        const char* val = argv[++i];
+        if      (key == "--config") difficultyPath = val;
+        else if (key == "--rules")  rulesPath = val;
+        else if (key == "--out")    outPath = val;
+        else { std::cerr << "[Config] Unknown option " << key << "\n"; return 2; }
+    }
+
+    if (checkOnly) {
+        JsonValue                 difficulties, rules;
+        std::string               err;
+        std::vector<std::uint8_t> data;
+        std::vector<std::string>  errors;
+        if (!loadJsonFile(difficultyPath, difficulties, &err)) errors.push_back(difficultyPath + ": " + err);
+        else if (!loadJsonFile(rulesPath, rules, &err))        errors.push_back(rulesPath + ": " + err);
+        else compileConfig(difficulties, rules, data, errors);
+        for (const std::string& e : errors) std::cerr << "[Config] " << e << "\n";
+        return errors.empty() ? 0 : 1;
+    }
+
+    if (!compileConfigFiles(difficultyPath, rulesPath, outPath)) return 1;
+    ConfigBlob blob;
+    if (!blob.open(outPath)) return 1;
+    std::printf("%s: %zu difficulties, %zu bytes\n", outPath.c_str(), blob.difficultyCount(),
+                sizeof(ConfigBlobHeader) + sizeof(RulesRecord) + blob.difficultyCount() * sizeof(DifficultyRecord));
+    return 0;
+}
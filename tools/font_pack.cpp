@@ -0,0 +1,70 @@
+// Réduit les polices utilisées par le jeu aux plages de caractères affichées
+// et les regroupe dans un seul paquet. Lancé par la cible CMake `fonts`.
+//   td_font_pack assets build/fonts.tdfb [--ranges 20-7E,A0-FF] fonts/a.ttf ...
+// Une police non TrueType (CFF) est empaquetée telle quelle.
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "sim/FontSubset.hpp"
+
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "usage: td_font_pack <assets_dir> <out_bundle> [--ranges R] <font> [font...]\n";
+        return 2;
+    }
+    const fs::path assetsDir = argv[1];
+    const fs::path outFile   = argv[2];
+    std::string rangeText = "20-7E,A0-FF,2010-2027,20AC";
+    std::vector<std::string> names;
+    for (int i = 3; i < argc; ++i) {
+        const std::string a = argv[i];
+        if (a == "--ranges" && i + 1 < argc) rangeText = argv[++i];
+        else names.push_back(a);
+    }
+    std::vector<CodepointRange> ranges;
+    if (!parseCodepointRanges(rangeText, ranges)) {
+        std::cerr << "[Fonts] bad ranges '" << rangeText << "'\n";
+        return 2;
+    }
+
+    std::vector<std::pair<std::string, std::vector<std::uint8_t>>> fonts;
+    for (const std::string& name : names) {
+        std::ifstream is(assetsDir / name, std::ios::binary);
+        if (!is) {
+            std::cerr << "[Fonts] cannot open " << (assetsDir / name) << "\n";
+            return 1;
+        }
+        const std::vector<std::uint8_t> bytes{std::istreambuf_iterator<char>(is), {}};
+
+        std::vector<std::uint8_t> subset;
+        FontSubsetStats st;
+        std::string err;
+        if (subsetTrueType(bytes, ranges, subset, &st, &err)) {
+            std::cout << "[Fonts] " << name << ": " << st.glyphsKept << "/" << st.glyphsTotal << " glyphs, "
+                      << st.bytesIn / 1024 << " KB -> " << st.bytesOut / 1024 << " KB";
+            if (!st.droppedTables.empty()) {
+                std::cout << " (dropped";
+                for (const auto& t : st.droppedTables) std::cout << " " << t;
+                std::cout << ")";
+            }
+            std::cout << "\n";
+            fonts.emplace_back(fs::path(name).generic_string(), std::move(subset));
+        } else {
+            std::cerr << "[Fonts] " << name << ": " << err << ", packed as is\n";
+            fonts.emplace_back(fs::path(name).generic_string(), bytes);
+        }
+    }
+
+    if (outFile.has_parent_path()) fs::create_directories(outFile.parent_path());
+    if (!writeFontBundle(outFile.string(), fonts)) {
+        std::cerr << "[Fonts] cannot write " << outFile << "\n";
+        return 1;
+    }
+    return 0;
+}
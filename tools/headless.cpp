@@ -0,0 +1,91 @@
+// Partie sans fenêtre : une graine + une config -> résultat sur la sortie standard.
+//   td_headless [--seed N] [--difficulty Normal] [--waves 40]
+//               [--config config/diffilculty.json] [--rules config/game_rules.json]
+//               [--blob config.tdcb]    (config compilée par td_config)
+//               [--record partie.tdr]   (journal rejouable par td_replay)
+//               [--trace trace.json]    (portées PROFILE_SCOPE, trace Chrome)
+//               [--threads 1]           (JobSystem, 0 : un par cœur ; même résultat)
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "sim/ConfigBlob.hpp"
+#include "sim/JobSystem.hpp"
+#include "sim/Profiler.hpp"
+#include "sim/Replay.hpp"
+
+#ifndef TD_CONFIG_DIR
+#define TD_CONFIG_DIR "config"
+#endif
+
+int main(int argc, char** argv) {
+    std::string difficultyPath = TD_CONFIG_DIR "/diffilculty.json";
+    std::string rulesPath      = TD_CONFIG_DIR "/game_rules.json";
+    std::string difficulty     = "Normal";
+    std::string recordPath;
+    std::string tracePath;
+    std::string blobPath;
+    unsigned    threads = 1;
+    GameSetup setup;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string key = argv[i];
+        const char*       val = argv[i + 1];
+        if      (key == "--seed")       setup.seed = std::strtoull(val, nullptr, 10);
+        else if (key == "--difficulty") difficulty = val;
+        else if (key == "--waves")      setup.maxWaves = std::atoi(val);
+        else if (key == "--config")     difficultyPath = val;
+        else if (key == "--rules")      rulesPath = val;
+        else if (key == "--blob")       blobPath = val;
+        else if (key == "--record")     recordPath = val;
+        else if (key == "--trace")      tracePath = val;
+        else if (key == "--threads")    threads = static_cast<unsigned>(std::strtoul(val, nullptr, 10));
+        else { std::cerr << "[Headless] Unknown option " << key << "\n"; return 2; }
+    }
+
+    std::vector<DifficultyParams> all;
+    if (!blobPath.empty()) {
+        if (!loadConfigBlob(blobPath, all, setup.rules)) return 1;
+    } else {
+        if (!loadDifficulties(difficultyPath, all)) return 1;
+        if (!loadGameRules(rulesPath, setup.rules)) return 1;
+    }
+    const DifficultyParams* d = findDifficulty(all, difficulty);
+    if (!d) { std::cerr << "[Headless] Unknown difficulty " << difficulty << "\n"; return 1; }
+    setup.difficulty = *d;
+
+    // Les tampons gardent les Profiler::kRingSize dernières portées (fin de partie)
+    if (!tracePath.empty()) {
+        Profiler::setThreadName("simulation");
+        Profiler::setEnabled(true);
+    }
+    JobSystem  jobs(threads);
+    const auto t0 = std::chrono::steady_clock::now();
+    Game game(setup, nullptr, jobs.threads() > 1 ? &jobs : nullptr);
+    ReplayRecorder recorder;
+    if (!recordPath.empty() && recorder.open(recordPath, setup)) {
+        game.setCommandSink([&recorder](const GameCommand& c) { recorder.record(c); });
+    }
+    const GameResult r = game.run();
+    if (recorder.isOpen()) recorder.finish(game.tick(), game.stateHash());
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    const double simSeconds = static_cast<double>(r.ticks) / Game::kTickHz;
+
+    std::cout << "seed="         << r.seed
+              << " difficulty="  << d->name
+              << " waves="       << r.wavesCleared
+              << " survived="    << (r.survived ? 1 : 0)
+              << " livesLost="   << r.livesLost
+              << " kills="       << r.kills
+              << " towers="      << r.towersBuilt
+              << " gold="        << (r.goldCurve.empty() ? game.gold() : r.goldCurve.back())
+              << "\n";
+    if (!tracePath.empty()) {
+        Profiler::setEnabled(false);
+        Profiler::writeChromeTrace(tracePath);
+    }
+    std::cerr << "[Headless] " << simSeconds << "s simulated in " << wall * 1000.0 << "ms (x"
+              << (wall > 0.0 ? simSeconds / wall : 0.0) << ")\n";
+    return 0;
+}
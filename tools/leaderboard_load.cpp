@@ -0,0 +1,161 @@
+// Test de charge du serveur de classement : des connexions concurrentes qui
+// soumettent des scores et attendent chaque acquittement.
+//   td_leaderboard_load [--host 127.0.0.1] [--port 47800] [--clients 64]
+//                       [--requests 100] [--batch 1] [--top-every 10]
+// Latence = envoi de la requête -> réponse complète, mesurée par requête ;
+// p50/p90/p99/max pour les Submit et les TopQuery (une toutes les --top-every).
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SFML/Network.hpp>
+
+#include "sim/ScoreProtocol.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char* const kDifficulties[] = {"Easy", "Normal", "Hard", "Custom"};
+
+struct ClientResult {
+    std::vector<double> submitUs, topUs;
+    std::uint64_t       accepted = 0;
+    bool                failed   = false;
+};
+
+// Un message de réponse complet (socket bloquant)
+bool receiveMessage(sf::TcpSocket& socket, MessageBuffer& in, ScoreMessageView& out) {
+    char buf[16384];
+    while (!in.next(out)) {
+        if (in.error()) return false;
+        std::size_t n = 0;
+        if (socket.receive(buf, sizeof(buf), n) != sf::Socket::Status::Done) return false;
+        in.append(buf, n);
+    }
+    return true;
+}
+
+void runClient(sf::IpAddress host, unsigned short port, int id, int requests, int batch, int topEvery,
+               ClientResult& r) {
+    sf::TcpSocket socket;
+    if (socket.connect(host, port, sf::seconds(5.f)) != sf::Socket::Status::Done) {
+        r.failed = true;
+        return;
+    }
+    Rng                       rng(static_cast<std::uint64_t>(id) + 1);
+    MessageBuffer             in;
+    std::vector<std::uint8_t> out;
+    std::vector<ScoreEntry>   entries(static_cast<std::size_t>(batch));
+    std::vector<ScoreEntry>   top;
+    r.submitUs.reserve(static_cast<std::size_t>(requests));
+
+    for (int i = 0; i < requests; ++i) {
+        for (ScoreEntry& e : entries) {
+            e.name       = "load" + std::to_string(id);
+            e.difficulty = kDifficulties[rng.below(4)];
+            e.score      = rng.below(1'000'000);
+            e.waves      = rng.below(40);
+        }
+        out.clear();
+        encodeSubmit(entries.data(), entries.size(), out);
+        const auto t0 = Clock::now();
+        ScoreMessageView m;
+        std::uint32_t accepted = 0;
+        if (socket.send(out.data(), out.size()) != sf::Socket::Status::Done ||
+            !receiveMessage(socket, in, m) || !decodeSubmitAck(m, accepted)) {
+            r.failed = true;
+            return;
+        }
+        r.submitUs.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+        r.accepted += accepted;
+
+        if (topEvery > 0 && (i + 1) % topEvery == 0) {
+            out.clear();
+            encodeTopQuery("Normal", 10, out);
+            const auto q0 = Clock::now();
+            std::string   difficulty;
+            std::uint64_t total = 0;
+            if (socket.send(out.data(), out.size()) != sf::Socket::Status::Done ||
+                !receiveMessage(socket, in, m) || !decodeTopReply(m, difficulty, total, top)) {
+                r.failed = true;
+                return;
+            }
+            r.topUs.push_back(std::chrono::duration<double, std::micro>(Clock::now() - q0).count());
+        }
+    }
+}
+
+double quantile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    const auto i = static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[i];
+}
+
+void report(const char* what, std::vector<double>& us, double wall) {
+    std::sort(us.begin(), us.end());
+    std::printf("%-7s %8zu requests  %9.0f req/s  p50 %8.1f us  p90 %8.1f us  p99 %8.1f us  max %8.1f us\n",
+                what, us.size(), static_cast<double>(us.size()) / wall, quantile(us, 0.50), quantile(us, 0.90),
+                quantile(us, 0.99), us.empty() ? 0.0 : us.back());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string    hostName = "127.0.0.1";
+    unsigned short port     = kScoreServerPort;
+    int            clients  = 64;
+    int            requests = 100;
+    int            batch    = 1;
+    int            topEvery = 10;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string key = argv[i];
+        const char*       val = argv[i + 1];
+        if      (key == "--host")      hostName = val;
+        else if (key == "--port")      port = static_cast<unsigned short>(std::atoi(val));
+        else if (key == "--clients")   clients = std::atoi(val);
+        else if (key == "--requests")  requests = std::atoi(val);
+        else if (key == "--batch")     batch = std::atoi(val);
+        else if (key == "--top-every") topEvery = std::atoi(val);
+        else { std::cerr << "[Load] Unknown option " << key << "\n"; return 2; }
+    }
+    if (clients <= 0 || requests <= 0 || batch <= 0) return 2;
+    const std::optional<sf::IpAddress> host = sf::IpAddress::resolve(hostName);
+    if (!host) { std::cerr << "[Load] Unknown host " << hostName << "\n"; return 1; }
+
+    std::cerr << "[Load] " << clients << " clients x " << requests << " submissions of " << batch
+              << " score(s) -> " << hostName << ":" << port << "\n";
+    std::vector<ClientResult> results(static_cast<std::size_t>(clients));
+    const auto t0 = Clock::now();
+    {
+        std::vector<std::thread> pool;
+        for (int c = 0; c < clients; ++c) {
+            pool.emplace_back(runClient, *host, port, c, requests, batch, topEvery, std::ref(results[static_cast<std::size_t>(c)]));
+        }
+        for (auto& t : pool) t.join();
+    }
+    const double wall = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    std::vector<double> submitUs, topUs;
+    std::uint64_t accepted = 0;
+    int failed = 0;
+    for (const ClientResult& r : results) {
+        submitUs.insert(submitUs.end(), r.submitUs.begin(), r.submitUs.end());
+        topUs.insert(topUs.end(), r.topUs.begin(), r.topUs.end());
+        accepted += r.accepted;
+        failed += r.failed ? 1 : 0;
+    }
+    report("submit", submitUs, wall);
+    if (!topUs.empty()) report("top", topUs, wall);
+    std::printf("%llu scores accepted in %.2f s (%.0f scores/s), %d client(s) failed\n",
+                static_cast<unsigned long long>(accepted), wall, static_cast<double>(accepted) / wall, failed);
+    return failed ? 1 : 0;
+}
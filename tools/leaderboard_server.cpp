@@ -0,0 +1,164 @@
+// Serveur de classement local, en attendant le classement en ligne.
+//   td_leaderboard_server [--port 47800] [--log server_scores.tdlb] [--keep 0]
+//                         [--delay-ms 0]
+// Un seul thread, sockets non bloquants. Les soumissions reçues pendant un
+// tour de boucle sont écrites au journal en une fois (un flush pour toutes
+// les connexions), puis chaque connexion reçoit ses réponses dans l'ordre.
+// --delay-ms ralentit chaque tour (tester un client face à un serveur lent).
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SFML/Network.hpp>
+
+#include "sim/Leaderboard.hpp"
+#include "sim/ScoreProtocol.hpp"
+
+namespace {
+
+volatile std::sig_atomic_t gStop = 0;
+void onSignal(int) { gStop = 1; }
+
+struct Request {
+    ScoreMessage  type  = ScoreMessage::Submit;
+    std::uint32_t count = 0; // Submit : scores ; TopQuery : n
+    std::string   difficulty;
+};
+
+struct Connection {
+    sf::TcpSocket             socket;
+    MessageBuffer             in;
+    std::vector<std::uint8_t> out;      // réponses pas encore parties
+    std::size_t               sent = 0;
+    std::vector<Request>      requests; // du tour en cours
+    bool                      closed = false;
+};
+
+// Réponses en attente ; false si la connexion est perdue
+bool flushOut(Connection& c) {
+    while (c.sent < c.out.size()) {
+        std::size_t n = 0;
+        const sf::Socket::Status st = c.socket.send(c.out.data() + c.sent, c.out.size() - c.sent, n);
+        c.sent += n;
+        if (st == sf::Socket::Status::NotReady || st == sf::Socket::Status::Partial) return true;
+        if (st != sf::Socket::Status::Done) return false;
+    }
+    c.out.clear();
+    c.sent = 0;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    unsigned short port    = kScoreServerPort;
+    std::string    logPath = "server_scores.tdlb";
+    std::size_t    keep    = 0;
+    int            delayMs = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string key = argv[i];
+        const char*       val = argv[i + 1];
+        if      (key == "--port")     port = static_cast<unsigned short>(std::atoi(val));
+        else if (key == "--log")      logPath = val;
+        else if (key == "--keep")     keep = static_cast<std::size_t>(std::atoll(val));
+        else if (key == "--delay-ms") delayMs = std::atoi(val);
+        else { std::cerr << "[Server] Unknown option " << key << "\n"; return 2; }
+    }
+
+    Leaderboard board(keep);
+    if (!board.open(logPath)) return 1;
+
+    sf::TcpListener listener;
+    if (listener.listen(port, sf::IpAddress::LocalHost) != sf::Socket::Status::Done) {
+        std::cerr << "[Server] Failed to listen on port " << port << "\n";
+        return 1;
+    }
+    listener.setBlocking(false);
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::cerr << "[Server] " << board.size() << " scores, listening on 127.0.0.1:" << port << "\n";
+
+    sf::SocketSelector                       selector;
+    std::vector<std::unique_ptr<Connection>> conns;
+    std::vector<ScoreEntry>                  batch, decoded;
+    std::uint64_t                            submitted = 0, queries = 0;
+    selector.add(listener);
+
+    while (!gStop) {
+        // Réveil périodique : les réponses restées en attente repartent aussi
+        const bool ready = selector.wait(sf::milliseconds(50));
+
+        if (ready && selector.isReady(listener)) {
+            for (;;) {
+                auto c = std::make_unique<Connection>();
+                if (listener.accept(c->socket) != sf::Socket::Status::Done) break;
+                c->socket.setBlocking(false);
+                selector.add(c->socket);
+                conns.push_back(std::move(c));
+            }
+        }
+
+        // Lecture de tout ce qui est arrivé, soumissions regroupées
+        batch.clear();
+        for (auto& c : conns) {
+            if (!ready || !selector.isReady(c->socket)) continue;
+            char buf[16384];
+            for (;;) {
+                std::size_t n = 0;
+                const sf::Socket::Status st = c->socket.receive(buf, sizeof(buf), n);
+                if (n > 0) c->in.append(buf, n);
+                if (st == sf::Socket::Status::NotReady) break;
+                if (st != sf::Socket::Status::Done && st != sf::Socket::Status::Partial) { c->closed = true; break; }
+            }
+            ScoreMessageView m;
+            while (c->in.next(m)) {
+                Request r;
+                r.type = m.type;
+                if (m.type == ScoreMessage::Submit && decodeSubmit(m, decoded)) {
+                    r.count = static_cast<std::uint32_t>(decoded.size());
+                    for (ScoreEntry& e : decoded) batch.push_back(std::move(e));
+                } else if (!(m.type == ScoreMessage::TopQuery && decodeTopQuery(m, r.difficulty, r.count))) {
+                    c->closed = true; // requête invalide : on ne devine pas
+                    break;
+                }
+                c->requests.push_back(std::move(r));
+            }
+            if (c->in.error()) c->closed = true;
+        }
+
+        if (delayMs > 0 && ready) std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        const bool stored = batch.empty() || board.submit(batch);
+        submitted += stored ? batch.size() : 0;
+
+        // Réponses, dans l'ordre des requêtes de chaque connexion
+        for (auto& c : conns) {
+            for (const Request& r : c->requests) {
+                if (r.type == ScoreMessage::Submit) {
+                    encodeSubmitAck(stored ? r.count : 0, c->out);
+                } else {
+                    encodeTopReply(r.difficulty, board.count(r.difficulty), board.top(r.difficulty, std::min(r.count, kMaxTopQuery)), c->out);
+                    ++queries;
+                }
+            }
+            c->requests.clear();
+            if (!c->closed && !flushOut(*c)) c->closed = true;
+        }
+        for (auto it = conns.begin(); it != conns.end();) {
+            if ((*it)->closed) {
+                selector.remove((*it)->socket);
+                it = conns.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    std::cerr << "[Server] stopped: " << submitted << " scores stored, " << queries << " top queries served\n";
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Débit du générateur de cartes : cartes acceptées par seconde, par taille.
+//   td_mapgen [--size 128,512] [--count 200] [--threads 0] [--seed 1]
+//             [--obstacles 12] [--cache maps]
+// Trois mesures par taille, sur les mêmes graines (donc les mêmes cartes) :
+//   serial      un cœur, candidats l'un après l'autre
+//   per-seed    candidats d'une graine répartis sur tous les cœurs (latence)
+//   throughput  une graine par cœur, candidats en série (débit)
+// --cache : cartes écrites puis relues depuis ce dossier (débit de relecture).
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sim/MapGen.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point t0) {
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+struct Totals {
+    std::atomic<std::uint64_t> candidates{0};
+    std::atomic<std::uint64_t> rejected{0};
+    std::atomic<std::uint32_t> fallbacks{0};
+    std::atomic<std::uint64_t> checksum{0}; // somme des obstacles : mêmes cartes d'un mode à l'autre
+
+    void add(const MapGenStats& s, bool ok, const GridMap& m) {
+        candidates.fetch_add(s.candidates, std::memory_order_relaxed);
+        rejected.fetch_add(s.rejected, std::memory_order_relaxed);
+        if (!ok) fallbacks.fetch_add(1, std::memory_order_relaxed);
+        std::uint64_t n = 0;
+        for (const auto b : m.blocked) n += b;
+        checksum.fetch_add(n, std::memory_order_relaxed);
+    }
+};
+
+void report(const char* mode, int size, int count, double wall, const Totals& t) {
+    const double cands = static_cast<double>(t.candidates.load());
+    std::printf("%4dx%-4d %-10s %9.1f maps/s  %9.1f candidates/s  accept %5.1f%%  fallback %u  sum %llu\n",
+                size, size, mode, count / wall, cands / wall,
+                cands > 0 ? 100.0 * (cands - static_cast<double>(t.rejected.load())) / cands : 0.0,
+                t.fallbacks.load(), static_cast<unsigned long long>(t.checksum.load()));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<int> sizes = {128, 512};
+    int           count    = 200;
+    unsigned      threads  = 0;
+    std::uint64_t baseSeed = 1;
+    int           obstacles = 12;
+    std::string   cacheDir;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string key = argv[i];
+        const std::string val = argv[i + 1];
+        if (key == "--size") {
+            sizes.clear();
+            std::stringstream ss(val);
+            for (std::string item; std::getline(ss, item, ',');) {
+                if (!item.empty()) sizes.push_back(std::atoi(item.c_str()));
+            }
+        }
+        else if (key == "--count")     count = std::atoi(val.c_str());
+        else if (key == "--threads")   threads = static_cast<unsigned>(std::atoi(val.c_str()));
+        else if (key == "--seed")      baseSeed = std::strtoull(val.c_str(), nullptr, 10);
+        else if (key == "--obstacles") obstacles = std::atoi(val.c_str());
+        else if (key == "--cache")     cacheDir = val;
+        else { std::cerr << "[MapGen] Unknown option " << key << "\n"; return 2; }
+    }
+    if (count <= 0 || sizes.empty()) return 2;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    std::cerr << "[MapGen] " << count << " maps per size, " << threads << " threads\n";
+
+    for (const int size : sizes) {
+        if (size < 3) continue;
+        MapGenParams params;
+        params.width           = size;
+        params.height          = size;
+        params.obstaclePercent = obstacles;
+
+        {
+            Totals t;
+            const auto t0 = Clock::now();
+            for (int i = 0; i < count; ++i) {
+                GridMap m;
+                MapGenStats s;
+                t.add(s, generateMap(params, baseSeed + static_cast<std::uint64_t>(i), m, &s, 1), m);
+            }
+            report("serial", size, count, secondsSince(t0), t);
+        }
+        {
+            Totals t;
+            const auto t0 = Clock::now();
+            for (int i = 0; i < count; ++i) {
+                GridMap m;
+                MapGenStats s;
+                t.add(s, generateMap(params, baseSeed + static_cast<std::uint64_t>(i), m, &s, threads), m);
+            }
+            report("per-seed", size, count, secondsSince(t0), t);
+        }
+        {
+            Totals t;
+            std::atomic<int> next{0};
+            const auto t0 = Clock::now();
+            auto worker = [&] {
+                for (int i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count;) {
+                    GridMap m;
+                    MapGenStats s;
+                    t.add(s, generateMap(params, baseSeed + static_cast<std::uint64_t>(i), m, &s, 1), m);
+                }
+            };
+            std::vector<std::thread> pool;
+            for (unsigned k = 0; k < threads; ++k) pool.emplace_back(worker);
+            for (auto& th : pool) th.join();
+            report("throughput", size, count, secondsSince(t0), t);
+        }
+
+        if (!cacheDir.empty()) {
+            const MapCache cache(cacheDir);
+            for (int i = 0; i < count; ++i) {
+                GridMap m;
+                generateMap(params, baseSeed + static_cast<std::uint64_t>(i), m, nullptr, threads);
+                if (!cache.store(params, baseSeed + static_cast<std::uint64_t>(i), m)) {
+                    std::cerr << "[MapGen] Failed to write " << cache.pathFor(params, baseSeed + i) << "\n";
+                    return 1;
+                }
+            }
+            int hits = 0;
+            const auto t0 = Clock::now();
+            for (int i = 0; i < count; ++i) {
+                GridMap m;
+                hits += cache.load(params, baseSeed + static_cast<std::uint64_t>(i), m) ? 1 : 0;
+            }
+            const double wall = secondsSince(t0);
+            std::printf("%4dx%-4d %-10s %9.1f maps/s  hits %d/%d\n", size, size, "cache", count / wall, hits, count);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,33 @@
+// Rejoue un journal d'entrées sans fenêtre, aussi vite que possible, et
+// vérifie l'empreinte d'état finale. Code de sortie 1 si elle diffère.
+//   td_replay partie.tdr [autre.tdr ...]
+#include <chrono>
+#include <iostream>
+
+#include "sim/Replay.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "usage: td_replay <log.tdr>...\n";
+        return 2;
+    }
+
+    int failures = 0;
+    for (int i = 1; i < argc; ++i) {
+        ReplayLog log;
+        if (!readReplay(argv[i], log)) { ++failures; continue; }
+
+        const auto t0 = std::chrono::steady_clock::now();
+        const ReplayCheck c = verifyReplay(log);
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        const double simSeconds = static_cast<double>(c.ticks) / Game::kTickHz;
+
+        std::cout << argv[i] << ": " << (c.ok ? "OK" : "MISMATCH")
+                  << " ticks=" << c.ticks << "/" << log.finalTick
+                  << " commands=" << log.commands.size()
+                  << " hash=" << std::hex << c.actualHash << "/" << c.expectedHash << std::dec
+                  << " (" << simSeconds << "s replayed in " << wall * 1000.0 << "ms)\n";
+        if (!c.ok) ++failures;
+    }
+    return failures ? 1 : 0;
+}